@@ -1,6 +1,12 @@
 #pragma once
 
+#include <ostream>
+#include <source_location>
+#include <vector>
+
 #include "exqudens/vulkan/Factory.hpp"
+#include "exqudens/vulkan/model/ResourceKey.hpp"
+#include "exqudens/vulkan/model/ResourceStatistics.hpp"
 
 namespace exqudens::vulkan {
 
@@ -10,7 +16,28 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual Surface add(const Surface& surface) = 0;
+      // values record the caller as their creation site, the create methods take the same defaulted location
+      virtual Surface add(
+          const Surface& surface,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+
+      // destroys the value and everything created from it, children first
+      virtual void destroyWithDependents(const ResourceKey& key) = 0;
+
+      // values created on the calling thread until the matching endScope belong to its innermost open scope
+      virtual uint64_t beginScope() = 0;
+
+      // destroys in one batch what the scope still holds, scopes end innermost first on the thread that began them
+      virtual void endScope(uint64_t scope) = 0;
+
+      // snapshot of every resource type created so far
+      virtual std::vector<ResourceStatistics> getResourceStatistics() = 0;
+
+      // what the last destroy() found still alive, empty when everything was destroyed before
+      virtual std::vector<ResourceStatistics> getResourceLeaks() = 0;
+
+      virtual void writeResourceStatistics(std::ostream& stream) = 0;
 
       virtual void destroy() = 0;
 
@@ -1,12 +1,35 @@
 #pragma once
 
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <future>
 #include <map>
+#include <mutex>
+#include <set>
+#include <source_location>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "exqudens/vulkan/Context.hpp"
 #include "exqudens/vulkan/FactoryBase.hpp"
+#include "exqudens/vulkan/SlotMap.hpp"
 
 namespace exqudens::vulkan {
 
+  // create and destroy calls may run concurrently from many threads, the driver calls run outside of any lock:
+  // registries, the dependency graph and the factory caches are locked only to look up and insert.
+  // external synchronization, as in Vulkan itself:
+  // - instance and device create and destroy, destroy() and the first call on the context run alone
+  // - a value passed by non-const reference (allocator, bindless table, command pool, swap chain) is used by one thread at a time
+  // - swap chain recreation and presentation stay on one thread
+  // - every thread has its own scope stack, a scope ends on the thread that began it and takes only the values created there
   class ContextBase:
       virtual public Context,
       virtual public FactoryBase
@@ -14,80 +37,136 @@ namespace exqudens::vulkan {
 
     protected:
 
-      unsigned int instanceId = 0;
-      unsigned int debugUtilsMessengerId = 0;
-      unsigned int physicalDeviceId = 0;
-      unsigned int deviceId = 0;
-      unsigned int bufferId = 0;
-      unsigned int imageId = 0;
-      unsigned int imageViewId = 0;
-      unsigned int samplerId = 0;
-      unsigned int renderPassId = 0;
-      unsigned int descriptorSetLayoutId = 0;
-      unsigned int descriptorPoolId = 0;
-      unsigned int descriptorSetId = 0;
-      unsigned int pipelineId = 0;
-      unsigned int frameBufferId = 0;
-      unsigned int surfaceId = 0;
-      unsigned int swapChainId = 0;
-      unsigned int queueId = 0;
-      unsigned int commandPoolId = 0;
-      unsigned int commandBufferId = 0;
-      unsigned int semaphoreId = 0;
-      unsigned int fenceId = 0;
-
-      std::map<unsigned int, Instance> instances = {};
-      std::map<unsigned int, DebugUtilsMessenger> debugUtilsMessengers = {};
-      std::map<unsigned int, PhysicalDevice> physicalDevices = {};
-      std::map<unsigned int, Device> devices = {};
-      std::map<unsigned int, Buffer> buffers = {};
-      std::map<unsigned int, Image> images = {};
-      std::map<unsigned int, ImageView> imageViews = {};
-      std::map<unsigned int, Sampler> samplers = {};
-      std::map<unsigned int, RenderPass> renderPasses = {};
-      std::map<unsigned int, DescriptorSetLayout> descriptorSetLayouts = {};
-      std::map<unsigned int, DescriptorPool> descriptorPools = {};
-      std::map<unsigned int, DescriptorSet> descriptorSets = {};
-      std::map<unsigned int, Pipeline> pipelines = {};
-      std::map<unsigned int, FrameBuffer> frameBuffers = {};
-      std::map<unsigned int, Surface> surfaces = {};
-      std::map<unsigned int, SwapChain> swapChains = {};
-      std::map<unsigned int, Queue> queues = {};
-      std::map<unsigned int, CommandPool> commandPools = {};
-      std::map<unsigned int, CommandBuffer> commandBuffers = {};
-      std::map<unsigned int, Semaphore> semaphores = {};
-      std::map<unsigned int, Fence> fences = {};
+      // raw Vulkan handle tagged with the registry it belongs to
+      using ResourceHandle = std::pair<ResourceType, uint64_t>;
+
+      // below this many independent destroy jobs one level is torn down on the calling thread
+      static constexpr std::size_t PARALLEL_DESTROY_MIN_JOBS = 64;
+
+      // values destroyed on their own stay listed until the scope ends
+      struct Scope {
+
+        uint64_t id;
+        std::vector<ResourceKey> keys;
+
+      };
+
+      struct ResourceRecord {
+
+        const std::string* site;
+        VkDeviceSize memorySize;
+
+      };
+
+      // one lock per registry, held only while the registry itself changes
+      std::mutex instanceMutex;
+      std::mutex debugUtilsMessengerMutex;
+      std::mutex physicalDeviceMutex;
+      std::mutex deviceMutex;
+      std::mutex bufferMutex;
+      std::mutex imageMutex;
+      std::mutex imageViewMutex;
+      std::mutex samplerMutex;
+      std::mutex renderPassMutex;
+      std::mutex descriptorSetLayoutMutex;
+      std::mutex descriptorPoolMutex;
+      std::mutex descriptorSetMutex;
+      std::mutex descriptorAllocatorMutex;
+      std::mutex descriptorUpdateTemplateMutex;
+      std::mutex bindlessTableMutex;
+      std::mutex pipelineMutex;
+      std::mutex frameBufferMutex;
+      std::mutex surfaceMutex;
+      std::mutex swapChainMutex;
+      std::mutex queueMutex;
+      std::mutex commandPoolMutex;
+      std::mutex commandBufferMutex;
+      std::mutex semaphoreMutex;
+      std::mutex fenceMutex;
+
+      // dependency graph, never held together with a registry lock
+      std::mutex dependencyMutex;
+
+      std::mutex scopeMutex;
+      std::mutex statisticsMutex;
+
+      SlotMap<Instance> instances = {};
+      SlotMap<DebugUtilsMessenger> debugUtilsMessengers = {};
+      SlotMap<PhysicalDevice> physicalDevices = {};
+      SlotMap<Device> devices = {};
+      SlotMap<Buffer> buffers = {};
+      SlotMap<Image> images = {};
+      SlotMap<ImageView> imageViews = {};
+      SlotMap<Sampler> samplers = {};
+      SlotMap<RenderPass> renderPasses = {};
+      SlotMap<DescriptorSetLayout> descriptorSetLayouts = {};
+      SlotMap<DescriptorPool> descriptorPools = {};
+      SlotMap<DescriptorSet> descriptorSets = {};
+      SlotMap<DescriptorAllocator> descriptorAllocators = {};
+      SlotMap<DescriptorUpdateTemplate> descriptorUpdateTemplates = {};
+      SlotMap<BindlessTable> bindlessTables = {};
+      SlotMap<Pipeline> pipelines = {};
+      SlotMap<FrameBuffer> frameBuffers = {};
+      SlotMap<Surface> surfaces = {};
+      SlotMap<SwapChain> swapChains = {};
+      SlotMap<Queue> queues = {};
+      SlotMap<CommandPool> commandPools = {};
+      SlotMap<CommandBuffer> commandBuffers = {};
+      SlotMap<Semaphore> semaphores = {};
+      SlotMap<Fence> fences = {};
+
+      // edges are taken from the handles passed to create, a child always goes before its parents,
+      // a cached handle is held by every create that returned it
+      std::map<ResourceHandle, std::vector<ResourceKey>> handleResources = {};
+      std::map<ResourceKey, std::vector<ResourceHandle>> resourceHandles = {};
+      std::map<ResourceKey, std::set<ResourceKey>> resourceDependents = {};
+      std::map<ResourceKey, std::set<ResourceKey>> resourceDependencies = {};
+
+      // open scopes of each thread, innermost last
+      std::map<std::thread::id, std::vector<Scope>> scopes = {};
+      uint64_t nextScopeId = 1;
+
+      // sites are interned, set nodes stay in place for the records pointing at them
+      std::set<std::string> resourceSites = {};
+      std::map<ResourceKey, ResourceRecord> resourceRecords = {};
+      std::map<ResourceType, ResourceStatistics> resourceStatistics = {};
+      std::vector<ResourceStatistics> resourceLeaks = {};
 
     public:
 
       // create
 
-      Instance createInstance(Configuration& configuration, Logger& logger) override {
+      Instance createInstance(
+          Configuration& configuration,
+          Logger& logger,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
-          unsigned int key = instanceId++;
           Instance value = InstanceFactoryBase::createInstance(
               configuration,
-              logger
+              logger,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          instances[key] = value;
+          registerValue(instanceMutex, instances, value, location);
+          updateFunctions();
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
-      DebugUtilsMessenger createDebugUtilsMessenger(VkInstance& instance, Logger& logger) override {
+      DebugUtilsMessenger createDebugUtilsMessenger(
+          VkInstance& instance,
+          Logger& logger,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
-          unsigned int key = debugUtilsMessengerId++;
           DebugUtilsMessenger value = DebugUtilsMessengerFactoryBase::createDebugUtilsMessenger(
               instance,
-              logger
+              logger,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          debugUtilsMessengers[key] = value;
+          registerValue(debugUtilsMessengerMutex, debugUtilsMessengers, value, location, {resourceHandle(ResourceType::INSTANCE, instance)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -97,18 +176,17 @@ namespace exqudens::vulkan {
       PhysicalDevice createPhysicalDevice(
           VkInstance& instance,
           Configuration& configuration,
-          const VkSurfaceKHR& surface
+          const VkSurfaceKHR& surface,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = physicalDeviceId++;
           PhysicalDevice value = PhysicalDeviceFactoryBase::createPhysicalDevice(
               instance,
               configuration,
-              surface
+              surface,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          physicalDevices[key] = value;
+          registerValue(physicalDeviceMutex, physicalDevices, value, location, {resourceHandle(ResourceType::INSTANCE, instance)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -118,18 +196,24 @@ namespace exqudens::vulkan {
       Device createDevice(
           VkPhysicalDevice& physicalDevice,
           Configuration& configuration,
-          QueueFamilyIndexInfo& queueFamilyIndexInfo
+          QueueFamilyIndexInfo& queueFamilyIndexInfo,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = deviceId++;
           Device value = DeviceFactoryBase::createDevice(
               physicalDevice,
               configuration,
-              queueFamilyIndexInfo
+              queueFamilyIndexInfo,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          devices[key] = value;
+          registerValue(deviceMutex, devices, value, location, {resourceHandle(ResourceType::PHYSICAL_DEVICE, physicalDevice)});
+          updateFunctions();
+          // pipelines are linked from cached parts only on a device with the extension, otherwise created whole
+          for (const char* extension : configuration.deviceExtensions) {
+            if (std::string(extension) == VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) {
+              setGraphicsPipelineLibraryEnabled(true, true);
+            }
+          }
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -140,19 +224,18 @@ namespace exqudens::vulkan {
           VkPhysicalDevice& physicalDevice,
           VkDevice& device,
           const BufferCreateInfo& createInfo,
-          VkMemoryPropertyFlags properties
+          VkMemoryPropertyFlags properties,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = bufferId++;
           Buffer value = BufferFactoryBase::createBuffer(
               physicalDevice,
               device,
               createInfo,
-              properties
+              properties,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          buffers[key] = value;
+          registerValue(bufferMutex, buffers, value, location, {resourceHandle(ResourceType::DEVICE, device)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -163,19 +246,18 @@ namespace exqudens::vulkan {
           VkPhysicalDevice& physicalDevice,
           VkDevice& device,
           const ImageCreateInfo& createInfo,
-          VkMemoryPropertyFlags properties
+          VkMemoryPropertyFlags properties,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = imageId++;
           Image value = ImageFactoryBase::createImage(
               physicalDevice,
               device,
               createInfo,
-              properties
+              properties,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          images[key] = value;
+          registerValue(imageMutex, images, value, location, {resourceHandle(ResourceType::DEVICE, device)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -184,21 +266,19 @@ namespace exqudens::vulkan {
 
       ImageView createImageView(
           VkDevice& device,
-          VkImage& image,
-          VkFormat format,
-          VkImageAspectFlags aspectMask
+          const VkImageViewCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = imageViewId++;
           ImageView value = ImageViewFactoryBase::createImageView(
               device,
-              image,
-              format,
-              aspectMask
+              createInfo,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          imageViews[key] = value;
+          registerValue(imageViewMutex, imageViews, value, location, {
+              resourceHandle(ResourceType::DEVICE, device),
+              resourceHandle(ResourceType::IMAGE, createInfo.image)
+          });
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -206,20 +286,17 @@ namespace exqudens::vulkan {
       }
 
       Sampler createSampler(
-          VkPhysicalDevice& physicalDevice,
           VkDevice& device,
-          bool anisotropyEnable
+          const VkSamplerCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = samplerId++;
           Sampler value = SamplerFactoryBase::createSampler(
-              physicalDevice,
               device,
-              anisotropyEnable
+              createInfo,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          samplers[key] = value;
+          registerValue(samplerMutex, samplers, value, location, {resourceHandle(ResourceType::DEVICE, device)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -228,17 +305,16 @@ namespace exqudens::vulkan {
 
       RenderPass createRenderPass(
           VkDevice& device,
-          const RenderPassCreateInfo& createInfo
+          const RenderPassCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = renderPassId++;
           RenderPass value = RenderPassFactoryBase::createRenderPass(
               device,
-              createInfo
+              createInfo,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          renderPasses[key] = value;
+          registerValue(renderPassMutex, renderPasses, value, location, {resourceHandle(ResourceType::DEVICE, device)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -247,17 +323,16 @@ namespace exqudens::vulkan {
 
       DescriptorSetLayout createDescriptorSetLayout(
           VkDevice& device,
-          const DescriptorSetLayoutCreateInfo& createInfo
+          const DescriptorSetLayoutCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = descriptorSetLayoutId++;
           DescriptorSetLayout value = DescriptorSetLayoutFactoryBase::createDescriptorSetLayout(
               device,
-              createInfo
+              createInfo,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          descriptorSetLayouts[key] = value;
+          registerValue(descriptorSetLayoutMutex, descriptorSetLayouts, value, location, {resourceHandle(ResourceType::DEVICE, device)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -266,40 +341,170 @@ namespace exqudens::vulkan {
 
       DescriptorPool createDescriptorPool(
           VkDevice& device,
-          const DescriptorPoolCreateInfo& createInfo
+          const DescriptorPoolCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = descriptorPoolId++;
           DescriptorPool value = DescriptorPoolFactoryBase::createDescriptorPool(
               device,
-              createInfo
+              createInfo,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          descriptorPools[key] = value;
+          registerValue(descriptorPoolMutex, descriptorPools, value, location, {resourceHandle(ResourceType::DEVICE, device)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
-      DescriptorSet createDescriptorSet(
+      std::vector<DescriptorSet> createDescriptorSets(
           VkDevice& device,
           VkDescriptorPool& descriptorPool,
-          VkDescriptorSetLayout& descriptorSetLayout,
-          const std::vector<WriteDescriptorSet>& writeDescriptorSets
+          const std::vector<VkDescriptorSetLayout>& descriptorSetLayouts,
+          const std::vector<std::vector<WriteDescriptorSet>>& writeDescriptorSets,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = descriptorSetId++;
-          DescriptorSet value = DescriptorSetFactoryBase::createDescriptorSet(
+          std::vector<DescriptorSet> values = DescriptorSetFactoryBase::createDescriptorSets(
               device,
               descriptorPool,
-              descriptorSetLayout,
+              descriptorSetLayouts,
+              writeDescriptorSets,
+              location
+          );
+          for (DescriptorSet& value : values) {
+            registerValue(descriptorSetMutex, descriptorSets, value, location, {
+                resourceHandle(ResourceType::DEVICE, device),
+                resourceHandle(ResourceType::DESCRIPTOR_POOL, descriptorPool)
+            });
+          }
+          return values;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      DescriptorAllocator createDescriptorAllocator(
+          VkDevice& device,
+          const DescriptorPoolCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          DescriptorAllocator value = DescriptorAllocatorFactoryBase::createDescriptorAllocator(
+              device,
+              createInfo,
+              location
+          );
+          registerValue(descriptorAllocatorMutex, descriptorAllocators, value, location, {resourceHandle(ResourceType::DEVICE, device)});
+          return value;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      std::vector<DescriptorSet> allocateDescriptorSets(
+          DescriptorAllocator& descriptorAllocator,
+          const std::vector<VkDescriptorSetLayout>& descriptorSetLayouts,
+          const std::vector<std::vector<WriteDescriptorSet>>& writeDescriptorSets
+      ) override {
+        try {
+          std::vector<DescriptorSet> values = DescriptorAllocatorFactoryBase::allocateDescriptorSets(
+              descriptorAllocator,
+              descriptorSetLayouts,
               writeDescriptorSets
           );
-          value.id = key;
-          value.destroyed = false;
-          descriptorSets[key] = value;
+          // pools change on allocation, the registry keeps the latest copy for destroy()
+          updateValue(descriptorAllocatorMutex, descriptorAllocators, descriptorAllocator);
+          return values;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void resetDescriptorAllocator(DescriptorAllocator& descriptorAllocator) override {
+        try {
+          DescriptorAllocatorFactoryBase::resetDescriptorAllocator(descriptorAllocator);
+          updateValue(descriptorAllocatorMutex, descriptorAllocators, descriptorAllocator);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      DescriptorUpdateTemplate createDescriptorUpdateTemplate(
+          VkDevice& device,
+          VkDescriptorSetLayout& descriptorSetLayout,
+          const DescriptorSetLayoutCreateInfo& descriptorSetLayoutCreateInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          DescriptorUpdateTemplate value = DescriptorUpdateTemplateFactoryBase::createDescriptorUpdateTemplate(
+              device,
+              descriptorSetLayout,
+              descriptorSetLayoutCreateInfo,
+              location
+          );
+          registerValue(descriptorUpdateTemplateMutex, descriptorUpdateTemplates, value, location, {
+              resourceHandle(ResourceType::DEVICE, device),
+              resourceHandle(ResourceType::DESCRIPTOR_SET_LAYOUT, descriptorSetLayout)
+          });
+          return value;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      BindlessTable createBindlessTable(
+          VkDevice& device,
+          uint32_t capacity,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          BindlessTable value = BindlessTableFactoryBase::createBindlessTable(device, capacity, location);
+          registerValue(bindlessTableMutex, bindlessTables, value, location, {resourceHandle(ResourceType::DEVICE, device)});
+          return value;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      uint32_t registerTexture(BindlessTable& bindlessTable, VkImageView& imageView, VkSampler& sampler) override {
+        try {
+          uint32_t slot = BindlessTableFactoryBase::registerTexture(bindlessTable, imageView, sampler);
+          updateValue(bindlessTableMutex, bindlessTables, bindlessTable);
+          return slot;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void unregisterTexture(BindlessTable& bindlessTable, uint32_t slot) override {
+        try {
+          BindlessTableFactoryBase::unregisterTexture(bindlessTable, slot);
+          updateValue(bindlessTableMutex, bindlessTables, bindlessTable);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // the other overloads forward to the one below and must stay callable on the context
+      using ComputePipelineFactoryBase::createComputePipeline;
+
+      Pipeline createComputePipeline(
+          VkDevice& device,
+          const std::string& shaderPath,
+          const SpecializationInfo& specializationInfo,
+          const PipelineLayoutCreateInfo& layoutCreateInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          Pipeline value = ComputePipelineFactoryBase::createComputePipeline(
+              device,
+              shaderPath,
+              specializationInfo,
+              layoutCreateInfo,
+              location
+          );
+          registerValue(pipelineMutex, pipelines, value, location, {resourceHandle(ResourceType::DEVICE, device)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -309,24 +514,25 @@ namespace exqudens::vulkan {
       Pipeline createPipeline(
           VkDevice& device,
           const std::vector<std::string>& shaderPaths,
+          const std::map<VkShaderStageFlagBits, SpecializationInfo>& specializationInfos,
           const std::vector<VkVertexInputBindingDescription>& vertexBindingDescriptions,
           const std::vector<VkVertexInputAttributeDescription>& vertexAttributeDescriptions,
           const PipelineLayoutCreateInfo& layoutCreateInfo,
-          const GraphicsPipelineCreateInfo& createInfo
+          const GraphicsPipelineCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = pipelineId++;
           Pipeline value = PipelineFactoryBase::createPipeline(
               device,
               shaderPaths,
+              specializationInfos,
               vertexBindingDescriptions,
               vertexAttributeDescriptions,
               layoutCreateInfo,
-              createInfo
+              createInfo,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          pipelines[key] = value;
+          registerValue(pipelineMutex, pipelines, value, location, {resourceHandle(ResourceType::DEVICE, device)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -335,17 +541,23 @@ namespace exqudens::vulkan {
 
       FrameBuffer createFrameBuffer(
           VkDevice& device,
-          const FrameBufferCreateInfo& createInfo
+          const FrameBufferCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = frameBufferId++;
           FrameBuffer value = FrameBufferFactoryBase::createFrameBuffer(
               device,
-              createInfo
+              createInfo,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          frameBuffers[key] = value;
+          std::vector<ResourceHandle> parents = {
+              resourceHandle(ResourceType::DEVICE, device),
+              resourceHandle(ResourceType::RENDER_PASS, createInfo.renderPass)
+          };
+          for (const VkImageView& attachment : createInfo.attachments) {
+            parents.emplace_back(resourceHandle(ResourceType::IMAGE_VIEW, attachment));
+          }
+          registerValue(frameBufferMutex, frameBuffers, value, location, parents);
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -353,16 +565,15 @@ namespace exqudens::vulkan {
       }
 
       Surface createSurface(
-          VkInstance& instance
+          VkInstance& instance,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = surfaceId++;
           Surface value = SurfaceFactoryBase::createSurface(
-                  instance
+              instance,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          surfaces[key] = value;
+          registerValue(surfaceMutex, surfaces, value, location, {resourceHandle(ResourceType::INSTANCE, instance)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -375,42 +586,93 @@ namespace exqudens::vulkan {
           VkSurfaceKHR& surface,
           VkDevice& device,
           const uint32_t& width,
-          const uint32_t& height
+          const uint32_t& height,
+          VkSwapchainKHR& oldSwapChain,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = swapChainId++;
           SwapChain value = SwapChainFactoryBase::createSwapChain(
               swapChainSupport,
               queueFamilyIndexInfo,
               surface,
               device,
               width,
-              height
+              height,
+              oldSwapChain,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          swapChains[key] = value;
+          registerValue(swapChainMutex, swapChains, value, location, {
+              resourceHandle(ResourceType::DEVICE, device),
+              resourceHandle(ResourceType::SURFACE, surface)
+          });
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
+      SwapChain recreateSwapChain(
+          SwapChain& oldSwapChain,
+          SwapChainSupportDetails& swapChainSupport,
+          QueueFamilyIndexInfo& queueFamilyIndexInfo,
+          VkSurfaceKHR& surface,
+          const uint32_t& width,
+          const uint32_t& height,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          checkValue(swapChainMutex, swapChains, oldSwapChain);
+          SwapChain value = SwapChainFactoryBase::recreateSwapChain(
+              oldSwapChain,
+              swapChainSupport,
+              queueFamilyIndexInfo,
+              surface,
+              width,
+              height,
+              location
+          );
+          // the old chain is owned by the retired list from now on
+          eraseValue(swapChainMutex, swapChains, oldSwapChain);
+          return value;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      std::vector<Image> createSwapChainImages(VkDevice& device, VkSwapchainKHR& swapChain) override {
+        try {
+          std::vector<Image> values = SwapChainFactoryBase::createSwapChainImages(device, swapChain);
+          // the images belong to the chain, views made from them become dependents of the chain itself
+          std::lock_guard<std::mutex> lock(dependencyMutex);
+          auto swapChainKeys = handleResources.find(resourceHandle(ResourceType::SWAP_CHAIN, swapChain));
+          if (swapChainKeys != handleResources.end()) {
+            ResourceKey key = swapChainKeys->second.back();
+            for (const Image& value : values) {
+              ResourceHandle handle = resourceHandle(ResourceType::IMAGE, value.value);
+              handleResources[handle].emplace_back(key);
+              resourceHandles[key].emplace_back(handle);
+            }
+          }
+          return values;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
       Queue createQueue(
           VkDevice& device,
           uint32_t queueFamilyIndex,
-          uint32_t queueIndex
+          uint32_t queueIndex,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = queueId++;
           Queue value = QueueFactoryBase::createQueue(
               device,
               queueFamilyIndex,
-              queueIndex
+              queueIndex,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          queues[key] = value;
+          registerValue(queueMutex, queues, value, location, {resourceHandle(ResourceType::DEVICE, device)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -420,18 +682,17 @@ namespace exqudens::vulkan {
       CommandPool createCommandPool(
           VkDevice& device,
           uint32_t queueFamilyIndex,
-          VkCommandPoolCreateFlags flags
+          VkCommandPoolCreateFlags flags,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = commandPoolId++;
           CommandPool value = CommandPoolFactoryBase::createCommandPool(
               device,
               queueFamilyIndex,
-              flags
+              flags,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          commandPools[key] = value;
+          registerValue(commandPoolMutex, commandPools, value, location, {resourceHandle(ResourceType::DEVICE, device)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -440,17 +701,19 @@ namespace exqudens::vulkan {
 
       CommandBuffer createCommandBuffer(
           VkDevice& device,
-          VkCommandPool& commandPool
+          VkCommandPool& commandPool,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = commandBufferId++;
           CommandBuffer value = CommandBufferFactoryBase::createCommandBuffer(
               device,
-              commandPool
+              commandPool,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          commandBuffers[key] = value;
+          registerValue(commandBufferMutex, commandBuffers, value, location, {
+              resourceHandle(ResourceType::DEVICE, device),
+              resourceHandle(ResourceType::COMMAND_POOL, commandPool)
+          });
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -459,17 +722,16 @@ namespace exqudens::vulkan {
 
       Semaphore createSemaphore(
           VkDevice& device,
-          VkSemaphoreCreateFlags flags
+          VkSemaphoreCreateFlags flags,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = semaphoreId++;
           Semaphore value = SemaphoreFactoryBase::createSemaphore(
               device,
-              flags
+              flags,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          semaphores[key] = value;
+          registerValue(semaphoreMutex, semaphores, value, location, {resourceHandle(ResourceType::DEVICE, device)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -478,17 +740,16 @@ namespace exqudens::vulkan {
 
       Fence createFence(
           VkDevice& device,
-          VkFenceCreateFlags flags
+          VkFenceCreateFlags flags,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          unsigned int key = fenceId++;
           Fence value = FenceFactoryBase::createFence(
               device,
-              flags
+              flags,
+              location
           );
-          value.id = key;
-          value.destroyed = false;
-          fences[key] = value;
+          registerValue(fenceMutex, fences, value, location, {resourceHandle(ResourceType::DEVICE, device)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -499,8 +760,10 @@ namespace exqudens::vulkan {
 
       void destroyInstance(Instance& instance) override {
         try {
+          checkValue(instanceMutex, instances, instance);
           InstanceFactoryBase::destroyInstance(instance);
-          instances[instance.id].destroyed = true;
+          eraseValue(instanceMutex, instances, instance);
+          updateFunctions();
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -508,8 +771,9 @@ namespace exqudens::vulkan {
 
       void destroyDebugUtilsMessenger(DebugUtilsMessenger& debugUtilsMessenger) override {
         try {
+          checkValue(debugUtilsMessengerMutex, debugUtilsMessengers, debugUtilsMessenger);
           DebugUtilsMessengerFactoryBase::destroyDebugUtilsMessenger(debugUtilsMessenger);
-          debugUtilsMessengers[debugUtilsMessenger.id].destroyed = true;
+          eraseValue(debugUtilsMessengerMutex, debugUtilsMessengers, debugUtilsMessenger);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -517,8 +781,9 @@ namespace exqudens::vulkan {
 
       void destroyPhysicalDevice(PhysicalDevice& physicalDevice) override {
         try {
+          checkValue(physicalDeviceMutex, physicalDevices, physicalDevice);
           PhysicalDeviceFactoryBase::destroyPhysicalDevice(physicalDevice);
-          physicalDevices[physicalDevice.id].destroyed = true;
+          eraseValue(physicalDeviceMutex, physicalDevices, physicalDevice);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -526,8 +791,10 @@ namespace exqudens::vulkan {
 
       void destroyDevice(Device& device) override {
         try {
+          checkValue(deviceMutex, devices, device);
           DeviceFactoryBase::destroyDevice(device);
-          devices[device.id].destroyed = true;
+          eraseValue(deviceMutex, devices, device);
+          updateFunctions();
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -535,8 +802,9 @@ namespace exqudens::vulkan {
 
       void destroyBuffer(Buffer& buffer) override {
         try {
+          checkValue(bufferMutex, buffers, buffer);
           BufferFactoryBase::destroyBuffer(buffer);
-          buffers[buffer.id].destroyed = true;
+          eraseValue(bufferMutex, buffers, buffer);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -544,8 +812,9 @@ namespace exqudens::vulkan {
 
       void destroyImage(Image& image) override {
         try {
+          checkValue(imageMutex, images, image);
           ImageFactoryBase::destroyImage(image);
-          images[image.id].destroyed = true;
+          eraseValue(imageMutex, images, image);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -553,8 +822,9 @@ namespace exqudens::vulkan {
 
       void destroyImageView(ImageView& imageView) override {
         try {
+          checkValue(imageViewMutex, imageViews, imageView);
           ImageViewFactoryBase::destroyImageView(imageView);
-          imageViews[imageView.id].destroyed = true;
+          eraseValue(imageViewMutex, imageViews, imageView);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -562,8 +832,9 @@ namespace exqudens::vulkan {
 
       void destroySampler(Sampler& sampler) override {
         try {
+          checkValue(samplerMutex, samplers, sampler);
           SamplerFactoryBase::destroySampler(sampler);
-          samplers[sampler.id].destroyed = true;
+          eraseValue(samplerMutex, samplers, sampler);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -571,8 +842,9 @@ namespace exqudens::vulkan {
 
       void destroyRenderPass(RenderPass& renderPass) override {
         try {
+          checkValue(renderPassMutex, renderPasses, renderPass);
           RenderPassFactoryBase::destroyRenderPass(renderPass);
-          renderPasses[renderPass.id].destroyed = true;
+          eraseValue(renderPassMutex, renderPasses, renderPass);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -580,8 +852,9 @@ namespace exqudens::vulkan {
 
       void destroyDescriptorSetLayout(DescriptorSetLayout& descriptorSetLayout) override {
         try {
+          checkValue(descriptorSetLayoutMutex, descriptorSetLayouts, descriptorSetLayout);
           DescriptorSetLayoutFactoryBase::destroyDescriptorSetLayout(descriptorSetLayout);
-          descriptorSetLayouts[descriptorSetLayout.id].destroyed = true;
+          eraseValue(descriptorSetLayoutMutex, descriptorSetLayouts, descriptorSetLayout);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -589,8 +862,39 @@ namespace exqudens::vulkan {
 
       void destroyDescriptorPool(DescriptorPool& descriptorPool) override {
         try {
+          checkValue(descriptorPoolMutex, descriptorPools, descriptorPool);
           DescriptorPoolFactoryBase::destroyDescriptorPool(descriptorPool);
-          descriptorPools[descriptorPool.id].destroyed = true;
+          eraseValue(descriptorPoolMutex, descriptorPools, descriptorPool);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void destroyDescriptorUpdateTemplate(DescriptorUpdateTemplate& descriptorUpdateTemplate) override {
+        try {
+          checkValue(descriptorUpdateTemplateMutex, descriptorUpdateTemplates, descriptorUpdateTemplate);
+          DescriptorUpdateTemplateFactoryBase::destroyDescriptorUpdateTemplate(descriptorUpdateTemplate);
+          eraseValue(descriptorUpdateTemplateMutex, descriptorUpdateTemplates, descriptorUpdateTemplate);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void destroyBindlessTable(BindlessTable& bindlessTable) override {
+        try {
+          checkValue(bindlessTableMutex, bindlessTables, bindlessTable);
+          BindlessTableFactoryBase::destroyBindlessTable(bindlessTable);
+          eraseValue(bindlessTableMutex, bindlessTables, bindlessTable);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void destroyDescriptorAllocator(DescriptorAllocator& descriptorAllocator) override {
+        try {
+          checkValue(descriptorAllocatorMutex, descriptorAllocators, descriptorAllocator);
+          DescriptorAllocatorFactoryBase::destroyDescriptorAllocator(descriptorAllocator);
+          eraseValue(descriptorAllocatorMutex, descriptorAllocators, descriptorAllocator);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -598,8 +902,9 @@ namespace exqudens::vulkan {
 
       void destroyDescriptorSet(DescriptorSet& descriptorSet) override {
         try {
+          checkValue(descriptorSetMutex, descriptorSets, descriptorSet);
           DescriptorSetFactoryBase::destroyDescriptorSet(descriptorSet);
-          descriptorSets[descriptorSet.id].destroyed = true;
+          eraseValue(descriptorSetMutex, descriptorSets, descriptorSet);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -607,8 +912,9 @@ namespace exqudens::vulkan {
 
       void destroyPipeline(Pipeline& pipeline) override {
         try {
+          checkValue(pipelineMutex, pipelines, pipeline);
           PipelineFactoryBase::destroyPipeline(pipeline);
-          pipelines[pipeline.id].destroyed = true;
+          eraseValue(pipelineMutex, pipelines, pipeline);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -616,8 +922,9 @@ namespace exqudens::vulkan {
 
       void destroyFrameBuffer(FrameBuffer& frameBuffer) override {
         try {
+          checkValue(frameBufferMutex, frameBuffers, frameBuffer);
           FrameBufferFactoryBase::destroyFrameBuffer(frameBuffer);
-          frameBuffers[frameBuffer.id].destroyed = true;
+          eraseValue(frameBufferMutex, frameBuffers, frameBuffer);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -625,8 +932,9 @@ namespace exqudens::vulkan {
 
       void destroySurface(Surface& surface) override {
         try {
+          checkValue(surfaceMutex, surfaces, surface);
           SurfaceFactoryBase::destroySurface(surface);
-          surfaces[surface.id].destroyed = true;
+          eraseValue(surfaceMutex, surfaces, surface);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -634,8 +942,9 @@ namespace exqudens::vulkan {
 
       void destroySwapChain(SwapChain& swapChain) override {
         try {
+          checkValue(swapChainMutex, swapChains, swapChain);
           SwapChainFactoryBase::destroySwapChain(swapChain);
-          swapChains[swapChain.id].destroyed = true;
+          eraseValue(swapChainMutex, swapChains, swapChain);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -643,8 +952,9 @@ namespace exqudens::vulkan {
 
       void destroyQueue(Queue& queue) override {
         try {
+          checkValue(queueMutex, queues, queue);
           QueueFactoryBase::destroyQueue(queue);
-          queues[queue.id].destroyed = true;
+          eraseValue(queueMutex, queues, queue);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -652,8 +962,9 @@ namespace exqudens::vulkan {
 
       void destroyCommandPool(CommandPool& commandPool) override {
         try {
+          checkValue(commandPoolMutex, commandPools, commandPool);
           CommandPoolFactoryBase::destroyCommandPool(commandPool);
-          commandPools[commandPool.id].destroyed = true;
+          eraseValue(commandPoolMutex, commandPools, commandPool);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -661,8 +972,9 @@ namespace exqudens::vulkan {
 
       void destroyCommandBuffer(CommandBuffer& commandBuffer) override {
         try {
+          checkValue(commandBufferMutex, commandBuffers, commandBuffer);
           CommandBufferFactoryBase::destroyCommandBuffer(commandBuffer);
-          commandBuffers[commandBuffer.id].destroyed = true;
+          eraseValue(commandBufferMutex, commandBuffers, commandBuffer);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -670,8 +982,9 @@ namespace exqudens::vulkan {
 
       void destroySemaphore(Semaphore& semaphore) override {
         try {
+          checkValue(semaphoreMutex, semaphores, semaphore);
           SemaphoreFactoryBase::destroySemaphore(semaphore);
-          semaphores[semaphore.id].destroyed = true;
+          eraseValue(semaphoreMutex, semaphores, semaphore);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -679,155 +992,682 @@ namespace exqudens::vulkan {
 
       void destroyFence(Fence& fence) override {
         try {
+          checkValue(fenceMutex, fences, fence);
           FenceFactoryBase::destroyFence(fence);
-          fences[fence.id].destroyed = true;
+          eraseValue(fenceMutex, fences, fence);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
-      Surface add(const Surface& surface) override {
+      Surface add(
+          const Surface& surface,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
-          unsigned int key = surfaceId++;
           Surface value = surface;
-          value.id = key;
-          value.destroyed = false;
-          surfaces[key] = value;
+          registerValue(surfaceMutex, surfaces, value, location, {resourceHandle(ResourceType::INSTANCE, value.instance)});
           return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
-      void destroy() override {
+      void destroyWithDependents(const ResourceKey& key) override {
         try {
-          // destroy fences
-          for (auto& [key, value] : fences) {
-            if (!value.destroyed) destroyFence(value);
-          }
-          fences.clear();
+          destroyResources(collectDependents({key}));
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          // destroy semaphores
-          for (auto& [key, value] : semaphores) {
-            if (!value.destroyed) destroySemaphore(value);
-          }
-          semaphores.clear();
+      uint64_t beginScope() override {
+        try {
+          std::lock_guard<std::mutex> lock(scopeMutex);
+          Scope& scope = scopes[std::this_thread::get_id()].emplace_back(Scope {.id = nextScopeId++, .keys = {}});
+          return scope.id;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          // destroy commandBuffers
-          for (auto& [key, value] : commandBuffers) {
-            if (!value.destroyed) destroyCommandBuffer(value);
+      void endScope(uint64_t scope) override {
+        try {
+          std::vector<ResourceKey> scopeKeys = {};
+          {
+            std::lock_guard<std::mutex> lock(scopeMutex);
+            auto threadScopes = scopes.find(std::this_thread::get_id());
+            if (threadScopes == scopes.end() || threadScopes->second.back().id != scope) {
+              throw std::runtime_error(CALL_INFO() + ": failed to end scope that is not the innermost open one of this thread: " + std::to_string(scope) + "!");
+            }
+            scopeKeys = std::move(threadScopes->second.back().keys);
+            threadScopes->second.pop_back();
+            if (threadScopes->second.empty()) {
+              scopes.erase(threadScopes);
+            }
           }
-          commandBuffers.clear();
+          std::erase_if(scopeKeys, [this](const ResourceKey& key) { return !containsResource(key); });
+          // values created later from the scope ones go with them
+          destroyResources(collectDependents(scopeKeys));
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          // destroy commandPools
-          for (auto& [key, value] : commandPools) {
-            if (!value.destroyed) destroyCommandPool(value);
+      std::vector<ResourceStatistics> getResourceStatistics() override {
+        try {
+          std::lock_guard<std::mutex> lock(statisticsMutex);
+          std::vector<ResourceStatistics> values;
+          for (const auto& [type, value] : resourceStatistics) {
+            values.emplace_back(value);
           }
-          commandPools.clear();
+          return values;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          // destroy queues
-          for (auto& [key, value] : queues) {
-            if (!value.destroyed) destroyQueue(value);
-          }
-          queues.clear();
+      std::vector<ResourceStatistics> getResourceLeaks() override {
+        try {
+          std::lock_guard<std::mutex> lock(statisticsMutex);
+          return resourceLeaks;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          // destroy swapChains
-          for (auto& [key, value] : swapChains) {
-            if (!value.destroyed) destroySwapChain(value);
+      void writeResourceStatistics(std::ostream& stream) override {
+        try {
+          std::vector<ResourceStatistics> values = getResourceStatistics();
+          stream << "{\n  \"resources\": [";
+          for (std::size_t i = 0; i < values.size(); i++) {
+            const ResourceStatistics& value = values[i];
+            stream << (i == 0 ? "\n" : ",\n");
+            stream << "    {";
+            stream << "\"name\": \"" << value.name << "\", ";
+            stream << "\"liveCount\": " << value.liveCount << ", ";
+            stream << "\"peakCount\": " << value.peakCount << ", ";
+            stream << "\"createdCount\": " << value.createdCount << ", ";
+            stream << "\"memorySize\": " << value.memorySize << ", ";
+            stream << "\"peakMemorySize\": " << value.peakMemorySize << ", ";
+            stream << "\"sites\": [";
+            bool first = true;
+            for (const auto& [site, count] : value.sites) {
+              stream << (first ? "" : ", ");
+              stream << "{\"site\": \"" << escapeJson(site) << "\", \"liveCount\": " << count << "}";
+              first = false;
+            }
+            stream << "]}";
           }
-          swapChains.clear();
+          stream << (values.empty() ? "]\n}\n" : "\n  ]\n}\n");
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          // destroy surfaces
-          for (auto& [key, value] : surfaces) {
-            if (!value.destroyed) destroySurface(value);
+      void destroy() override {
+        try {
+          {
+            // everything still alive here was left for destroy() to clean up
+            std::lock_guard<std::mutex> lock(statisticsMutex);
+            resourceLeaks.clear();
+            for (const auto& [type, value] : resourceStatistics) {
+              if (value.liveCount > 0) {
+                resourceLeaks.emplace_back(value);
+              }
+            }
           }
-          surfaces.clear();
 
-          // destroy frameBuffers
-          for (auto& [key, value] : frameBuffers) {
-            if (!value.destroyed) destroyFrameBuffer(value);
+          std::set<ResourceKey> keys = {};
+          forEachRegistry([&keys](ResourceType type, std::mutex& mutex, auto& registry, auto) {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (std::size_t i = 0; i < registry.size(); i++) {
+              keys.insert({.type = type, .id = registry.handle(i)});
+            }
+          });
+
+          // surfaces, devices and instances outlive the retired swap chains and pipeline libraries
+          std::set<ResourceKey> rootKeys = {};
+          for (auto it = keys.begin(); it != keys.end();) {
+            if (isRootResource(it->type)) {
+              rootKeys.insert(*it);
+              it = keys.erase(it);
+            } else {
+              it++;
+            }
           }
-          frameBuffers.clear();
 
-          // destroy pipelines
-          for (auto& [key, value] : pipelines) {
-            if (!value.destroyed) destroyPipeline(value);
+          destroyResources(keys);
+          destroyRetiredSwapChains();
+          destroyPipelineLibraries();
+          destroyResources(rootKeys);
+
+          std::lock_guard<std::mutex> lock(scopeMutex);
+          scopes.clear();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+    protected:
+
+      // the shared table takes the raw entry points of the live instance and device,
+      // with more than one of them alive it falls back to the loader trampolines
+      void updateFunctions() {
+        try {
+          resetFunctions();
+          if (instances.size() == 1) {
+            setInstanceFunctions(instances.back().functions);
+          }
+          if (devices.size() == 1) {
+            setDeviceFunctions(devices.back().functions);
           }
-          pipelines.clear();
+          // rebuilt here, while externally synchronized, so concurrent calls only read the table
+          functions();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          // destroy descriptorSets
-          for (auto& [key, value] : descriptorSets) {
-            if (!value.destroyed) destroyDescriptorSet(value);
+      std::set<ResourceKey> collectDependents(const std::vector<ResourceKey>& roots) {
+        std::set<ResourceKey> keys = {};
+        std::lock_guard<std::mutex> lock(dependencyMutex);
+        std::vector<ResourceKey> pending = roots;
+        while (!pending.empty()) {
+          ResourceKey current = pending.back();
+          pending.pop_back();
+          if (!keys.insert(current).second) {
+            continue;
           }
-          descriptorSets.clear();
+          auto dependents = resourceDependents.find(current);
+          if (dependents != resourceDependents.end()) {
+            pending.insert(pending.end(), dependents->second.begin(), dependents->second.end());
+          }
+        }
+        return keys;
+      }
 
-          // destroy descriptorPools
-          for (auto& [key, value] : descriptorPools) {
-            if (!value.destroyed) destroyDescriptorPool(value);
+      // destroys the given values level by level, a level holds values whose dependents are all gone.
+      // within a level the values are independent and go to worker threads, except for:
+      // - descriptor sets and command buffers, kept on one thread per pool since the pool is externally synchronized,
+      //   or only dropped from the registry when their pool is destroyed in the same batch
+      // - devices and instances, which rebuild the shared functions table
+      void destroyResources(const std::set<ResourceKey>& keys) {
+        try {
+          std::map<ResourceKey, std::vector<ResourceKey>> dependents = {};
+          std::map<ResourceKey, ResourceKey> pools = {};
+          {
+            std::lock_guard<std::mutex> lock(dependencyMutex);
+            for (const ResourceKey& key : keys) {
+              auto keyDependents = resourceDependents.find(key);
+              if (keyDependents != resourceDependents.end()) {
+                for (const ResourceKey& dependent : keyDependents->second) {
+                  if (keys.contains(dependent)) {
+                    dependents[key].emplace_back(dependent);
+                  }
+                }
+              }
+              auto keyDependencies = resourceDependencies.find(key);
+              if (keyDependencies != resourceDependencies.end()) {
+                for (const ResourceKey& dependency : keyDependencies->second) {
+                  if (
+                      (key.type == ResourceType::DESCRIPTOR_SET && dependency.type == ResourceType::DESCRIPTOR_POOL)
+                      || (key.type == ResourceType::COMMAND_BUFFER && dependency.type == ResourceType::COMMAND_POOL)
+                  ) {
+                    pools[key] = dependency;
+                  }
+                }
+              }
+            }
           }
-          descriptorPools.clear();
 
-          // destroy descriptorSetLayouts
-          for (auto& [key, value] : descriptorSetLayouts) {
-            if (!value.destroyed) destroyDescriptorSetLayout(value);
+          std::map<ResourceKey, std::size_t> heights = {};
+          std::function<std::size_t(const ResourceKey&)> height = [&dependents, &heights, &height](const ResourceKey& key) {
+            auto known = heights.find(key);
+            if (known != heights.end()) {
+              return known->second;
+            }
+            std::size_t value = 0;
+            auto keyDependents = dependents.find(key);
+            if (keyDependents != dependents.end()) {
+              for (const ResourceKey& dependent : keyDependents->second) {
+                value = std::max(value, height(dependent) + 1);
+              }
+            }
+            heights[key] = value;
+            return value;
+          };
+
+          std::vector<std::vector<ResourceKey>> levels = {};
+          for (const ResourceKey& key : keys) {
+            std::size_t level = height(key);
+            if (levels.size() <= level) {
+              levels.resize(level + 1);
+            }
+            levels[level].emplace_back(key);
           }
-          descriptorSetLayouts.clear();
 
-          // destroy renderPasses
-          for (auto& [key, value] : renderPasses) {
-            if (!value.destroyed) destroyRenderPass(value);
+          for (const std::vector<ResourceKey>& level : levels) {
+            std::vector<std::vector<ResourceKey>> jobs = {};
+            std::map<ResourceKey, std::vector<ResourceKey>> poolJobs = {};
+            std::vector<ResourceKey> serial = {};
+            std::vector<ResourceKey> released = {};
+            for (const ResourceKey& key : level) {
+              if (key.type == ResourceType::DEVICE || key.type == ResourceType::INSTANCE) {
+                serial.emplace_back(key);
+              } else if (pools.contains(key) && keys.contains(pools.at(key))) {
+                released.emplace_back(key);
+              } else if (pools.contains(key)) {
+                poolJobs[pools.at(key)].emplace_back(key);
+              } else {
+                jobs.emplace_back(std::vector<ResourceKey> {key});
+              }
+            }
+            for (auto& [pool, job] : poolJobs) {
+              jobs.emplace_back(std::move(job));
+            }
+            for (const ResourceKey& key : released) {
+              releaseResource(key);
+            }
+            runDestroyJobs(jobs);
+            for (const ResourceKey& key : serial) {
+              destroyResource(key);
+            }
           }
-          renderPasses.clear();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          // destroy samplers
-          for (auto& [key, value] : samplers) {
-            if (!value.destroyed) destroySampler(value);
+      // every worker pulls the next job until none are left, the first failure is rethrown once all workers stop
+      void runDestroyJobs(const std::vector<std::vector<ResourceKey>>& jobs) {
+        try {
+          if (jobs.size() < PARALLEL_DESTROY_MIN_JOBS) {
+            for (const std::vector<ResourceKey>& job : jobs) {
+              for (const ResourceKey& key : job) {
+                destroyResource(key);
+              }
+            }
+            return;
           }
-          samplers.clear();
 
-          // destroy imageViews
-          for (auto& [key, value] : imageViews) {
-            if (!value.destroyed) destroyImageView(value);
+          std::size_t workerCount = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u), jobs.size());
+          std::atomic<std::size_t> next = 0;
+          std::vector<std::future<void>> workers = {};
+          for (std::size_t i = 0; i < workerCount; i++) {
+            workers.emplace_back(std::async(std::launch::async, [this, &jobs, &next]() {
+              for (std::size_t index = next++; index < jobs.size(); index = next++) {
+                for (const ResourceKey& key : jobs[index]) {
+                  destroyResource(key);
+                }
+              }
+            }));
           }
-          imageViews.clear();
 
-          // destroy images
-          for (auto& [key, value] : images) {
-            if (!value.destroyed) destroyImage(value);
+          std::exception_ptr error = nullptr;
+          for (std::future<void>& worker : workers) {
+            try {
+              worker.get();
+            } catch (...) {
+              if (error == nullptr) {
+                error = std::current_exception();
+              }
+            }
+          }
+          if (error != nullptr) {
+            std::rethrow_exception(error);
           }
-          images.clear();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          // destroy buffers
-          for (auto& [key, value] : buffers) {
-            if (!value.destroyed) destroyBuffer(value);
+      // the value is copied out under the registry lock and destroyed through the regular override
+      void destroyResource(const ResourceKey& key) {
+        try {
+          bool found = false;
+          forEachRegistry([this, &key, &found](ResourceType type, std::mutex& mutex, auto& registry, auto destroyValue) {
+            if (type != key.type) {
+              return;
+            }
+            std::remove_cvref_t<decltype(registry.back())> value = {};
+            {
+              std::lock_guard<std::mutex> lock(mutex);
+              const auto* registered = registry.find(key.id);
+              if (registered == nullptr) {
+                return;
+              }
+              value = *registered;
+            }
+            found = true;
+            (this->*destroyValue)(value);
+          });
+          if (!found) {
+            throw std::runtime_error(CALL_INFO() + ": failed to destroy stale or unknown id: " + std::to_string(key.id) + "!");
           }
-          buffers.clear();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // drops the registry entry without a driver call, for values freed together with their pool
+      void releaseResource(const ResourceKey& key) {
+        try {
+          forEachRegistry([this, &key](ResourceType type, std::mutex& mutex, auto& registry, auto) {
+            if (type != key.type) {
+              return;
+            }
+            std::remove_cvref_t<decltype(registry.back())> value = {};
+            {
+              std::lock_guard<std::mutex> lock(mutex);
+              const auto* registered = registry.find(key.id);
+              if (registered == nullptr) {
+                return;
+              }
+              value = *registered;
+            }
+            eraseValue(mutex, registry, value);
+          });
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          // destroy devices
-          for (auto& [key, value] : devices) {
-            if (!value.destroyed) destroyDevice(value);
+      bool containsResource(const ResourceKey& key) {
+        bool found = false;
+        forEachRegistry([&key, &found](ResourceType type, std::mutex& mutex, auto& registry, auto) {
+          if (type == key.type) {
+            std::lock_guard<std::mutex> lock(mutex);
+            found = registry.contains(key.id);
           }
-          devices.clear();
+        });
+        return found;
+      }
+
+      template<typename Visitor>
+      void forEachRegistry(Visitor visitor) {
+        visitor(ResourceType::INSTANCE, instanceMutex, instances, &ContextBase::destroyInstance);
+        visitor(ResourceType::DEBUG_UTILS_MESSENGER, debugUtilsMessengerMutex, debugUtilsMessengers, &ContextBase::destroyDebugUtilsMessenger);
+        visitor(ResourceType::PHYSICAL_DEVICE, physicalDeviceMutex, physicalDevices, &ContextBase::destroyPhysicalDevice);
+        visitor(ResourceType::DEVICE, deviceMutex, devices, &ContextBase::destroyDevice);
+        visitor(ResourceType::BUFFER, bufferMutex, buffers, &ContextBase::destroyBuffer);
+        visitor(ResourceType::IMAGE, imageMutex, images, &ContextBase::destroyImage);
+        visitor(ResourceType::IMAGE_VIEW, imageViewMutex, imageViews, &ContextBase::destroyImageView);
+        visitor(ResourceType::SAMPLER, samplerMutex, samplers, &ContextBase::destroySampler);
+        visitor(ResourceType::RENDER_PASS, renderPassMutex, renderPasses, &ContextBase::destroyRenderPass);
+        visitor(ResourceType::DESCRIPTOR_SET_LAYOUT, descriptorSetLayoutMutex, descriptorSetLayouts, &ContextBase::destroyDescriptorSetLayout);
+        visitor(ResourceType::DESCRIPTOR_POOL, descriptorPoolMutex, descriptorPools, &ContextBase::destroyDescriptorPool);
+        visitor(ResourceType::DESCRIPTOR_SET, descriptorSetMutex, descriptorSets, &ContextBase::destroyDescriptorSet);
+        visitor(ResourceType::DESCRIPTOR_ALLOCATOR, descriptorAllocatorMutex, descriptorAllocators, &ContextBase::destroyDescriptorAllocator);
+        visitor(ResourceType::DESCRIPTOR_UPDATE_TEMPLATE, descriptorUpdateTemplateMutex, descriptorUpdateTemplates, &ContextBase::destroyDescriptorUpdateTemplate);
+        visitor(ResourceType::BINDLESS_TABLE, bindlessTableMutex, bindlessTables, &ContextBase::destroyBindlessTable);
+        visitor(ResourceType::PIPELINE, pipelineMutex, pipelines, &ContextBase::destroyPipeline);
+        visitor(ResourceType::FRAME_BUFFER, frameBufferMutex, frameBuffers, &ContextBase::destroyFrameBuffer);
+        visitor(ResourceType::SURFACE, surfaceMutex, surfaces, &ContextBase::destroySurface);
+        visitor(ResourceType::SWAP_CHAIN, swapChainMutex, swapChains, &ContextBase::destroySwapChain);
+        visitor(ResourceType::QUEUE, queueMutex, queues, &ContextBase::destroyQueue);
+        visitor(ResourceType::COMMAND_POOL, commandPoolMutex, commandPools, &ContextBase::destroyCommandPool);
+        visitor(ResourceType::COMMAND_BUFFER, commandBufferMutex, commandBuffers, &ContextBase::destroyCommandBuffer);
+        visitor(ResourceType::SEMAPHORE, semaphoreMutex, semaphores, &ContextBase::destroySemaphore);
+        visitor(ResourceType::FENCE, fenceMutex, fences, &ContextBase::destroyFence);
+      }
 
-          // destroy physicalDevices
-          for (auto& [key, value] : physicalDevices) {
-            if (!value.destroyed) destroyPhysicalDevice(value);
+      static std::string resourceTypeName(ResourceType type) {
+        switch (type) {
+          case ResourceType::INSTANCE: return "INSTANCE";
+          case ResourceType::DEBUG_UTILS_MESSENGER: return "DEBUG_UTILS_MESSENGER";
+          case ResourceType::PHYSICAL_DEVICE: return "PHYSICAL_DEVICE";
+          case ResourceType::DEVICE: return "DEVICE";
+          case ResourceType::BUFFER: return "BUFFER";
+          case ResourceType::IMAGE: return "IMAGE";
+          case ResourceType::IMAGE_VIEW: return "IMAGE_VIEW";
+          case ResourceType::SAMPLER: return "SAMPLER";
+          case ResourceType::RENDER_PASS: return "RENDER_PASS";
+          case ResourceType::DESCRIPTOR_SET_LAYOUT: return "DESCRIPTOR_SET_LAYOUT";
+          case ResourceType::DESCRIPTOR_POOL: return "DESCRIPTOR_POOL";
+          case ResourceType::DESCRIPTOR_SET: return "DESCRIPTOR_SET";
+          case ResourceType::DESCRIPTOR_ALLOCATOR: return "DESCRIPTOR_ALLOCATOR";
+          case ResourceType::DESCRIPTOR_UPDATE_TEMPLATE: return "DESCRIPTOR_UPDATE_TEMPLATE";
+          case ResourceType::BINDLESS_TABLE: return "BINDLESS_TABLE";
+          case ResourceType::PIPELINE: return "PIPELINE";
+          case ResourceType::FRAME_BUFFER: return "FRAME_BUFFER";
+          case ResourceType::SURFACE: return "SURFACE";
+          case ResourceType::SWAP_CHAIN: return "SWAP_CHAIN";
+          case ResourceType::QUEUE: return "QUEUE";
+          case ResourceType::COMMAND_POOL: return "COMMAND_POOL";
+          case ResourceType::COMMAND_BUFFER: return "COMMAND_BUFFER";
+          case ResourceType::SEMAPHORE: return "SEMAPHORE";
+          case ResourceType::FENCE: return "FENCE";
+        }
+        return "UNKNOWN";
+      }
+
+      // sites carry file paths, on windows with backslashes
+      static std::string escapeJson(const std::string& value) {
+        std::string result;
+        for (char c : value) {
+          if (c == '"' || c == '\\') {
+            result += '\\';
           }
-          physicalDevices.clear();
+          result += c;
+        }
+        return result;
+      }
+
+      static bool isRootResource(ResourceType type) {
+        return type == ResourceType::INSTANCE
+            || type == ResourceType::DEBUG_UTILS_MESSENGER
+            || type == ResourceType::PHYSICAL_DEVICE
+            || type == ResourceType::DEVICE
+            || type == ResourceType::SURFACE;
+      }
 
-          // destroy debugUtilsMessengers
-          for (auto& [key, value] : debugUtilsMessengers) {
-            if (!value.destroyed) destroyDebugUtilsMessenger(value);
+      template<typename T>
+      static constexpr ResourceType resourceType() {
+        if constexpr (std::is_same_v<T, Instance>) {
+          return ResourceType::INSTANCE;
+        } else if constexpr (std::is_same_v<T, DebugUtilsMessenger>) {
+          return ResourceType::DEBUG_UTILS_MESSENGER;
+        } else if constexpr (std::is_same_v<T, PhysicalDevice>) {
+          return ResourceType::PHYSICAL_DEVICE;
+        } else if constexpr (std::is_same_v<T, Device>) {
+          return ResourceType::DEVICE;
+        } else if constexpr (std::is_same_v<T, Buffer>) {
+          return ResourceType::BUFFER;
+        } else if constexpr (std::is_same_v<T, Image>) {
+          return ResourceType::IMAGE;
+        } else if constexpr (std::is_same_v<T, ImageView>) {
+          return ResourceType::IMAGE_VIEW;
+        } else if constexpr (std::is_same_v<T, Sampler>) {
+          return ResourceType::SAMPLER;
+        } else if constexpr (std::is_same_v<T, RenderPass>) {
+          return ResourceType::RENDER_PASS;
+        } else if constexpr (std::is_same_v<T, DescriptorSetLayout>) {
+          return ResourceType::DESCRIPTOR_SET_LAYOUT;
+        } else if constexpr (std::is_same_v<T, DescriptorPool>) {
+          return ResourceType::DESCRIPTOR_POOL;
+        } else if constexpr (std::is_same_v<T, DescriptorSet>) {
+          return ResourceType::DESCRIPTOR_SET;
+        } else if constexpr (std::is_same_v<T, DescriptorAllocator>) {
+          return ResourceType::DESCRIPTOR_ALLOCATOR;
+        } else if constexpr (std::is_same_v<T, DescriptorUpdateTemplate>) {
+          return ResourceType::DESCRIPTOR_UPDATE_TEMPLATE;
+        } else if constexpr (std::is_same_v<T, BindlessTable>) {
+          return ResourceType::BINDLESS_TABLE;
+        } else if constexpr (std::is_same_v<T, Pipeline>) {
+          return ResourceType::PIPELINE;
+        } else if constexpr (std::is_same_v<T, FrameBuffer>) {
+          return ResourceType::FRAME_BUFFER;
+        } else if constexpr (std::is_same_v<T, Surface>) {
+          return ResourceType::SURFACE;
+        } else if constexpr (std::is_same_v<T, SwapChain>) {
+          return ResourceType::SWAP_CHAIN;
+        } else if constexpr (std::is_same_v<T, Queue>) {
+          return ResourceType::QUEUE;
+        } else if constexpr (std::is_same_v<T, CommandPool>) {
+          return ResourceType::COMMAND_POOL;
+        } else if constexpr (std::is_same_v<T, CommandBuffer>) {
+          return ResourceType::COMMAND_BUFFER;
+        } else if constexpr (std::is_same_v<T, Semaphore>) {
+          return ResourceType::SEMAPHORE;
+        } else {
+          static_assert(std::is_same_v<T, Fence>, "unsupported resource type");
+          return ResourceType::FENCE;
+        }
+      }
+
+      // dispatchable handles are pointers, non-dispatchable ones are pointers or integers depending on the platform
+      template<typename H>
+      static ResourceHandle resourceHandle(ResourceType type, const H& handle) {
+        if constexpr (std::is_pointer_v<H>) {
+          return {type, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle))};
+        } else {
+          return {type, static_cast<uint64_t>(handle)};
+        }
+      }
+
+      // the returned copy and the registry copy carry the same generational id,
+      // parents created outside of this context are not tracked
+      template<typename T>
+      void registerValue(
+          std::mutex& mutex,
+          SlotMap<T>& registry,
+          T& value,
+          const std::source_location& location,
+          const std::vector<ResourceHandle>& parents = {}
+      ) {
+        value.destroyed = false;
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          value.id = registry.insert(value);
+          registry.at(value.id).id = value.id;
+        }
+        ResourceKey key = {.type = resourceType<T>(), .id = value.id};
+        {
+          std::lock_guard<std::mutex> lock(dependencyMutex);
+          if constexpr (requires { value.value; }) {
+            ResourceHandle handle = resourceHandle(key.type, value.value);
+            if (handle.second != 0) {
+              handleResources[handle].emplace_back(key);
+              resourceHandles[key].emplace_back(handle);
+            }
+          }
+          for (const ResourceHandle& parent : parents) {
+            auto parentKeys = handleResources.find(parent);
+            if (parentKeys == handleResources.end()) {
+              continue;
+            }
+            for (const ResourceKey& parentKey : parentKeys->second) {
+              resourceDependents[parentKey].insert(key);
+              resourceDependencies[key].insert(parentKey);
+            }
+          }
+        }
+        {
+          std::lock_guard<std::mutex> lock(scopeMutex);
+          auto threadScopes = scopes.find(std::this_thread::get_id());
+          if (threadScopes != scopes.end()) {
+            threadScopes->second.back().keys.emplace_back(key);
           }
-          debugUtilsMessengers.clear();
+        }
+        VkDeviceSize memorySize = 0;
+        if constexpr (requires { value.allocationSize; }) {
+          memorySize = value.allocationSize;
+        }
+        // the caller of the create method, in the CALL_INFO() format
+        std::string site = std::string(location.function_name())
+            + "(" + std::filesystem::path(location.file_name()).make_preferred().string()
+            + ":" + std::to_string(location.line()) + ")";
+        std::lock_guard<std::mutex> lock(statisticsMutex);
+        ResourceStatistics& statistics = resourceStatistics[key.type];
+        if (statistics.createdCount == 0) {
+          statistics.type = key.type;
+          statistics.name = resourceTypeName(key.type);
+        }
+        const std::string* interned = &*resourceSites.insert(site).first;
+        resourceRecords[key] = {.site = interned, .memorySize = memorySize};
+        statistics.createdCount++;
+        statistics.liveCount++;
+        statistics.peakCount = std::max(statistics.peakCount, statistics.liveCount);
+        statistics.memorySize += memorySize;
+        statistics.peakMemorySize = std::max(statistics.peakMemorySize, statistics.memorySize);
+        statistics.sites[site]++;
+      }
+
+      template<typename T>
+      static void updateValue(std::mutex& mutex, SlotMap<T>& registry, const T& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        registry.at(value.id) = value;
+      }
 
-          // destroy instances
-          for (auto& [key, value] : instances) {
-            if (!value.destroyed) destroyInstance(value);
+      // a destroyed or foreign value is rejected before it reaches the driver
+      template<typename T>
+      static void checkValue(std::mutex& mutex, const SlotMap<T>& registry, const T& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!registry.contains(value.id)) {
+          throw std::runtime_error(CALL_INFO() + ": failed to use stale or unknown id: " + std::to_string(value.id) + "!");
+        }
+      }
+
+      template<typename T>
+      void eraseValue(std::mutex& mutex, SlotMap<T>& registry, const T& value) {
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          registry.erase(value.id);
+        }
+        ResourceKey key = {.type = resourceType<T>(), .id = value.id};
+        forgetResource(key);
+        uncountResource(key);
+      }
+
+      void uncountResource(const ResourceKey& key) {
+        std::lock_guard<std::mutex> lock(statisticsMutex);
+        auto record = resourceRecords.find(key);
+        if (record == resourceRecords.end()) {
+          return;
+        }
+        ResourceStatistics& statistics = resourceStatistics[key.type];
+        statistics.liveCount--;
+        statistics.memorySize -= record->second.memorySize;
+        auto site = statistics.sites.find(*record->second.site);
+        if (site != statistics.sites.end() && --site->second == 0) {
+          statistics.sites.erase(site);
+        }
+        resourceRecords.erase(record);
+      }
+
+      // children left behind by a direct destroy lose the edge, the other holders of a shared handle keep theirs
+      void forgetResource(const ResourceKey& key) {
+        std::lock_guard<std::mutex> lock(dependencyMutex);
+        auto dependencies = resourceDependencies.find(key);
+        if (dependencies != resourceDependencies.end()) {
+          for (const ResourceKey& dependency : dependencies->second) {
+            auto dependents = resourceDependents.find(dependency);
+            if (dependents != resourceDependents.end() && dependents->second.erase(key) > 0 && dependents->second.empty()) {
+              resourceDependents.erase(dependents);
+            }
           }
-          instances.clear();
-        } catch (...) {
-          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+          resourceDependencies.erase(dependencies);
+        }
+        auto dependents = resourceDependents.find(key);
+        if (dependents != resourceDependents.end()) {
+          for (const ResourceKey& dependent : dependents->second) {
+            auto dependentDependencies = resourceDependencies.find(dependent);
+            if (dependentDependencies != resourceDependencies.end() && dependentDependencies->second.erase(key) > 0 && dependentDependencies->second.empty()) {
+              resourceDependencies.erase(dependentDependencies);
+            }
+          }
+          resourceDependents.erase(dependents);
+        }
+        auto handles = resourceHandles.find(key);
+        if (handles != resourceHandles.end()) {
+          for (const ResourceHandle& handle : handles->second) {
+            auto handleKeys = handleResources.find(handle);
+            if (handleKeys != handleResources.end() && std::erase(handleKeys->second, key) > 0 && handleKeys->second.empty()) {
+              handleResources.erase(handleKeys);
+            }
+          }
+          resourceHandles.erase(handles);
         }
       }
 
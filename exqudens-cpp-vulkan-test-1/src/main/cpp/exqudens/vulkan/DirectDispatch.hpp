@@ -0,0 +1,19 @@
+#pragma once
+
+#include "exqudens/vulkan/FunctionsProvider.hpp"
+#include "exqudens/vulkan/model/DirectFunctions.hpp"
+
+namespace exqudens::vulkan {
+
+  // dispatch straight to the vulkan entry points, the provider table is not consulted
+  struct DirectDispatch {
+
+    static constexpr DirectFunctions FUNCTIONS = {};
+
+    static const DirectFunctions& functions(FunctionsProvider&) {
+      return FUNCTIONS;
+    }
+
+  };
+
+}
@@ -12,9 +12,13 @@
 #include "exqudens/vulkan/factory/DescriptorSetLayoutFactory.hpp"
 #include "exqudens/vulkan/factory/RenderPassFactory.hpp"
 #include "exqudens/vulkan/factory/PipelineFactory.hpp"
+#include "exqudens/vulkan/factory/ComputePipelineFactory.hpp"
 #include "exqudens/vulkan/factory/SamplerFactory.hpp"
 #include "exqudens/vulkan/factory/DescriptorPoolFactory.hpp"
 #include "exqudens/vulkan/factory/DescriptorSetFactory.hpp"
+#include "exqudens/vulkan/factory/DescriptorAllocatorFactory.hpp"
+#include "exqudens/vulkan/factory/DescriptorUpdateTemplateFactory.hpp"
+#include "exqudens/vulkan/factory/BindlessTableFactory.hpp"
 #include "exqudens/vulkan/factory/FrameBufferFactory.hpp"
 #include "exqudens/vulkan/factory/QueueFactory.hpp"
 #include "exqudens/vulkan/factory/CommandPoolFactory.hpp"
@@ -23,6 +27,7 @@
 #include "exqudens/vulkan/factory/FenceFactory.hpp"
 #include "exqudens/vulkan/factory/SurfaceFactory.hpp"
 #include "exqudens/vulkan/factory/SwapChainFactory.hpp"
+#include "exqudens/vulkan/factory/FramePacerFactory.hpp"
 
 namespace exqudens::vulkan {
 
@@ -39,9 +44,13 @@ namespace exqudens::vulkan {
       virtual public DescriptorSetLayoutFactory,
       virtual public RenderPassFactory,
       virtual public PipelineFactory,
+      virtual public ComputePipelineFactory,
       virtual public SamplerFactory,
       virtual public DescriptorPoolFactory,
       virtual public DescriptorSetFactory,
+      virtual public DescriptorAllocatorFactory,
+      virtual public DescriptorUpdateTemplateFactory,
+      virtual public BindlessTableFactory,
       virtual public FrameBufferFactory,
       virtual public QueueFactory,
       virtual public CommandPoolFactory,
@@ -49,7 +58,8 @@ namespace exqudens::vulkan {
       virtual public SemaphoreFactory,
       virtual public FenceFactory,
       virtual public SurfaceFactory,
-      virtual public SwapChainFactory
+      virtual public SwapChainFactory,
+      virtual public FramePacerFactory
   {
 
     public:
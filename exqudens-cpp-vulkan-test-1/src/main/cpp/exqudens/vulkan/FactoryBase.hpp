@@ -13,9 +13,13 @@
 #include "exqudens/vulkan/factory/DescriptorSetLayoutFactoryBase.hpp"
 #include "exqudens/vulkan/factory/RenderPassFactoryBase.hpp"
 #include "exqudens/vulkan/factory/PipelineFactoryBase.hpp"
+#include "exqudens/vulkan/factory/ComputePipelineFactoryBase.hpp"
 #include "exqudens/vulkan/factory/SamplerFactoryBase.hpp"
 #include "exqudens/vulkan/factory/DescriptorPoolFactoryBase.hpp"
 #include "exqudens/vulkan/factory/DescriptorSetFactoryBase.hpp"
+#include "exqudens/vulkan/factory/DescriptorAllocatorFactoryBase.hpp"
+#include "exqudens/vulkan/factory/DescriptorUpdateTemplateFactoryBase.hpp"
+#include "exqudens/vulkan/factory/BindlessTableFactoryBase.hpp"
 #include "exqudens/vulkan/factory/FrameBufferFactoryBase.hpp"
 #include "exqudens/vulkan/factory/QueueFactoryBase.hpp"
 #include "exqudens/vulkan/factory/CommandPoolFactoryBase.hpp"
@@ -24,35 +28,44 @@
 #include "exqudens/vulkan/factory/FenceFactoryBase.hpp"
 #include "exqudens/vulkan/factory/SurfaceFactoryBase.hpp"
 #include "exqudens/vulkan/factory/SwapChainFactoryBase.hpp"
+#include "exqudens/vulkan/factory/FramePacerFactoryBase.hpp"
 
 namespace exqudens::vulkan {
 
-  class FactoryBase:
+  template<typename Dispatch>
+  class BasicFactoryBase:
       virtual public Factory,
-      virtual public UtilityBase,
+      virtual public BasicUtilityBase<Dispatch>,
       virtual public UtilityFactoryBase,
-      virtual public InstanceFactoryBase,
-      virtual public DebugUtilsMessengerFactoryBase,
-      virtual public PhysicalDeviceFactoryBase,
-      virtual public DeviceFactoryBase,
-      virtual public BufferFactoryBase,
-      virtual public ImageFactoryBase,
-      virtual public ImageViewFactoryBase,
-      virtual public DescriptorSetLayoutFactoryBase,
-      virtual public RenderPassFactoryBase,
-      virtual public PipelineFactoryBase,
-      virtual public SamplerFactoryBase,
-      virtual public DescriptorPoolFactoryBase,
-      virtual public DescriptorSetFactoryBase,
-      virtual public FrameBufferFactoryBase,
-      virtual public QueueFactoryBase,
-      virtual public CommandPoolFactoryBase,
-      virtual public CommandBufferFactoryBase,
-      virtual public SemaphoreFactoryBase,
-      virtual public FenceFactoryBase,
-      virtual public SurfaceFactoryBase,
-      virtual public SwapChainFactoryBase
+      virtual public BasicInstanceFactoryBase<Dispatch>,
+      virtual public BasicDebugUtilsMessengerFactoryBase<Dispatch>,
+      virtual public BasicPhysicalDeviceFactoryBase<Dispatch>,
+      virtual public BasicDeviceFactoryBase<Dispatch>,
+      virtual public BasicBufferFactoryBase<Dispatch>,
+      virtual public BasicImageFactoryBase<Dispatch>,
+      virtual public BasicImageViewFactoryBase<Dispatch>,
+      virtual public BasicDescriptorSetLayoutFactoryBase<Dispatch>,
+      virtual public BasicRenderPassFactoryBase<Dispatch>,
+      virtual public BasicPipelineFactoryBase<Dispatch>,
+      virtual public BasicComputePipelineFactoryBase<Dispatch>,
+      virtual public BasicSamplerFactoryBase<Dispatch>,
+      virtual public BasicDescriptorPoolFactoryBase<Dispatch>,
+      virtual public BasicDescriptorSetFactoryBase<Dispatch>,
+      virtual public BasicDescriptorAllocatorFactoryBase<Dispatch>,
+      virtual public BasicDescriptorUpdateTemplateFactoryBase<Dispatch>,
+      virtual public BasicBindlessTableFactoryBase<Dispatch>,
+      virtual public BasicFrameBufferFactoryBase<Dispatch>,
+      virtual public BasicQueueFactoryBase<Dispatch>,
+      virtual public BasicCommandPoolFactoryBase<Dispatch>,
+      virtual public BasicCommandBufferFactoryBase<Dispatch>,
+      virtual public BasicSemaphoreFactoryBase<Dispatch>,
+      virtual public BasicFenceFactoryBase<Dispatch>,
+      virtual public BasicSurfaceFactoryBase<Dispatch>,
+      virtual public BasicSwapChainFactoryBase<Dispatch>,
+      virtual public FramePacerFactoryBase
   {
   };
 
+  using FactoryBase = BasicFactoryBase<FunctionsDispatch>;
+
 }
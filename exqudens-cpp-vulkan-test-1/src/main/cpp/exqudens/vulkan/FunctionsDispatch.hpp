@@ -0,0 +1,16 @@
+#pragma once
+
+#include "exqudens/vulkan/FunctionsProvider.hpp"
+
+namespace exqudens::vulkan {
+
+  // dispatch through the overridable Functions table, used by tests to stand in for the driver
+  struct FunctionsDispatch {
+
+    static const Functions& functions(FunctionsProvider& provider) {
+      return provider.functions();
+    }
+
+  };
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+#include "exqudens/vulkan/model/FunctionProfile.hpp"
+
+namespace exqudens::vulkan {
+
+  class FunctionsProfiler {
+
+    public:
+
+      virtual std::vector<FunctionProfile> getFunctionProfiles() = 0;
+
+      virtual void resetFunctionProfiles() = 0;
+
+      virtual void writeFunctionProfiles(std::ostream& stream) = 0;
+
+      virtual ~FunctionsProfiler() = default;
+
+  };
+
+}
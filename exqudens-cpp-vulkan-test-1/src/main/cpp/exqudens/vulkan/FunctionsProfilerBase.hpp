@@ -0,0 +1,187 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <algorithm>
+#include <stdexcept>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/FunctionsProfiler.hpp"
+#include "exqudens/vulkan/FunctionsProviderBase.hpp"
+
+namespace exqudens::vulkan {
+
+  // opt-in: mixed in next to a factory or context it times every entry of the Functions table,
+  // calls made through DirectDispatch bypass the table and are not seen
+  class FunctionsProfilerBase:
+      virtual public FunctionsProfiler,
+      virtual public FunctionsProviderBase
+  {
+
+    protected:
+
+      // updated from any thread that calls through the table, times in nanoseconds
+      struct FunctionProfileCounters {
+
+        std::atomic<std::size_t> count = 0;
+        std::atomic<int64_t> totalTime = 0;
+        std::atomic<int64_t> minTime = std::numeric_limits<int64_t>::max();
+        std::atomic<int64_t> maxTime = 0;
+        std::array<std::atomic<std::size_t>, FunctionProfile::HISTOGRAM_SIZE> histogram = {};
+
+      };
+
+      struct FunctionProfileScope {
+
+        FunctionProfileCounters& counters;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        ~FunctionProfileScope() {
+          addFunctionProfileTime(counters, std::chrono::steady_clock::now() - start);
+        }
+
+      };
+
+      // guards the map itself, entries refer to their counters and map nodes stay in place across table rebuilds
+      std::mutex functionProfilesMutex;
+      std::map<std::string, FunctionProfileCounters> functionProfiles = {};
+
+    public:
+
+      // called entries only, the most expensive first
+      std::vector<FunctionProfile> getFunctionProfiles() override {
+        try {
+          std::vector<FunctionProfile> values;
+          std::lock_guard<std::mutex> lock(functionProfilesMutex);
+          for (const auto& [name, counters] : functionProfiles) {
+            // counters of a call in flight may be read half updated, the next read catches up
+            std::size_t count = counters.count.load(std::memory_order_relaxed);
+            if (count == 0) {
+              continue;
+            }
+            FunctionProfile value = {
+                .name = name,
+                .count = count,
+                .totalTime = std::chrono::nanoseconds(counters.totalTime.load(std::memory_order_relaxed)),
+                .minTime = std::chrono::nanoseconds(counters.minTime.load(std::memory_order_relaxed)),
+                .maxTime = std::chrono::nanoseconds(counters.maxTime.load(std::memory_order_relaxed)),
+                .histogram = {}
+            };
+            value.histogram.reserve(counters.histogram.size());
+            for (const std::atomic<std::size_t>& bucket : counters.histogram) {
+              value.histogram.emplace_back(bucket.load(std::memory_order_relaxed));
+            }
+            values.emplace_back(std::move(value));
+          }
+          std::stable_sort(values.begin(), values.end(), [](const FunctionProfile& a, const FunctionProfile& b) {
+            return a.totalTime > b.totalTime;
+          });
+          return values;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void resetFunctionProfiles() override {
+        try {
+          std::lock_guard<std::mutex> lock(functionProfilesMutex);
+          for (auto& [name, counters] : functionProfiles) {
+            counters.count.store(0, std::memory_order_relaxed);
+            counters.totalTime.store(0, std::memory_order_relaxed);
+            counters.minTime.store(std::numeric_limits<int64_t>::max(), std::memory_order_relaxed);
+            counters.maxTime.store(0, std::memory_order_relaxed);
+            for (std::atomic<std::size_t>& bucket : counters.histogram) {
+              bucket.store(0, std::memory_order_relaxed);
+            }
+          }
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void writeFunctionProfiles(std::ostream& stream) override {
+        try {
+          std::vector<FunctionProfile> values = getFunctionProfiles();
+          stream << "{\n  \"functions\": [";
+          for (std::size_t i = 0; i < values.size(); i++) {
+            const FunctionProfile& value = values[i];
+            stream << (i == 0 ? "\n" : ",\n");
+            stream << "    {";
+            stream << "\"name\": \"" << value.name << "\", ";
+            stream << "\"count\": " << value.count << ", ";
+            stream << "\"totalTimeNs\": " << value.totalTime.count() << ", ";
+            stream << "\"minTimeNs\": " << value.minTime.count() << ", ";
+            stream << "\"maxTimeNs\": " << value.maxTime.count() << ", ";
+            stream << "\"histogram\": [";
+            bool first = true;
+            for (std::size_t j = 0; j < value.histogram.size(); j++) {
+              if (value.histogram[j] == 0) {
+                continue;
+              }
+              // exclusive upper bound of the bucket, the last bucket is open
+              std::string upperBound = j + 1 < value.histogram.size() ? std::to_string(1ull << j) : "null";
+              stream << (first ? "" : ", ");
+              stream << "{\"upperBoundNs\": " << upperBound << ", \"count\": " << value.histogram[j] << "}";
+              first = false;
+            }
+            stream << "]}";
+          }
+          stream << (values.empty() ? "]\n}\n" : "\n  ]\n}\n");
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+    protected:
+
+      Functions decorateFunctions(Functions value) override {
+        try {
+          value = FunctionsProviderBase::decorateFunctions(value);
+          forEachFunction(value, [this](auto& function, const std::string& name) {
+            profileFunction(function, name);
+          });
+          return value;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      template<typename R, typename... Args>
+      void profileFunction(std::function<R(Args...)>& function, const std::string& name) {
+        if (!function) {
+          return;
+        }
+        FunctionProfileCounters* counters = nullptr;
+        {
+          std::lock_guard<std::mutex> lock(functionProfilesMutex);
+          counters = &functionProfiles[name];
+        }
+        function = [target = function, counters](Args... args) -> R {
+          FunctionProfileScope scope = {.counters = *counters};
+          return target(std::forward<Args>(args)...);
+        };
+      }
+
+      static void addFunctionProfileTime(FunctionProfileCounters& counters, std::chrono::nanoseconds time) {
+        int64_t value = time.count();
+        int64_t minTime = counters.minTime.load(std::memory_order_relaxed);
+        while (value < minTime && !counters.minTime.compare_exchange_weak(minTime, value, std::memory_order_relaxed)) {
+        }
+        int64_t maxTime = counters.maxTime.load(std::memory_order_relaxed);
+        while (value > maxTime && !counters.maxTime.compare_exchange_weak(maxTime, value, std::memory_order_relaxed)) {
+        }
+        counters.totalTime.fetch_add(value, std::memory_order_relaxed);
+        std::size_t bucket = std::bit_width(value > 0 ? static_cast<uint64_t>(value) : uint64_t(0));
+        counters.histogram[std::min(bucket, FunctionProfile::HISTOGRAM_SIZE - 1)].fetch_add(1, std::memory_order_relaxed);
+        counters.count.fetch_add(1, std::memory_order_relaxed);
+      }
+
+  };
+
+}
@@ -8,7 +8,7 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual Functions functions() = 0;
+      virtual const Functions& functions() = 0;
 
       virtual ~FunctionsProvider() = default;
 
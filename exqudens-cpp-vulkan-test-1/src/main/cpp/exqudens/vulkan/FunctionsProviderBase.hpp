@@ -1,9 +1,14 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
 
 #include "exqudens/vulkan/Macros.hpp"
 #include "exqudens/vulkan/FunctionsProvider.hpp"
+#include "exqudens/vulkan/model/InstanceFunctions.hpp"
+#include "exqudens/vulkan/model/DeviceFunctions.hpp"
 
 namespace exqudens::vulkan {
 
@@ -11,9 +16,38 @@ namespace exqudens::vulkan {
       virtual public FunctionsProvider
   {
 
+    protected:
+
+      std::optional<Functions> functionsTable = {};
+      // replaced whenever the table is reset, so the next call builds it once again
+      std::unique_ptr<std::once_flag> functionsTableFlag = std::make_unique<std::once_flag>();
+      std::optional<InstanceFunctions> instanceFunctions = {};
+      std::optional<DeviceFunctions> deviceFunctions = {};
+
     public:
 
-      Functions functions() override {
+      // built on first use, also when that first use is concurrent, every later call only returns the reference
+      const Functions& functions() override {
+        try {
+          std::call_once(*functionsTableFlag, [this]() {
+            Functions value = createFunctions();
+            if (instanceFunctions.has_value()) {
+              setFunctions(value, instanceFunctions.value());
+            }
+            if (deviceFunctions.has_value()) {
+              setFunctions(value, deviceFunctions.value());
+            }
+            functionsTable = decorateFunctions(value);
+          });
+          return functionsTable.value();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+    protected:
+
+      virtual Functions createFunctions() {
         try {
           return {
               .enumerateInstanceLayerProperties = vkEnumerateInstanceLayerProperties,
@@ -23,17 +57,20 @@ namespace exqudens::vulkan {
               .getPhysicalDeviceQueueFamilyProperties = vkGetPhysicalDeviceQueueFamilyProperties,
               .getPhysicalDeviceSurfaceSupportKHR = vkGetPhysicalDeviceSurfaceSupportKHR,
               .getPhysicalDeviceFeatures = vkGetPhysicalDeviceFeatures,
+              .getPhysicalDeviceFeatures2 = vkGetPhysicalDeviceFeatures2,
               .getPhysicalDeviceSurfaceCapabilitiesKHR = vkGetPhysicalDeviceSurfaceCapabilitiesKHR,
               .getPhysicalDeviceSurfaceFormatsKHR = vkGetPhysicalDeviceSurfaceFormatsKHR,
               .getPhysicalDeviceSurfacePresentModesKHR = vkGetPhysicalDeviceSurfacePresentModesKHR,
               .getPhysicalDeviceMemoryProperties = vkGetPhysicalDeviceMemoryProperties,
               .getPhysicalDeviceFormatProperties = vkGetPhysicalDeviceFormatProperties,
               .getInstanceProcAddr = vkGetInstanceProcAddr,
+              .getDeviceProcAddr = vkGetDeviceProcAddr,
               .getDeviceQueue = vkGetDeviceQueue,
               .getBufferMemoryRequirements = vkGetBufferMemoryRequirements,
               .getImageMemoryRequirements = vkGetImageMemoryRequirements,
               .getSwapchainImagesKHR = vkGetSwapchainImagesKHR,
               .updateDescriptorSets = vkUpdateDescriptorSets,
+              .updateDescriptorSetWithTemplate = vkUpdateDescriptorSetWithTemplate,
               .createInstance = vkCreateInstance,
               .createDevice = vkCreateDevice,
               .createCommandPool = vkCreateCommandPool,
@@ -46,9 +83,11 @@ namespace exqudens::vulkan {
               .createShaderModule = vkCreateShaderModule,
               .createPipelineLayout = vkCreatePipelineLayout,
               .createGraphicsPipelines = vkCreateGraphicsPipelines,
+              .createComputePipelines = vkCreateComputePipelines,
               .createFramebuffer = vkCreateFramebuffer,
               .createSampler = vkCreateSampler,
               .createDescriptorPool = vkCreateDescriptorPool,
+              .createDescriptorUpdateTemplate = vkCreateDescriptorUpdateTemplate,
               .createSemaphore = vkCreateSemaphore,
               .createFence = vkCreateFence,
               .allocateMemory = vkAllocateMemory,
@@ -60,12 +99,15 @@ namespace exqudens::vulkan {
               .unmapMemory = vkUnmapMemory,
               .freeMemory = vkFreeMemory,
               .freeCommandBuffers = vkFreeCommandBuffers,
+              .resetDescriptorPool = vkResetDescriptorPool,
               .destroyFence = vkDestroyFence,
               .destroySemaphore = vkDestroySemaphore,
               .destroyDescriptorPool = vkDestroyDescriptorPool,
+              .destroyDescriptorUpdateTemplate = vkDestroyDescriptorUpdateTemplate,
               .destroySampler = vkDestroySampler,
               .destroyFramebuffer = vkDestroyFramebuffer,
               .destroyPipeline = vkDestroyPipeline,
+              .destroyPipelineLayout = vkDestroyPipelineLayout,
               .destroyShaderModule = vkDestroyShaderModule,
               .destroyDescriptorSetLayout = vkDestroyDescriptorSetLayout,
               .destroyRenderPass = vkDestroyRenderPass,
@@ -79,13 +121,245 @@ namespace exqudens::vulkan {
               .destroyInstance = vkDestroyInstance,
               .cmdCopyBuffer = vkCmdCopyBuffer,
               .cmdCopyBufferToImage = vkCmdCopyBufferToImage,
-              .cmdPipelineBarrier = vkCmdPipelineBarrier
+              .cmdPipelineBarrier = vkCmdPipelineBarrier,
+              .cmdBindPipeline = vkCmdBindPipeline,
+              .cmdDispatch = vkCmdDispatch,
+              .cmdDispatchIndirect = vkCmdDispatchIndirect,
+              .cmdBindDescriptorSets = vkCmdBindDescriptorSets,
+              .cmdPushConstants = vkCmdPushConstants
           };
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
+      // applied to the finished table, including the instance and device entries
+      virtual Functions decorateFunctions(Functions value) {
+        try {
+          return value;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void setInstanceFunctions(const InstanceFunctions& value) {
+        try {
+          instanceFunctions = value;
+          resetFunctionsTable();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void setDeviceFunctions(const DeviceFunctions& value) {
+        try {
+          deviceFunctions = value;
+          resetFunctionsTable();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void resetFunctions() {
+        try {
+          instanceFunctions.reset();
+          deviceFunctions.reset();
+          resetFunctionsTable();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // not synchronized with functions(), callers reset while no other thread uses the table
+      void resetFunctionsTable() {
+        try {
+          functionsTable.reset();
+          functionsTableFlag = std::make_unique<std::once_flag>();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // entries resolved through the instance dispatch, loader trampolines are kept for null ones
+      static void setFunctions(Functions& table, const InstanceFunctions& value) {
+        try {
+          setFunction(table.enumerateDeviceExtensionProperties, value.enumerateDeviceExtensionProperties);
+          setFunction(table.enumeratePhysicalDevices, value.enumeratePhysicalDevices);
+          setFunction(table.getPhysicalDeviceProperties, value.getPhysicalDeviceProperties);
+          setFunction(table.getPhysicalDeviceQueueFamilyProperties, value.getPhysicalDeviceQueueFamilyProperties);
+          setFunction(table.getPhysicalDeviceSurfaceSupportKHR, value.getPhysicalDeviceSurfaceSupportKHR);
+          setFunction(table.getPhysicalDeviceFeatures, value.getPhysicalDeviceFeatures);
+          setFunction(table.getPhysicalDeviceFeatures2, value.getPhysicalDeviceFeatures2);
+          setFunction(table.getPhysicalDeviceSurfaceCapabilitiesKHR, value.getPhysicalDeviceSurfaceCapabilitiesKHR);
+          setFunction(table.getPhysicalDeviceSurfaceFormatsKHR, value.getPhysicalDeviceSurfaceFormatsKHR);
+          setFunction(table.getPhysicalDeviceSurfacePresentModesKHR, value.getPhysicalDeviceSurfacePresentModesKHR);
+          setFunction(table.getPhysicalDeviceMemoryProperties, value.getPhysicalDeviceMemoryProperties);
+          setFunction(table.getPhysicalDeviceFormatProperties, value.getPhysicalDeviceFormatProperties);
+          setFunction(table.getDeviceProcAddr, value.getDeviceProcAddr);
+          setFunction(table.createDevice, value.createDevice);
+          setFunction(table.destroySurfaceKHR, value.destroySurfaceKHR);
+          setFunction(table.destroyInstance, value.destroyInstance);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // entries resolved for one device, valid only while that device is the only one in use
+      static void setFunctions(Functions& table, const DeviceFunctions& value) {
+        try {
+          setFunction(table.getDeviceQueue, value.getDeviceQueue);
+          setFunction(table.getBufferMemoryRequirements, value.getBufferMemoryRequirements);
+          setFunction(table.getImageMemoryRequirements, value.getImageMemoryRequirements);
+          setFunction(table.getSwapchainImagesKHR, value.getSwapchainImagesKHR);
+          setFunction(table.updateDescriptorSets, value.updateDescriptorSets);
+          setFunction(table.updateDescriptorSetWithTemplate, value.updateDescriptorSetWithTemplate);
+          setFunction(table.createCommandPool, value.createCommandPool);
+          setFunction(table.createSwapchainKHR, value.createSwapchainKHR);
+          setFunction(table.createBuffer, value.createBuffer);
+          setFunction(table.createImage, value.createImage);
+          setFunction(table.createImageView, value.createImageView);
+          setFunction(table.createRenderPass, value.createRenderPass);
+          setFunction(table.createDescriptorSetLayout, value.createDescriptorSetLayout);
+          setFunction(table.createShaderModule, value.createShaderModule);
+          setFunction(table.createPipelineLayout, value.createPipelineLayout);
+          setFunction(table.createGraphicsPipelines, value.createGraphicsPipelines);
+          setFunction(table.createComputePipelines, value.createComputePipelines);
+          setFunction(table.createFramebuffer, value.createFramebuffer);
+          setFunction(table.createSampler, value.createSampler);
+          setFunction(table.createDescriptorPool, value.createDescriptorPool);
+          setFunction(table.createDescriptorUpdateTemplate, value.createDescriptorUpdateTemplate);
+          setFunction(table.createSemaphore, value.createSemaphore);
+          setFunction(table.createFence, value.createFence);
+          setFunction(table.allocateMemory, value.allocateMemory);
+          setFunction(table.allocateDescriptorSets, value.allocateDescriptorSets);
+          setFunction(table.allocateCommandBuffers, value.allocateCommandBuffers);
+          setFunction(table.bindBufferMemory, value.bindBufferMemory);
+          setFunction(table.bindImageMemory, value.bindImageMemory);
+          setFunction(table.mapMemory, value.mapMemory);
+          setFunction(table.unmapMemory, value.unmapMemory);
+          setFunction(table.freeMemory, value.freeMemory);
+          setFunction(table.freeCommandBuffers, value.freeCommandBuffers);
+          setFunction(table.resetDescriptorPool, value.resetDescriptorPool);
+          setFunction(table.destroyFence, value.destroyFence);
+          setFunction(table.destroySemaphore, value.destroySemaphore);
+          setFunction(table.destroyDescriptorPool, value.destroyDescriptorPool);
+          setFunction(table.destroyDescriptorUpdateTemplate, value.destroyDescriptorUpdateTemplate);
+          setFunction(table.destroySampler, value.destroySampler);
+          setFunction(table.destroyFramebuffer, value.destroyFramebuffer);
+          setFunction(table.destroyPipeline, value.destroyPipeline);
+          setFunction(table.destroyPipelineLayout, value.destroyPipelineLayout);
+          setFunction(table.destroyShaderModule, value.destroyShaderModule);
+          setFunction(table.destroyDescriptorSetLayout, value.destroyDescriptorSetLayout);
+          setFunction(table.destroyRenderPass, value.destroyRenderPass);
+          setFunction(table.destroyImageView, value.destroyImageView);
+          setFunction(table.destroyImage, value.destroyImage);
+          setFunction(table.destroyBuffer, value.destroyBuffer);
+          setFunction(table.destroySwapchainKHR, value.destroySwapchainKHR);
+          setFunction(table.destroyCommandPool, value.destroyCommandPool);
+          setFunction(table.destroyDevice, value.destroyDevice);
+          setFunction(table.cmdCopyBuffer, value.cmdCopyBuffer);
+          setFunction(table.cmdCopyBufferToImage, value.cmdCopyBufferToImage);
+          setFunction(table.cmdPipelineBarrier, value.cmdPipelineBarrier);
+          setFunction(table.cmdBindPipeline, value.cmdBindPipeline);
+          setFunction(table.cmdDispatch, value.cmdDispatch);
+          setFunction(table.cmdDispatchIndirect, value.cmdDispatchIndirect);
+          setFunction(table.cmdBindDescriptorSets, value.cmdBindDescriptorSets);
+          setFunction(table.cmdPushConstants, value.cmdPushConstants);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // visits every entry with its vulkan name, table may be const
+      template<typename T, typename F>
+      static void forEachFunction(T& table, F&& visitor) {
+        visitor(table.enumerateInstanceLayerProperties, "vkEnumerateInstanceLayerProperties");
+        visitor(table.enumerateDeviceExtensionProperties, "vkEnumerateDeviceExtensionProperties");
+        visitor(table.enumeratePhysicalDevices, "vkEnumeratePhysicalDevices");
+        visitor(table.getPhysicalDeviceProperties, "vkGetPhysicalDeviceProperties");
+        visitor(table.getPhysicalDeviceQueueFamilyProperties, "vkGetPhysicalDeviceQueueFamilyProperties");
+        visitor(table.getPhysicalDeviceSurfaceSupportKHR, "vkGetPhysicalDeviceSurfaceSupportKHR");
+        visitor(table.getPhysicalDeviceFeatures, "vkGetPhysicalDeviceFeatures");
+        visitor(table.getPhysicalDeviceFeatures2, "vkGetPhysicalDeviceFeatures2");
+        visitor(table.getPhysicalDeviceSurfaceCapabilitiesKHR, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+        visitor(table.getPhysicalDeviceSurfaceFormatsKHR, "vkGetPhysicalDeviceSurfaceFormatsKHR");
+        visitor(table.getPhysicalDeviceSurfacePresentModesKHR, "vkGetPhysicalDeviceSurfacePresentModesKHR");
+        visitor(table.getPhysicalDeviceMemoryProperties, "vkGetPhysicalDeviceMemoryProperties");
+        visitor(table.getPhysicalDeviceFormatProperties, "vkGetPhysicalDeviceFormatProperties");
+        visitor(table.getInstanceProcAddr, "vkGetInstanceProcAddr");
+        visitor(table.getDeviceProcAddr, "vkGetDeviceProcAddr");
+        visitor(table.getDeviceQueue, "vkGetDeviceQueue");
+        visitor(table.getBufferMemoryRequirements, "vkGetBufferMemoryRequirements");
+        visitor(table.getImageMemoryRequirements, "vkGetImageMemoryRequirements");
+        visitor(table.getSwapchainImagesKHR, "vkGetSwapchainImagesKHR");
+        visitor(table.updateDescriptorSets, "vkUpdateDescriptorSets");
+        visitor(table.updateDescriptorSetWithTemplate, "vkUpdateDescriptorSetWithTemplate");
+        visitor(table.createInstance, "vkCreateInstance");
+        visitor(table.createDevice, "vkCreateDevice");
+        visitor(table.createCommandPool, "vkCreateCommandPool");
+        visitor(table.createSurfaceKHR, "vkCreateSurfaceKHR");
+        visitor(table.createSwapchainKHR, "vkCreateSwapchainKHR");
+        visitor(table.createBuffer, "vkCreateBuffer");
+        visitor(table.createImage, "vkCreateImage");
+        visitor(table.createImageView, "vkCreateImageView");
+        visitor(table.createRenderPass, "vkCreateRenderPass");
+        visitor(table.createDescriptorSetLayout, "vkCreateDescriptorSetLayout");
+        visitor(table.createShaderModule, "vkCreateShaderModule");
+        visitor(table.createPipelineLayout, "vkCreatePipelineLayout");
+        visitor(table.createGraphicsPipelines, "vkCreateGraphicsPipelines");
+        visitor(table.createComputePipelines, "vkCreateComputePipelines");
+        visitor(table.createFramebuffer, "vkCreateFramebuffer");
+        visitor(table.createSampler, "vkCreateSampler");
+        visitor(table.createDescriptorPool, "vkCreateDescriptorPool");
+        visitor(table.createDescriptorUpdateTemplate, "vkCreateDescriptorUpdateTemplate");
+        visitor(table.createSemaphore, "vkCreateSemaphore");
+        visitor(table.createFence, "vkCreateFence");
+        visitor(table.allocateMemory, "vkAllocateMemory");
+        visitor(table.allocateDescriptorSets, "vkAllocateDescriptorSets");
+        visitor(table.allocateCommandBuffers, "vkAllocateCommandBuffers");
+        visitor(table.bindBufferMemory, "vkBindBufferMemory");
+        visitor(table.bindImageMemory, "vkBindImageMemory");
+        visitor(table.mapMemory, "vkMapMemory");
+        visitor(table.unmapMemory, "vkUnmapMemory");
+        visitor(table.freeMemory, "vkFreeMemory");
+        visitor(table.freeCommandBuffers, "vkFreeCommandBuffers");
+        visitor(table.resetDescriptorPool, "vkResetDescriptorPool");
+        visitor(table.destroyFence, "vkDestroyFence");
+        visitor(table.destroySemaphore, "vkDestroySemaphore");
+        visitor(table.destroyDescriptorPool, "vkDestroyDescriptorPool");
+        visitor(table.destroyDescriptorUpdateTemplate, "vkDestroyDescriptorUpdateTemplate");
+        visitor(table.destroySampler, "vkDestroySampler");
+        visitor(table.destroyFramebuffer, "vkDestroyFramebuffer");
+        visitor(table.destroyPipeline, "vkDestroyPipeline");
+        visitor(table.destroyPipelineLayout, "vkDestroyPipelineLayout");
+        visitor(table.destroyShaderModule, "vkDestroyShaderModule");
+        visitor(table.destroyDescriptorSetLayout, "vkDestroyDescriptorSetLayout");
+        visitor(table.destroyRenderPass, "vkDestroyRenderPass");
+        visitor(table.destroyImageView, "vkDestroyImageView");
+        visitor(table.destroyImage, "vkDestroyImage");
+        visitor(table.destroyBuffer, "vkDestroyBuffer");
+        visitor(table.destroySwapchainKHR, "vkDestroySwapchainKHR");
+        visitor(table.destroyCommandPool, "vkDestroyCommandPool");
+        visitor(table.destroyDevice, "vkDestroyDevice");
+        visitor(table.destroySurfaceKHR, "vkDestroySurfaceKHR");
+        visitor(table.destroyInstance, "vkDestroyInstance");
+        visitor(table.cmdCopyBuffer, "vkCmdCopyBuffer");
+        visitor(table.cmdCopyBufferToImage, "vkCmdCopyBufferToImage");
+        visitor(table.cmdPipelineBarrier, "vkCmdPipelineBarrier");
+        visitor(table.cmdBindPipeline, "vkCmdBindPipeline");
+        visitor(table.cmdDispatch, "vkCmdDispatch");
+        visitor(table.cmdDispatchIndirect, "vkCmdDispatchIndirect");
+        visitor(table.cmdBindDescriptorSets, "vkCmdBindDescriptorSets");
+        visitor(table.cmdPushConstants, "vkCmdPushConstants");
+      }
+
+      template<typename T, typename F>
+      static void setFunction(std::function<T>& function, F pointer) {
+        if (pointer != nullptr) {
+          function = pointer;
+        }
+      }
+
   };
 
 }
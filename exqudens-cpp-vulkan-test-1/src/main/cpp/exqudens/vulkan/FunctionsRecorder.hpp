@@ -0,0 +1,33 @@
+#pragma once
+
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "exqudens/vulkan/model/Functions.hpp"
+#include "exqudens/vulkan/model/FunctionCall.hpp"
+
+namespace exqudens::vulkan {
+
+  class FunctionsRecorder {
+
+    public:
+
+      virtual void startRecording() = 0;
+
+      virtual std::vector<FunctionCall> stopRecording() = 0;
+
+      virtual void writeFunctionCalls(std::ostream& stream, const std::vector<FunctionCall>& functionCalls) = 0;
+
+      virtual std::vector<FunctionCall> readFunctionCalls(std::istream& stream) = 0;
+
+      virtual std::vector<FunctionCall> replayFunctionCalls(
+          const std::vector<FunctionCall>& functionCalls,
+          const Functions& functions
+      ) = 0;
+
+      virtual ~FunctionsRecorder() = default;
+
+  };
+
+}
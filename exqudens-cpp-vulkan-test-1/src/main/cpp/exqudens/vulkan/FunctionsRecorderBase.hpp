@@ -0,0 +1,1028 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+
+#include "exqudens/vulkan/Macros.hpp"
+#include "exqudens/vulkan/Extensions.hpp"
+#include "exqudens/vulkan/FunctionsRecorder.hpp"
+#include "exqudens/vulkan/FunctionsProviderBase.hpp"
+
+namespace exqudens::vulkan {
+
+  // opt-in: mixed in next to a factory or context it captures every call made through the Functions table.
+  // arguments and results are kept in host byte order: scalars by value, handles as 64-bit ids,
+  // arrays with the element count taken from the uint32_t argument in front of them.
+  // the structs listed in 'isCapturedStruct' are stored deep, the arrays they point to follow them
+  // and the handles in them are remapped on replay, descriptor template data is stored with the template entries.
+  // pNext chains are stored with their structs when every entry is listed in 'visitStructureType'.
+  // a replay refuses other structs, chain entries and untyped data, those are not captured
+  class FunctionsRecorderBase:
+      virtual public FunctionsRecorder,
+      virtual public FunctionsProviderBase
+  {
+
+    protected:
+
+      enum class FunctionCallPhase {
+        ARGUMENTS,
+        RESULTS
+      };
+
+      // element counts of the pointer arguments, derived from the arguments in front of them
+      struct FunctionCallCounts {
+
+        bool countNext = false;
+        std::size_t count = 0;
+        std::size_t arrayCount = 0;
+        std::size_t outputCount = 1;
+        const std::map<uint64_t, std::vector<VkDescriptorUpdateTemplateEntry>>* descriptorUpdateTemplates = nullptr;
+        const std::vector<VkDescriptorUpdateTemplateEntry>* descriptorUpdateEntries = nullptr;
+
+      };
+
+      static constexpr char TRACE_MAGIC[8] = {'E', 'X', 'Q', 'V', 'K', 'T', 'R', '2'};
+      static constexpr uint32_t NULL_COUNT = UINT32_MAX;
+      static constexpr uint32_t UNCAPTURED_COUNT = UINT32_MAX - 1;
+      static constexpr uint32_t DESCRIPTOR_UPDATE_COUNT = UINT32_MAX - 2;
+
+      // guards the recorded calls and the templates, never held across a call into the table
+      std::mutex recordingMutex;
+      std::atomic<bool> recording = false;
+      std::chrono::steady_clock::time_point recordingStart = {};
+      std::vector<FunctionCall> recordedCalls = {};
+      // entries of the live templates by id, tracked outside of recording too
+      std::map<uint64_t, std::vector<VkDescriptorUpdateTemplateEntry>> descriptorUpdateTemplates = {};
+
+    public:
+
+      void startRecording() override {
+        try {
+          std::lock_guard<std::mutex> lock(recordingMutex);
+          recordedCalls.clear();
+          recordingStart = std::chrono::steady_clock::now();
+          recording = true;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      std::vector<FunctionCall> stopRecording() override {
+        try {
+          std::lock_guard<std::mutex> lock(recordingMutex);
+          recording = false;
+          std::vector<FunctionCall> values = std::move(recordedCalls);
+          recordedCalls.clear();
+          return values;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void writeFunctionCalls(std::ostream& stream, const std::vector<FunctionCall>& functionCalls) override {
+        try {
+          std::vector<std::string> names;
+          std::map<std::string, uint16_t> nameIndices;
+          for (const FunctionCall& functionCall : functionCalls) {
+            if (!nameIndices.contains(functionCall.name)) {
+              nameIndices[functionCall.name] = static_cast<uint16_t>(names.size());
+              names.emplace_back(functionCall.name);
+            }
+          }
+
+          stream.write(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+          writeStreamValue(stream, static_cast<uint32_t>(names.size()));
+          for (const std::string& name : names) {
+            writeStreamValue(stream, static_cast<uint16_t>(name.size()));
+            stream.write(name.data(), static_cast<std::streamsize>(name.size()));
+          }
+
+          writeStreamValue(stream, static_cast<uint64_t>(functionCalls.size()));
+          for (const FunctionCall& functionCall : functionCalls) {
+            writeStreamValue(stream, nameIndices[functionCall.name]);
+            writeStreamValue(stream, static_cast<int64_t>(functionCall.start.count()));
+            writeStreamValue(stream, static_cast<int64_t>(functionCall.duration.count()));
+            for (const std::vector<uint8_t>* bytes : {&functionCall.arguments, &functionCall.results}) {
+              writeStreamValue(stream, static_cast<uint32_t>(bytes->size()));
+              stream.write(reinterpret_cast<const char*>(bytes->data()), static_cast<std::streamsize>(bytes->size()));
+            }
+          }
+
+          if (!stream) {
+            throw std::runtime_error(CALL_INFO() + ": failed to write function calls!");
+          }
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      std::vector<FunctionCall> readFunctionCalls(std::istream& stream) override {
+        try {
+          char magic[sizeof(TRACE_MAGIC)] = {};
+          stream.read(magic, sizeof(magic));
+          if (!stream || std::memcmp(magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0) {
+            throw std::runtime_error(CALL_INFO() + ": failed to read function calls not a trace!");
+          }
+
+          std::vector<std::string> names;
+          names.resize(readStreamValue<uint32_t>(stream));
+          for (std::string& name : names) {
+            name.resize(readStreamValue<uint16_t>(stream));
+            readStreamBytes(stream, name.data(), name.size());
+          }
+
+          std::vector<FunctionCall> values;
+          values.resize(readStreamValue<uint64_t>(stream));
+          for (FunctionCall& value : values) {
+            uint16_t nameIndex = readStreamValue<uint16_t>(stream);
+            if (nameIndex >= names.size()) {
+              throw std::runtime_error(CALL_INFO() + ": failed to read function calls name index out of range!");
+            }
+            value.name = names[nameIndex];
+            value.start = std::chrono::nanoseconds(readStreamValue<int64_t>(stream));
+            value.duration = std::chrono::nanoseconds(readStreamValue<int64_t>(stream));
+            for (std::vector<uint8_t>* bytes : {&value.arguments, &value.results}) {
+              bytes->resize(readStreamValue<uint32_t>(stream));
+              readStreamBytes(stream, bytes->data(), bytes->size());
+            }
+          }
+          return values;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // drives the calls against the given table, a real one or a mock,
+      // handles returned by the table stand in for the recorded ones from then on
+      std::vector<FunctionCall> replayFunctionCalls(
+          const std::vector<FunctionCall>& functionCalls,
+          const Functions& functions
+      ) override {
+        try {
+          std::vector<FunctionCall> values;
+          values.reserve(functionCalls.size());
+          std::map<uint64_t, uint64_t> handles;
+          std::chrono::steady_clock::time_point replayStart = std::chrono::steady_clock::now();
+          for (const FunctionCall& functionCall : functionCalls) {
+            bool found = false;
+            forEachFunction(functions, [&](const auto& function, const std::string& name) {
+              if (found || name != functionCall.name) {
+                return;
+              }
+              found = true;
+              if (!function) {
+                throw std::runtime_error(CALL_INFO() + ": failed to replay '" + name + "' the entry is not set!");
+              }
+              values.emplace_back(replayFunction(function, functionCall, handles, replayStart));
+            });
+            if (!found) {
+              throw std::runtime_error(CALL_INFO() + ": failed to replay unknown function '" + functionCall.name + "'!");
+            }
+          }
+          return values;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+    protected:
+
+      Functions decorateFunctions(Functions value) override {
+        try {
+          value = FunctionsProviderBase::decorateFunctions(value);
+          forEachFunction(value, [this](auto& function, const std::string& name) {
+            recordFunction(function, name);
+          });
+          if (value.createDescriptorUpdateTemplate) {
+            value.createDescriptorUpdateTemplate = [this, target = value.createDescriptorUpdateTemplate](
+                VkDevice device,
+                const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo,
+                const VkAllocationCallbacks* pAllocator,
+                VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate
+            ) {
+              VkResult result = target(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+              if (result == VK_SUCCESS) {
+                std::lock_guard<std::mutex> lock(recordingMutex);
+                descriptorUpdateTemplates[encodeHandle(*pDescriptorUpdateTemplate)] = std::vector<VkDescriptorUpdateTemplateEntry>(
+                    pCreateInfo->pDescriptorUpdateEntries,
+                    pCreateInfo->pDescriptorUpdateEntries + pCreateInfo->descriptorUpdateEntryCount
+                );
+              }
+              return result;
+            };
+          }
+          if (value.destroyDescriptorUpdateTemplate) {
+            value.destroyDescriptorUpdateTemplate = [this, target = value.destroyDescriptorUpdateTemplate](
+                VkDevice device,
+                VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                const VkAllocationCallbacks* pAllocator
+            ) {
+              target(device, descriptorUpdateTemplate, pAllocator);
+              std::lock_guard<std::mutex> lock(recordingMutex);
+              descriptorUpdateTemplates.erase(encodeHandle(descriptorUpdateTemplate));
+            };
+          }
+          return value;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      template<typename R, typename... Args>
+      void recordFunction(std::function<R(Args...)>& function, const std::string& name) {
+        if (!function) {
+          return;
+        }
+        function = [this, target = function, name](Args... args) -> R {
+          if (!recording) {
+            return target(args...);
+          }
+          FunctionCall functionCall = {
+              .name = name,
+              .start = {},
+              .duration = {},
+              .arguments = {},
+              .results = {}
+          };
+          {
+            // template data is laid out by the entries looked up here
+            std::lock_guard<std::mutex> lock(recordingMutex);
+            FunctionCallCounts argumentCounts = {.descriptorUpdateTemplates = &descriptorUpdateTemplates};
+            (encodeArgument<Args>(functionCall.arguments, argumentCounts, FunctionCallPhase::ARGUMENTS, args), ...);
+          }
+          std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+          if constexpr (std::is_void_v<R>) {
+            target(args...);
+            functionCall.duration = std::chrono::steady_clock::now() - start;
+            FunctionCallCounts resultCounts = {};
+            (encodeArgument<Args>(functionCall.results, resultCounts, FunctionCallPhase::RESULTS, args), ...);
+            addRecordedCall(std::move(functionCall), start);
+          } else {
+            R result = target(args...);
+            functionCall.duration = std::chrono::steady_clock::now() - start;
+            FunctionCallCounts resultCounts = {};
+            (encodeArgument<Args>(functionCall.results, resultCounts, FunctionCallPhase::RESULTS, args), ...);
+            encodeValue(functionCall.results, result);
+            addRecordedCall(std::move(functionCall), start);
+            return result;
+          }
+        };
+      }
+
+      // a call that ends after 'stopRecording' is dropped
+      void addRecordedCall(FunctionCall&& functionCall, std::chrono::steady_clock::time_point start) {
+        std::lock_guard<std::mutex> lock(recordingMutex);
+        if (!recording) {
+          return;
+        }
+        functionCall.start = start - recordingStart;
+        recordedCalls.emplace_back(std::move(functionCall));
+      }
+
+      template<typename R, typename... Args>
+      static FunctionCall replayFunction(
+          const std::function<R(Args...)>& function,
+          const FunctionCall& functionCall,
+          std::map<uint64_t, uint64_t>& handles,
+          std::chrono::steady_clock::time_point replayStart
+      ) {
+        try {
+          std::deque<std::vector<uint8_t>> storage;
+          std::size_t offset = 0;
+          // braced initialization decodes the arguments left to right
+          std::tuple<Args...> arguments{decodeArgument<Args>(functionCall.arguments, offset, storage, handles)...};
+
+          FunctionCall value = {
+              .name = functionCall.name,
+              .start = {},
+              .duration = {},
+              .arguments = functionCall.arguments,
+              .results = {}
+          };
+          std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+          value.start = start - replayStart;
+          if constexpr (std::is_void_v<R>) {
+            std::apply(function, arguments);
+            value.duration = std::chrono::steady_clock::now() - start;
+            encodeResults<Args...>(value.results, arguments);
+          } else {
+            R result = std::apply(function, arguments);
+            value.duration = std::chrono::steady_clock::now() - start;
+            encodeResults<Args...>(value.results, arguments);
+            encodeValue(value.results, result);
+          }
+
+          std::size_t recordedOffset = 0;
+          std::size_t replayedOffset = 0;
+          (mapResult<Args>(functionCall.results, recordedOffset, value.results, replayedOffset, handles), ...);
+          if constexpr (isHandle<R>()) {
+            uint64_t recordedHandle = readValue<uint64_t>(functionCall.results, recordedOffset);
+            uint64_t replayedHandle = readValue<uint64_t>(value.results, replayedOffset);
+            handles[recordedHandle] = replayedHandle;
+          }
+          return value;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO() + ": failed to replay '" + functionCall.name + "'!"));
+        }
+      }
+
+      template<typename... Args>
+      static void encodeResults(std::vector<uint8_t>& out, std::tuple<Args...>& arguments) {
+        FunctionCallCounts counts = {};
+        std::apply([&out, &counts](Args... args) {
+          (encodeArgument<Args>(out, counts, FunctionCallPhase::RESULTS, args), ...);
+        }, arguments);
+      }
+
+      template<typename T>
+      static constexpr bool isHandle() {
+        if constexpr (std::is_pointer_v<T> && std::is_class_v<std::remove_pointer_t<T>>) {
+          // handles point to driver types that are never defined
+          return !requires { sizeof(std::remove_pointer_t<T>); };
+        } else {
+          return false;
+        }
+      }
+
+      template<typename E, typename... Types>
+      static constexpr bool isOneOf() {
+        return (std::is_same_v<E, Types> || ...);
+      }
+
+      // structs whose outward members are all listed in 'forEachStructMember'
+      template<typename E>
+      static constexpr bool isCapturedStruct() {
+        return isOneOf<
+            E,
+            VkBufferCopy,
+            VkBufferImageCopy,
+            VkMemoryBarrier,
+            VkBufferMemoryBarrier,
+            VkImageMemoryBarrier,
+            VkBufferCreateInfo,
+            VkImageCreateInfo,
+            VkImageViewCreateInfo,
+            VkMemoryAllocateInfo,
+            VkSamplerCreateInfo,
+            VkFenceCreateInfo,
+            VkSemaphoreCreateInfo,
+            VkCommandPoolCreateInfo,
+            VkCommandBufferAllocateInfo,
+            VkDescriptorPoolSize,
+            VkDescriptorPoolCreateInfo,
+            VkDescriptorSetAllocateInfo,
+            VkDescriptorSetLayoutBinding,
+            VkDescriptorSetLayoutCreateInfo,
+            VkDescriptorImageInfo,
+            VkDescriptorBufferInfo,
+            VkWriteDescriptorSet,
+            VkCopyDescriptorSet,
+            VkDescriptorUpdateTemplateEntry,
+            VkDescriptorUpdateTemplateCreateInfo,
+            VkShaderModuleCreateInfo,
+            VkPushConstantRange,
+            VkPipelineLayoutCreateInfo,
+            VkFramebufferCreateInfo,
+            VkSwapchainCreateInfoKHR,
+            VkApplicationInfo,
+            VkInstanceCreateInfo,
+            VkDeviceQueueCreateInfo,
+            VkPhysicalDeviceFeatures,
+            VkPhysicalDeviceFeatures2,
+            VkDeviceCreateInfo,
+            VkAttachmentDescription,
+            VkAttachmentReference,
+            VkSubpassDescription,
+            VkSubpassDependency,
+            VkRenderPassCreateInfo,
+            VkSpecializationMapEntry,
+            VkSpecializationInfo,
+            VkPipelineShaderStageCreateInfo,
+            VkVertexInputBindingDescription,
+            VkVertexInputAttributeDescription,
+            VkPipelineVertexInputStateCreateInfo,
+            VkPipelineInputAssemblyStateCreateInfo,
+            VkPipelineTessellationStateCreateInfo,
+            VkViewport,
+            VkRect2D,
+            VkPipelineViewportStateCreateInfo,
+            VkPipelineRasterizationStateCreateInfo,
+            VkPipelineMultisampleStateCreateInfo,
+            VkPipelineDepthStencilStateCreateInfo,
+            VkPipelineColorBlendAttachmentState,
+            VkPipelineColorBlendStateCreateInfo,
+            VkPipelineDynamicStateCreateInfo,
+            VkGraphicsPipelineCreateInfo,
+            VkComputePipelineCreateInfo,
+            VkPhysicalDeviceDescriptorIndexingFeatures,
+            VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT,
+            VkDescriptorSetLayoutBindingFlagsCreateInfo,
+            VkPipelineLibraryCreateInfoKHR,
+            VkGraphicsPipelineLibraryCreateInfoEXT
+        >();
+      }
+
+      // visits the pNext chain, the handle members and the pointer members with their element count, in declaration order,
+      // arrays the struct marks as unused are visited with a zero count, strings with their length
+      template<typename S, typename H, typename A, typename N>
+      static void forEachStructMember(S& value, H&& handle, A&& array, N&& next) {
+        using E = std::remove_const_t<S>;
+        if constexpr (requires { value.pNext; }) {
+          next(value.pNext);
+        }
+        if constexpr (std::is_same_v<E, VkBufferMemoryBarrier>) {
+          handle(value.buffer);
+        } else if constexpr (std::is_same_v<E, VkImageMemoryBarrier> || std::is_same_v<E, VkImageViewCreateInfo>) {
+          handle(value.image);
+        } else if constexpr (std::is_same_v<E, VkBufferCreateInfo> || std::is_same_v<E, VkImageCreateInfo>) {
+          array(value.pQueueFamilyIndices, value.sharingMode == VK_SHARING_MODE_CONCURRENT ? value.queueFamilyIndexCount : 0);
+        } else if constexpr (std::is_same_v<E, VkCommandBufferAllocateInfo>) {
+          handle(value.commandPool);
+        } else if constexpr (std::is_same_v<E, VkDescriptorPoolCreateInfo>) {
+          array(value.pPoolSizes, value.poolSizeCount);
+        } else if constexpr (std::is_same_v<E, VkDescriptorSetAllocateInfo>) {
+          handle(value.descriptorPool);
+          array(value.pSetLayouts, value.descriptorSetCount);
+        } else if constexpr (std::is_same_v<E, VkDescriptorSetLayoutBinding>) {
+          array(value.pImmutableSamplers, value.descriptorCount);
+        } else if constexpr (std::is_same_v<E, VkDescriptorSetLayoutCreateInfo>) {
+          array(value.pBindings, value.bindingCount);
+        } else if constexpr (std::is_same_v<E, VkDescriptorImageInfo>) {
+          handle(value.sampler);
+          handle(value.imageView);
+        } else if constexpr (std::is_same_v<E, VkDescriptorBufferInfo>) {
+          handle(value.buffer);
+        } else if constexpr (std::is_same_v<E, VkWriteDescriptorSet>) {
+          handle(value.dstSet);
+          // only the array that matches the descriptor type is read, the others may dangle
+          std::size_t imageCount = 0;
+          std::size_t bufferCount = 0;
+          std::size_t texelBufferCount = 0;
+          visitDescriptorType(value.descriptorType, [&](auto* element) {
+            using D = std::remove_pointer_t<decltype(element)>;
+            if constexpr (std::is_same_v<D, VkDescriptorImageInfo>) {
+              imageCount = value.descriptorCount;
+            } else if constexpr (std::is_same_v<D, VkDescriptorBufferInfo>) {
+              bufferCount = value.descriptorCount;
+            } else {
+              texelBufferCount = value.descriptorCount;
+            }
+          });
+          array(value.pImageInfo, imageCount);
+          array(value.pBufferInfo, bufferCount);
+          array(value.pTexelBufferView, texelBufferCount);
+        } else if constexpr (std::is_same_v<E, VkCopyDescriptorSet>) {
+          handle(value.srcSet);
+          handle(value.dstSet);
+        } else if constexpr (std::is_same_v<E, VkDescriptorUpdateTemplateCreateInfo>) {
+          array(value.pDescriptorUpdateEntries, value.descriptorUpdateEntryCount);
+          handle(value.descriptorSetLayout);
+          handle(value.pipelineLayout);
+        } else if constexpr (std::is_same_v<E, VkShaderModuleCreateInfo>) {
+          array(value.pCode, value.codeSize / sizeof(uint32_t));
+        } else if constexpr (std::is_same_v<E, VkPipelineLayoutCreateInfo>) {
+          array(value.pSetLayouts, value.setLayoutCount);
+          array(value.pPushConstantRanges, value.pushConstantRangeCount);
+        } else if constexpr (std::is_same_v<E, VkFramebufferCreateInfo>) {
+          handle(value.renderPass);
+          array(value.pAttachments, value.attachmentCount);
+        } else if constexpr (std::is_same_v<E, VkSwapchainCreateInfoKHR>) {
+          handle(value.surface);
+          array(value.pQueueFamilyIndices, value.imageSharingMode == VK_SHARING_MODE_CONCURRENT ? value.queueFamilyIndexCount : 0);
+          handle(value.oldSwapchain);
+        } else if constexpr (std::is_same_v<E, VkApplicationInfo>) {
+          array(value.pApplicationName, stringLength(value.pApplicationName));
+          array(value.pEngineName, stringLength(value.pEngineName));
+        } else if constexpr (std::is_same_v<E, VkInstanceCreateInfo>) {
+          array(value.pApplicationInfo, 1);
+          array(value.ppEnabledLayerNames, value.enabledLayerCount);
+          array(value.ppEnabledExtensionNames, value.enabledExtensionCount);
+        } else if constexpr (std::is_same_v<E, VkDeviceQueueCreateInfo>) {
+          array(value.pQueuePriorities, value.queueCount);
+        } else if constexpr (std::is_same_v<E, VkDeviceCreateInfo>) {
+          array(value.pQueueCreateInfos, value.queueCreateInfoCount);
+          array(value.ppEnabledLayerNames, value.enabledLayerCount);
+          array(value.ppEnabledExtensionNames, value.enabledExtensionCount);
+          array(value.pEnabledFeatures, 1);
+        } else if constexpr (std::is_same_v<E, VkSubpassDescription>) {
+          array(value.pInputAttachments, value.inputAttachmentCount);
+          array(value.pColorAttachments, value.colorAttachmentCount);
+          array(value.pResolveAttachments, value.colorAttachmentCount);
+          array(value.pDepthStencilAttachment, 1);
+          array(value.pPreserveAttachments, value.preserveAttachmentCount);
+        } else if constexpr (std::is_same_v<E, VkRenderPassCreateInfo>) {
+          array(value.pAttachments, value.attachmentCount);
+          array(value.pSubpasses, value.subpassCount);
+          array(value.pDependencies, value.dependencyCount);
+        } else if constexpr (std::is_same_v<E, VkSpecializationInfo>) {
+          array(value.pMapEntries, value.mapEntryCount);
+          array(value.pData, value.dataSize);
+        } else if constexpr (std::is_same_v<E, VkPipelineShaderStageCreateInfo>) {
+          handle(value.module);
+          array(value.pName, stringLength(value.pName));
+          array(value.pSpecializationInfo, 1);
+        } else if constexpr (std::is_same_v<E, VkPipelineVertexInputStateCreateInfo>) {
+          array(value.pVertexBindingDescriptions, value.vertexBindingDescriptionCount);
+          array(value.pVertexAttributeDescriptions, value.vertexAttributeDescriptionCount);
+        } else if constexpr (std::is_same_v<E, VkPipelineViewportStateCreateInfo>) {
+          array(value.pViewports, value.viewportCount);
+          array(value.pScissors, value.scissorCount);
+        } else if constexpr (std::is_same_v<E, VkPipelineMultisampleStateCreateInfo>) {
+          array(value.pSampleMask, (static_cast<std::size_t>(value.rasterizationSamples) + 31) / 32);
+        } else if constexpr (std::is_same_v<E, VkPipelineColorBlendStateCreateInfo>) {
+          array(value.pAttachments, value.attachmentCount);
+        } else if constexpr (std::is_same_v<E, VkPipelineDynamicStateCreateInfo>) {
+          array(value.pDynamicStates, value.dynamicStateCount);
+        } else if constexpr (std::is_same_v<E, VkGraphicsPipelineCreateInfo>) {
+          array(value.pStages, value.stageCount);
+          array(value.pVertexInputState, 1);
+          array(value.pInputAssemblyState, 1);
+          array(value.pTessellationState, 1);
+          array(value.pViewportState, 1);
+          array(value.pRasterizationState, 1);
+          array(value.pMultisampleState, 1);
+          array(value.pDepthStencilState, 1);
+          array(value.pColorBlendState, 1);
+          array(value.pDynamicState, 1);
+          handle(value.layout);
+          handle(value.renderPass);
+          handle(value.basePipelineHandle);
+        } else if constexpr (std::is_same_v<E, VkComputePipelineCreateInfo>) {
+          // the stage is held by value, its members are visited in place
+          forEachStructMember(value.stage, handle, array, next);
+          handle(value.layout);
+          handle(value.basePipelineHandle);
+        } else if constexpr (std::is_same_v<E, VkDescriptorSetLayoutBindingFlagsCreateInfo>) {
+          array(value.pBindingFlags, value.bindingCount);
+        } else if constexpr (std::is_same_v<E, VkPipelineLibraryCreateInfoKHR>) {
+          array(value.pLibraries, value.libraryCount);
+        }
+      }
+
+      static std::size_t stringLength(const char* value) {
+        return value == nullptr ? 0 : std::strlen(value);
+      }
+
+      // calls the visitor with a null pointer of the struct a chain entry of this type is,
+      // false for the types whose entries are not captured
+      template<typename V>
+      static bool visitStructureType(VkStructureType type, V&& visitor) {
+        if (type == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES) {
+          visitor(static_cast<VkPhysicalDeviceDescriptorIndexingFeatures*>(nullptr));
+        } else if (type == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT) {
+          visitor(static_cast<VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT*>(nullptr));
+        } else if (type == VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO) {
+          visitor(static_cast<VkDescriptorSetLayoutBindingFlagsCreateInfo*>(nullptr));
+        } else if (type == VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR) {
+          visitor(static_cast<VkPipelineLibraryCreateInfoKHR*>(nullptr));
+        } else if (type == VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT) {
+          visitor(static_cast<VkGraphicsPipelineLibraryCreateInfoEXT*>(nullptr));
+        } else {
+          return false;
+        }
+        return true;
+      }
+
+      // calls the visitor with a null pointer of the element type a descriptor of this type uses,
+      // false for the types whose data is not captured
+      template<typename V>
+      static bool visitDescriptorType(VkDescriptorType type, V&& visitor) {
+        switch (type) {
+          case VK_DESCRIPTOR_TYPE_SAMPLER:
+          case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+          case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+          case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+          case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+            visitor(static_cast<VkDescriptorImageInfo*>(nullptr));
+            return true;
+          case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+          case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+          case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+          case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+            visitor(static_cast<VkDescriptorBufferInfo*>(nullptr));
+            return true;
+          case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+          case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+            visitor(static_cast<VkBufferView*>(nullptr));
+            return true;
+          default:
+            return false;
+        }
+      }
+
+      template<typename E>
+      static constexpr std::size_t elementSize() {
+        if constexpr (std::is_void_v<E>) {
+          return 1;
+        } else if constexpr (isHandle<E>()) {
+          return sizeof(uint64_t);
+        } else {
+          return sizeof(E);
+        }
+      }
+
+      template<typename T>
+      static void encodeArgument(std::vector<uint8_t>& out, FunctionCallCounts& counts, FunctionCallPhase phase, T value) {
+        bool sized = counts.countNext;
+        std::size_t inputCount = sized ? counts.count : 1;
+        std::size_t outputCount = counts.outputCount;
+        counts.countNext = false;
+        counts.outputCount = 1;
+        if constexpr (std::is_same_v<T, const char*>) {
+          if (phase == FunctionCallPhase::ARGUMENTS) {
+            std::size_t size = value == nullptr ? 0 : std::strlen(value);
+            encodeArray(out, value, value == nullptr ? NULL_COUNT : static_cast<uint32_t>(size));
+          }
+        } else if constexpr (isHandle<T>() || std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+          if (phase == FunctionCallPhase::ARGUMENTS) {
+            encodeValue(out, value);
+          }
+          if constexpr (std::is_same_v<T, uint32_t>) {
+            counts.countNext = true;
+            counts.count = value;
+          }
+          if constexpr (std::is_same_v<T, VkDescriptorUpdateTemplate>) {
+            if (counts.descriptorUpdateTemplates != nullptr) {
+              auto entries = counts.descriptorUpdateTemplates->find(encodeHandle(value));
+              counts.descriptorUpdateEntries = entries != counts.descriptorUpdateTemplates->end() ? &entries->second : nullptr;
+            }
+          }
+        } else if constexpr (std::is_pointer_v<T> && std::is_const_v<std::remove_pointer_t<T>>) {
+          using E = std::remove_const_t<std::remove_pointer_t<T>>;
+          if constexpr (std::is_same_v<E, VkAllocationCallbacks>) {
+            // allocators belong to the recording process, outputs after them follow the input array
+            counts.outputCount = counts.arrayCount;
+          } else if constexpr (std::is_void_v<E>) {
+            // untyped data is captured with a size in front of it or as descriptor template data
+            if (phase == FunctionCallPhase::ARGUMENTS) {
+              if (value == nullptr) {
+                encodeValue(out, NULL_COUNT);
+              } else if (sized) {
+                encodeArray(out, value, static_cast<uint32_t>(inputCount));
+              } else if (counts.descriptorUpdateEntries != nullptr) {
+                encodeDescriptorUpdateData(out, *counts.descriptorUpdateEntries, value);
+              } else {
+                encodeValue(out, UNCAPTURED_COUNT);
+              }
+            }
+            counts.arrayCount = value != nullptr && sized ? inputCount : 0;
+          } else {
+            std::size_t count = value != nullptr ? inputCount : 0;
+            if (phase == FunctionCallPhase::ARGUMENTS) {
+              encodeArray(out, value, value != nullptr ? static_cast<uint32_t>(count) : NULL_COUNT);
+            }
+            counts.arrayCount = count;
+            if constexpr (std::is_same_v<E, VkDescriptorSetAllocateInfo>) {
+              counts.outputCount = value == nullptr ? 0 : value->descriptorSetCount;
+            } else if constexpr (std::is_same_v<E, VkCommandBufferAllocateInfo>) {
+              counts.outputCount = value == nullptr ? 0 : value->commandBufferCount;
+            }
+          }
+        } else if constexpr (std::is_pointer_v<T>) {
+          using E = std::remove_pointer_t<T>;
+          uint32_t count = value == nullptr ? NULL_COUNT : static_cast<uint32_t>(outputCount);
+          // captured outputs are stored like inputs too, the replay hands the driver the chain the caller set up
+          if (phase == FunctionCallPhase::RESULTS || std::is_same_v<E, uint32_t> || isCapturedStruct<E>()) {
+            encodeArray(out, static_cast<const E*>(value), count);
+          } else {
+            encodeValue(out, count);
+          }
+          if constexpr (std::is_same_v<E, uint32_t>) {
+            counts.outputCount = value == nullptr ? 0 : *value;
+          }
+        } else {
+          static_assert(std::is_pointer_v<T>, "unsupported function argument type");
+        }
+      }
+
+      template<typename E>
+      static void encodeArray(std::vector<uint8_t>& out, const E* values, uint32_t count) {
+        encodeValue(out, count);
+        if (values == nullptr || count == NULL_COUNT) {
+          return;
+        }
+        if constexpr (isHandle<E>()) {
+          for (uint32_t i = 0; i < count; i++) {
+            encodeValue(out, values[i]);
+          }
+        } else if constexpr (std::is_same_v<E, const char*>) {
+          for (uint32_t i = 0; i < count; i++) {
+            encodeArray(out, values[i], values[i] == nullptr ? NULL_COUNT : static_cast<uint32_t>(std::strlen(values[i])));
+          }
+        } else {
+          const uint8_t* bytes = reinterpret_cast<const uint8_t*>(values);
+          out.insert(out.end(), bytes, bytes + elementSize<E>() * count);
+        }
+        if constexpr (isCapturedStruct<E>()) {
+          // the chain and the arrays a struct points to follow all of its elements
+          for (uint32_t i = 0; i < count; i++) {
+            forEachStructMember(values[i], [](const auto&) {}, [&out](const auto& pointer, std::size_t size) {
+              encodeArray(out, pointer, pointer == nullptr ? NULL_COUNT : static_cast<uint32_t>(size));
+            }, [&out](const void* next) {
+              encodeNext(out, next);
+            });
+          }
+        }
+      }
+
+      // each entry behind its type, ended by a null count
+      static void encodeNext(std::vector<uint8_t>& out, const void* next) {
+        const VkBaseInStructure* value = static_cast<const VkBaseInStructure*>(next);
+        // messenger callbacks belong to the recording process, like allocators they are left out
+        while (value != nullptr && value->sType == VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT) {
+          value = value->pNext;
+        }
+        if (value == nullptr) {
+          encodeValue(out, NULL_COUNT);
+          return;
+        }
+        bool captured = visitStructureType(value->sType, [&out, value](auto* type) {
+          encodeValue(out, static_cast<uint32_t>(value->sType));
+          encodeArray(out, reinterpret_cast<const std::remove_pointer_t<decltype(type)>*>(value), 1);
+        });
+        if (!captured) {
+          encodeValue(out, UNCAPTURED_COUNT);
+        }
+      }
+
+      // the template entries first, then each descriptor as an array of one element
+      static void encodeDescriptorUpdateData(
+          std::vector<uint8_t>& out,
+          const std::vector<VkDescriptorUpdateTemplateEntry>& entries,
+          const void* data
+      ) {
+        for (const VkDescriptorUpdateTemplateEntry& entry : entries) {
+          if (!visitDescriptorType(entry.descriptorType, [](auto*) {})) {
+            encodeValue(out, UNCAPTURED_COUNT);
+            return;
+          }
+        }
+        encodeValue(out, DESCRIPTOR_UPDATE_COUNT);
+        encodeArray(out, entries.data(), static_cast<uint32_t>(entries.size()));
+        for (const VkDescriptorUpdateTemplateEntry& entry : entries) {
+          for (uint32_t i = 0; i < entry.descriptorCount; i++) {
+            const uint8_t* element = static_cast<const uint8_t*>(data) + entry.offset + entry.stride * i;
+            visitDescriptorType(entry.descriptorType, [&out, element](auto* type) {
+              encodeArray(out, reinterpret_cast<const std::remove_pointer_t<decltype(type)>*>(element), 1);
+            });
+          }
+        }
+      }
+
+      template<typename T>
+      static uint64_t encodeHandle(T value) {
+        return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value));
+      }
+
+      template<typename T>
+      static void encodeValue(std::vector<uint8_t>& out, const T& value) {
+        if constexpr (std::is_pointer_v<T>) {
+          // handles and entry points as 64-bit ids
+          encodeValue(out, encodeHandle(value));
+        } else {
+          const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+          out.insert(out.end(), bytes, bytes + sizeof(T));
+        }
+      }
+
+      template<typename T>
+      static T decodeArgument(
+          const std::vector<uint8_t>& in,
+          std::size_t& offset,
+          std::deque<std::vector<uint8_t>>& storage,
+          const std::map<uint64_t, uint64_t>& handles
+      ) {
+        if constexpr (std::is_same_v<T, const char*>) {
+          return decodeArray<char>(in, offset, storage, handles);
+        } else if constexpr (isHandle<T>()) {
+          return decodeHandle<T>(readValue<uint64_t>(in, offset), handles);
+        } else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+          return readValue<T>(in, offset);
+        } else if constexpr (std::is_pointer_v<T> && std::is_const_v<std::remove_pointer_t<T>>) {
+          using E = std::remove_const_t<std::remove_pointer_t<T>>;
+          if constexpr (std::is_same_v<E, VkAllocationCallbacks>) {
+            return nullptr;
+          } else {
+            return decodeArray<E>(in, offset, storage, handles);
+          }
+        } else if constexpr (isCapturedStruct<std::remove_pointer_t<T>>()) {
+          // the driver fills the copy of what the caller set up
+          return const_cast<T>(decodeArray<std::remove_pointer_t<T>>(in, offset, storage, handles));
+        } else {
+          using E = std::remove_pointer_t<T>;
+          uint32_t count = readValue<uint32_t>(in, offset);
+          if (count == NULL_COUNT) {
+            return nullptr;
+          }
+          if constexpr (requires (E e) { e.pNext; }) {
+            throw std::runtime_error(CALL_INFO() + ": failed to decode function call output pNext chain is not captured!");
+          }
+          std::vector<uint8_t>& bytes = storage.emplace_back(std::max<std::size_t>(elementSize<E>() * count, 1), 0);
+          if constexpr (std::is_same_v<E, uint32_t>) {
+            readBytes(in, offset, bytes.data(), sizeof(E) * count);
+          }
+          return reinterpret_cast<T>(bytes.data());
+        }
+      }
+
+      template<typename E>
+      static const E* decodeArray(
+          const std::vector<uint8_t>& in,
+          std::size_t& offset,
+          std::deque<std::vector<uint8_t>>& storage,
+          const std::map<uint64_t, uint64_t>& handles
+      ) {
+        uint32_t count = readValue<uint32_t>(in, offset);
+        if (count == NULL_COUNT) {
+          return nullptr;
+        }
+        if constexpr (std::is_void_v<E>) {
+          if (count == DESCRIPTOR_UPDATE_COUNT) {
+            return decodeDescriptorUpdateData(in, offset, storage, handles);
+          }
+        }
+        if (count == UNCAPTURED_COUNT || count == DESCRIPTOR_UPDATE_COUNT) {
+          throw std::runtime_error(CALL_INFO() + ": failed to decode function call data is not captured!");
+        }
+        if constexpr (std::is_class_v<E> && !isCapturedStruct<E>()) {
+          throw std::runtime_error(CALL_INFO() + ": failed to decode function call struct is not captured!");
+        }
+        // strings keep a terminator behind them
+        std::size_t size = elementSize<E>() * count + (std::is_same_v<E, char> ? 1 : 0);
+        std::vector<uint8_t>& bytes = storage.emplace_back(std::max<std::size_t>(size, 1), 0);
+        if constexpr (isHandle<E>()) {
+          E* values = reinterpret_cast<E*>(bytes.data());
+          for (uint32_t i = 0; i < count; i++) {
+            values[i] = decodeHandle<E>(readValue<uint64_t>(in, offset), handles);
+          }
+        } else if constexpr (std::is_same_v<E, const char*>) {
+          E* values = reinterpret_cast<E*>(bytes.data());
+          for (uint32_t i = 0; i < count; i++) {
+            values[i] = decodeArray<char>(in, offset, storage, handles);
+          }
+        } else {
+          readBytes(in, offset, bytes.data(), elementSize<E>() * count);
+        }
+        if constexpr (std::is_class_v<E>) {
+          E* values = reinterpret_cast<E*>(bytes.data());
+          for (uint32_t i = 0; i < count; i++) {
+            forEachStructMember(values[i], [&handles](auto& handle) {
+              handle = decodeHandle<std::remove_reference_t<decltype(handle)>>(encodeHandle(handle), handles);
+            }, [&](auto& pointer, std::size_t) {
+              using P = std::remove_const_t<std::remove_pointer_t<std::remove_reference_t<decltype(pointer)>>>;
+              pointer = decodeArray<P>(in, offset, storage, handles);
+            }, [&](auto& next) {
+              next = const_cast<std::remove_reference_t<decltype(next)>>(decodeNext(in, offset, storage, handles));
+            });
+          }
+        }
+        return reinterpret_cast<const E*>(bytes.data());
+      }
+
+      static const void* decodeNext(
+          const std::vector<uint8_t>& in,
+          std::size_t& offset,
+          std::deque<std::vector<uint8_t>>& storage,
+          const std::map<uint64_t, uint64_t>& handles
+      ) {
+        uint32_t type = readValue<uint32_t>(in, offset);
+        if (type == NULL_COUNT) {
+          return nullptr;
+        }
+        const void* value = nullptr;
+        bool captured = type != UNCAPTURED_COUNT && visitStructureType(static_cast<VkStructureType>(type), [&](auto* entry) {
+          value = decodeArray<std::remove_pointer_t<decltype(entry)>>(in, offset, storage, handles);
+        });
+        if (!captured) {
+          throw std::runtime_error(CALL_INFO() + ": failed to decode function call pNext chain is not captured!");
+        }
+        return value;
+      }
+
+      // rebuilds the data at the offsets and strides of the recorded template entries
+      static const void* decodeDescriptorUpdateData(
+          const std::vector<uint8_t>& in,
+          std::size_t& offset,
+          std::deque<std::vector<uint8_t>>& storage,
+          const std::map<uint64_t, uint64_t>& handles
+      ) {
+        std::size_t entriesOffset = offset;
+        uint32_t entryCount = readValue<uint32_t>(in, entriesOffset);
+        const VkDescriptorUpdateTemplateEntry* entries = decodeArray<VkDescriptorUpdateTemplateEntry>(in, offset, storage, handles);
+        std::size_t size = 1;
+        for (uint32_t i = 0; i < entryCount; i++) {
+          visitDescriptorType(entries[i].descriptorType, [&size, &entry = entries[i]](auto* type) {
+            if (entry.descriptorCount > 0) {
+              std::size_t end = entry.offset + entry.stride * (entry.descriptorCount - 1) + sizeof(*type);
+              size = std::max(size, end);
+            }
+          });
+        }
+        std::vector<uint8_t>& bytes = storage.emplace_back(size, 0);
+        for (uint32_t i = 0; i < entryCount; i++) {
+          for (uint32_t j = 0; j < entries[i].descriptorCount; j++) {
+            uint8_t* element = bytes.data() + entries[i].offset + entries[i].stride * j;
+            visitDescriptorType(entries[i].descriptorType, [&, element](auto* type) {
+              using D = std::remove_pointer_t<decltype(type)>;
+              const D* value = decodeArray<D>(in, offset, storage, handles);
+              if (value == nullptr) {
+                throw std::runtime_error(CALL_INFO() + ": failed to decode function call descriptor is missing!");
+              }
+              std::memcpy(element, value, sizeof(D));
+            });
+          }
+        }
+        return bytes.data();
+      }
+
+      template<typename T>
+      static T decodeHandle(uint64_t id, const std::map<uint64_t, uint64_t>& handles) {
+        auto mapped = handles.find(id);
+        return reinterpret_cast<T>(static_cast<uintptr_t>(mapped != handles.end() ? mapped->second : id));
+      }
+
+      // pairs the handles a recorded call returned with the ones returned on replay
+      template<typename T>
+      static void mapResult(
+          const std::vector<uint8_t>& recorded,
+          std::size_t& recordedOffset,
+          const std::vector<uint8_t>& replayed,
+          std::size_t& replayedOffset,
+          std::map<uint64_t, uint64_t>& handles
+      ) {
+        if constexpr (std::is_pointer_v<T> && isCapturedStruct<std::remove_pointer_t<T>>()) {
+          // the chains behind captured outputs are stepped over by decoding them
+          std::deque<std::vector<uint8_t>> storage;
+          decodeArray<std::remove_pointer_t<T>>(recorded, recordedOffset, storage, handles);
+          decodeArray<std::remove_pointer_t<T>>(replayed, replayedOffset, storage, handles);
+        } else if constexpr (std::is_pointer_v<T> && !std::is_const_v<std::remove_pointer_t<T>> && !isHandle<T>()) {
+          using E = std::remove_pointer_t<T>;
+          uint32_t recordedCount = readValue<uint32_t>(recorded, recordedOffset);
+          uint32_t replayedCount = readValue<uint32_t>(replayed, replayedOffset);
+          recordedCount = recordedCount == NULL_COUNT ? 0 : recordedCount;
+          replayedCount = replayedCount == NULL_COUNT ? 0 : replayedCount;
+          if constexpr (isHandle<E>()) {
+            for (uint32_t i = 0; i < std::max(recordedCount, replayedCount); i++) {
+              uint64_t recordedHandle = i < recordedCount ? readValue<uint64_t>(recorded, recordedOffset) : 0;
+              uint64_t replayedHandle = i < replayedCount ? readValue<uint64_t>(replayed, replayedOffset) : 0;
+              if (i < recordedCount && i < replayedCount) {
+                handles[recordedHandle] = replayedHandle;
+              }
+            }
+          } else {
+            recordedOffset += elementSize<E>() * recordedCount;
+            replayedOffset += elementSize<E>() * replayedCount;
+          }
+        }
+      }
+
+      static void readBytes(const std::vector<uint8_t>& in, std::size_t& offset, void* data, std::size_t size) {
+        if (offset + size > in.size()) {
+          throw std::runtime_error(CALL_INFO() + ": failed to decode function call data is truncated!");
+        }
+        if (size > 0) {
+          std::memcpy(data, in.data() + offset, size);
+        }
+        offset += size;
+      }
+
+      template<typename T>
+      static T readValue(const std::vector<uint8_t>& in, std::size_t& offset) {
+        T value;
+        readBytes(in, offset, &value, sizeof(T));
+        return value;
+      }
+
+      template<typename T>
+      static void writeStreamValue(std::ostream& stream, const T& value) {
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+      }
+
+      template<typename T>
+      static T readStreamValue(std::istream& stream) {
+        T value;
+        readStreamBytes(stream, &value, sizeof(T));
+        return value;
+      }
+
+      static void readStreamBytes(std::istream& stream, void* data, std::size_t size) {
+        stream.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+        if (!stream) {
+          throw std::runtime_error(CALL_INFO() + ": failed to read function calls stream is truncated!");
+        }
+      }
+
+  };
+
+}
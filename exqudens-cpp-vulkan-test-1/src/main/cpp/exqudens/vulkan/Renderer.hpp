@@ -1,7 +1,12 @@
 #pragma once
 
+#include <vector>
+
 #include <vulkan/vulkan.h>
 
+#include "exqudens/vulkan/model/Device.hpp"
+#include "exqudens/vulkan/model/WriteDescriptorSet.hpp"
+
 namespace exqudens::vulkan {
 
   class Renderer {
@@ -57,6 +62,47 @@ namespace exqudens::vulkan {
           VkImageLayout newLayout
       ) = 0;
 
+      virtual void cmdDispatch(
+          VkCommandBuffer& commandBuffer,
+          VkPipeline& pipeline,
+          uint32_t groupCountX,
+          uint32_t groupCountY,
+          uint32_t groupCountZ
+      ) = 0;
+
+      virtual void cmdDispatchIndirect(
+          VkCommandBuffer& commandBuffer,
+          VkPipeline& pipeline,
+          VkBuffer& buffer,
+          VkDeviceSize offset
+      ) = 0;
+
+      virtual void cmdBindDescriptorSets(
+          VkCommandBuffer& commandBuffer,
+          VkPipelineBindPoint pipelineBindPoint,
+          VkPipelineLayout& pipelineLayout,
+          uint32_t firstSet,
+          const std::vector<VkDescriptorSet>& descriptorSets
+      ) = 0;
+
+      virtual void cmdPushConstants(
+          VkCommandBuffer& commandBuffer,
+          VkPipelineLayout& pipelineLayout,
+          VkShaderStageFlags stageFlags,
+          uint32_t offset,
+          uint32_t size,
+          const void* values
+      ) = 0;
+
+      virtual void cmdPushDescriptorSet(
+          Device& device,
+          VkCommandBuffer& commandBuffer,
+          VkPipelineBindPoint pipelineBindPoint,
+          VkPipelineLayout& pipelineLayout,
+          uint32_t set,
+          const std::vector<WriteDescriptorSet>& writeDescriptorSets
+      ) = 0;
+
   };
 
 }
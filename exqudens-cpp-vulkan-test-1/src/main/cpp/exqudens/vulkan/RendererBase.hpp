@@ -1,13 +1,16 @@
 #pragma once
 
 #include <cstring>
+#include <vector>
 
 #include "exqudens/vulkan/Renderer.hpp"
 #include "exqudens/vulkan/FunctionsProviderBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 
 namespace exqudens::vulkan {
 
-  class RendererBase:
+  template<typename Dispatch>
+  class BasicRendererBase:
       virtual public Renderer,
       virtual public FunctionsProviderBase
   {
@@ -38,11 +41,11 @@ namespace exqudens::vulkan {
       ) override {
         try {
           void* dst;
-          if (functions().mapMemory(device, memory, offset, size, flags, &dst) != VK_SUCCESS) {
+          if (Dispatch::functions(*this).mapMemory(device, memory, offset, size, flags, &dst) != VK_SUCCESS) {
             throw std::runtime_error(CALL_INFO() + ": failed to map memory!");
           }
           std::memcpy(dst, data, (std::size_t) size);
-          functions().unmapMemory(device, memory);
+          Dispatch::functions(*this).unmapMemory(device, memory);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -59,7 +62,7 @@ namespace exqudens::vulkan {
               .size = size
           };
 
-          functions().cmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
+          Dispatch::functions(*this).cmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, 1, &copyRegion);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -109,7 +112,7 @@ namespace exqudens::vulkan {
               }
           };
 
-          functions().cmdCopyBufferToImage(
+          Dispatch::functions(*this).cmdCopyBufferToImage(
               commandBuffer,
               buffer,
               image,
@@ -178,7 +181,7 @@ namespace exqudens::vulkan {
             throw std::invalid_argument(CALL_INFO() + ": unsupported layout transition!");
           }
 
-          functions().cmdPipelineBarrier(
+          Dispatch::functions(*this).cmdPipelineBarrier(
               commandBuffer,
               sourceStage, destinationStage,
               0,
@@ -191,6 +194,118 @@ namespace exqudens::vulkan {
         }
       }
 
+      void cmdDispatch(
+          VkCommandBuffer& commandBuffer,
+          VkPipeline& pipeline,
+          uint32_t groupCountX,
+          uint32_t groupCountY,
+          uint32_t groupCountZ
+      ) override {
+        try {
+          Dispatch::functions(*this).cmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+          Dispatch::functions(*this).cmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void cmdDispatchIndirect(
+          VkCommandBuffer& commandBuffer,
+          VkPipeline& pipeline,
+          VkBuffer& buffer,
+          VkDeviceSize offset
+      ) override {
+        try {
+          Dispatch::functions(*this).cmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+          Dispatch::functions(*this).cmdDispatchIndirect(commandBuffer, buffer, offset);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void cmdBindDescriptorSets(
+          VkCommandBuffer& commandBuffer,
+          VkPipelineBindPoint pipelineBindPoint,
+          VkPipelineLayout& pipelineLayout,
+          uint32_t firstSet,
+          const std::vector<VkDescriptorSet>& descriptorSets
+      ) override {
+        try {
+          Dispatch::functions(*this).cmdBindDescriptorSets(
+              commandBuffer,
+              pipelineBindPoint,
+              pipelineLayout,
+              firstSet,
+              static_cast<uint32_t>(descriptorSets.size()),
+              descriptorSets.data(),
+              0,
+              nullptr
+          );
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void cmdPushConstants(
+          VkCommandBuffer& commandBuffer,
+          VkPipelineLayout& pipelineLayout,
+          VkShaderStageFlags stageFlags,
+          uint32_t offset,
+          uint32_t size,
+          const void* values
+      ) override {
+        try {
+          Dispatch::functions(*this).cmdPushConstants(commandBuffer, pipelineLayout, stageFlags, offset, size, values);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void cmdPushDescriptorSet(
+          Device& device,
+          VkCommandBuffer& commandBuffer,
+          VkPipelineBindPoint pipelineBindPoint,
+          VkPipelineLayout& pipelineLayout,
+          uint32_t set,
+          const std::vector<WriteDescriptorSet>& writeDescriptorSets
+      ) override {
+        try {
+          if (device.functions.cmdPushDescriptorSetKHR == nullptr) {
+            throw std::runtime_error(CALL_INFO() + ": '" + std::string(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME) + "' requested, but not available!");
+          }
+
+          std::vector<VkWriteDescriptorSet> writes;
+          writes.reserve(writeDescriptorSets.size());
+          for (const WriteDescriptorSet& write : writeDescriptorSets) {
+            writes.emplace_back(VkWriteDescriptorSet {
+                .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                .pNext = nullptr,
+                .dstSet = nullptr,
+                .dstBinding = write.dstBinding,
+                .dstArrayElement = write.dstArrayElement,
+                .descriptorCount = write.descriptorCount,
+                .descriptorType = write.descriptorType,
+                .pImageInfo = write.imageInfo.empty() ? nullptr : write.imageInfo.data(),
+                .pBufferInfo = write.bufferInfo.empty() ? nullptr : write.bufferInfo.data(),
+                .pTexelBufferView = write.texelBufferView.empty() ? nullptr : write.texelBufferView.data()
+            });
+          }
+
+          device.functions.cmdPushDescriptorSetKHR(
+              commandBuffer,
+              pipelineBindPoint,
+              pipelineLayout,
+              set,
+              static_cast<uint32_t>(writes.size()),
+              writes.data()
+          );
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
   };
 
+  using RendererBase = BasicRendererBase<FunctionsDispatch>;
+
 }
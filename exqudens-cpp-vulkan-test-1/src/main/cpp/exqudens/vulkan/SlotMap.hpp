@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include <stdexcept>
+
+#include "exqudens/vulkan/Macros.hpp"
+
+namespace exqudens::vulkan {
+
+  // values are kept dense and addressed by generation-tagged handles:
+  // the low 32 bits pick the slot, the high 32 bits carry the slot generation,
+  // so the handle of an erased value never resolves again, even after its slot is reused
+  template<typename T>
+  class SlotMap {
+
+    public:
+
+      static constexpr uint64_t NULL_HANDLE = 0;
+
+    private:
+
+      static constexpr uint32_t NO_INDEX = std::numeric_limits<uint32_t>::max();
+
+      struct Slot {
+
+        uint32_t generation;
+        uint32_t index; // dense index while occupied, next free slot while free
+
+      };
+
+      std::vector<Slot> slots = {};
+      std::vector<T> values = {};
+      std::vector<uint32_t> valueSlots = {};
+      uint32_t freeSlot = NO_INDEX;
+
+    public:
+
+      uint64_t insert(T value) {
+        try {
+          uint32_t slotIndex = freeSlot;
+          if (slotIndex == NO_INDEX) {
+            if (slots.size() >= NO_INDEX) {
+              throw std::runtime_error(CALL_INFO() + ": failed to insert value no free slots!");
+            }
+            slotIndex = static_cast<uint32_t>(slots.size());
+            // generations start at 1 so a zero handle never resolves
+            slots.emplace_back(Slot {.generation = 1, .index = NO_INDEX});
+          } else {
+            freeSlot = slots[slotIndex].index;
+          }
+          slots[slotIndex].index = static_cast<uint32_t>(values.size());
+          values.emplace_back(std::move(value));
+          valueSlots.emplace_back(slotIndex);
+          return toHandle(slotIndex, slots[slotIndex].generation);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      bool contains(uint64_t handle) const {
+        return findIndex(handle) != NO_INDEX;
+      }
+
+      T* find(uint64_t handle) {
+        uint32_t index = findIndex(handle);
+        return index == NO_INDEX ? nullptr : &values[index];
+      }
+
+      const T* find(uint64_t handle) const {
+        uint32_t index = findIndex(handle);
+        return index == NO_INDEX ? nullptr : &values[index];
+      }
+
+      T& at(uint64_t handle) {
+        T* value = find(handle);
+        if (value == nullptr) {
+          throw std::runtime_error(CALL_INFO() + ": failed to find value stale or unknown handle: " + std::to_string(handle) + "!");
+        }
+        return *value;
+      }
+
+      // the last value moves into the erased position, handles of other values stay valid
+      bool erase(uint64_t handle) {
+        uint32_t index = findIndex(handle);
+        if (index == NO_INDEX) {
+          return false;
+        }
+        uint32_t slotIndex = valueSlots[index];
+        uint32_t lastIndex = static_cast<uint32_t>(values.size() - 1);
+        if (index != lastIndex) {
+          values[index] = std::move(values[lastIndex]);
+          valueSlots[index] = valueSlots[lastIndex];
+          slots[valueSlots[index]].index = index;
+        }
+        values.pop_back();
+        valueSlots.pop_back();
+        releaseSlot(slotIndex);
+        return true;
+      }
+
+      void clear() {
+        for (uint32_t slotIndex : valueSlots) {
+          releaseSlot(slotIndex);
+        }
+        values.clear();
+        valueSlots.clear();
+      }
+
+      void reserve(std::size_t size) {
+        slots.reserve(size);
+        values.reserve(size);
+        valueSlots.reserve(size);
+      }
+
+      std::size_t size() const {
+        return values.size();
+      }
+
+      bool empty() const {
+        return values.empty();
+      }
+
+      T& back() {
+        return values.back();
+      }
+
+      // handle of the value at a dense position, in the order of begin() .. end()
+      uint64_t handle(std::size_t index) const {
+        uint32_t slotIndex = valueSlots.at(index);
+        return toHandle(slotIndex, slots[slotIndex].generation);
+      }
+
+      typename std::vector<T>::iterator begin() {
+        return values.begin();
+      }
+
+      typename std::vector<T>::iterator end() {
+        return values.end();
+      }
+
+      typename std::vector<T>::const_iterator begin() const {
+        return values.begin();
+      }
+
+      typename std::vector<T>::const_iterator end() const {
+        return values.end();
+      }
+
+    private:
+
+      static uint64_t toHandle(uint32_t slotIndex, uint32_t generation) {
+        return (static_cast<uint64_t>(generation) << 32) | slotIndex;
+      }
+
+      uint32_t findIndex(uint64_t handle) const {
+        uint32_t slotIndex = static_cast<uint32_t>(handle);
+        uint32_t generation = static_cast<uint32_t>(handle >> 32);
+        if (slotIndex >= slots.size() || slots[slotIndex].generation != generation) {
+          return NO_INDEX;
+        }
+        uint32_t index = slots[slotIndex].index;
+        // a free slot links to the next free one instead of a value
+        if (index >= valueSlots.size() || valueSlots[index] != slotIndex) {
+          return NO_INDEX;
+        }
+        return index;
+      }
+
+      void releaseSlot(uint32_t slotIndex) {
+        Slot& slot = slots[slotIndex];
+        slot.generation = slot.generation == std::numeric_limits<uint32_t>::max() ? 1 : slot.generation + 1;
+        slot.index = freeSlot;
+        freeSlot = slotIndex;
+      }
+
+  };
+
+}
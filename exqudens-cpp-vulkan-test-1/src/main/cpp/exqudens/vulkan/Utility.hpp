@@ -11,6 +11,7 @@
 #include "exqudens/vulkan/Logger.hpp"
 #include "exqudens/vulkan/model/QueueFamilyIndexInfo.hpp"
 #include "exqudens/vulkan/model/SwapChainSupportDetails.hpp"
+#include "exqudens/vulkan/model/PresentPolicy.hpp"
 
 namespace exqudens::vulkan {
 
@@ -65,6 +66,16 @@ namespace exqudens::vulkan {
       virtual VkPresentModeKHR chooseSwapPresentMode(
           const std::vector<VkPresentModeKHR>& availablePresentModes
       ) = 0;
+      virtual VkPresentModeKHR chooseSwapPresentMode(
+          const std::vector<VkPresentModeKHR>& availablePresentModes,
+          const PresentPolicy& presentPolicy
+      ) = 0;
+
+      virtual uint32_t chooseSwapImageCount(
+          const VkSurfaceCapabilitiesKHR& capabilities,
+          const PresentPolicy& presentPolicy,
+          VkPresentModeKHR presentMode
+      ) = 0;
 
       virtual VkExtent2D chooseSwapExtent(
           VkSurfaceCapabilitiesKHR& capabilities,
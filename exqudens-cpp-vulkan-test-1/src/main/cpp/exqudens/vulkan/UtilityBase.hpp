@@ -1,9 +1,13 @@
 #pragma once
 
 #include <cstdlib>
+#include <algorithm>
 #include <set>
 #include <fstream>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
 
 #include "exqudens/vulkan/Macros.hpp"
 #include "exqudens/vulkan/Utility.hpp"
@@ -82,13 +86,182 @@ namespace exqudens::vulkan {
         }
       }
 
+      void populateDebugMessengerCreateInfo(VkDebugUtilsMessengerCreateInfoEXT& object, Logger& logger) override {
+        try {
+          object = {};
+          object.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
+          object.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT
+              | VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT
+              | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+          object.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT
+              | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT
+              | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+          object.pfnUserCallback = &Logger::call;
+          object.pUserData = &logger;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      VkSurfaceFormatKHR chooseSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& availableFormats) override {
+        try {
+          for (const auto& availableFormat : availableFormats) {
+            if (availableFormat.format == VK_FORMAT_B8G8R8A8_SRGB && availableFormat.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR) {
+              return availableFormat;
+            }
+          }
+          return availableFormats[0];
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      VkPresentModeKHR chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& availablePresentModes) override {
+        try {
+          for (const auto& availablePresentMode : availablePresentModes) {
+            if (availablePresentMode == VK_PRESENT_MODE_MAILBOX_KHR) {
+              return availablePresentMode;
+            }
+          }
+          return VK_PRESENT_MODE_FIFO_KHR;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      VkPresentModeKHR chooseSwapPresentMode(
+          const std::vector<VkPresentModeKHR>& availablePresentModes,
+          const PresentPolicy& presentPolicy
+      ) override {
+        try {
+          std::vector<VkPresentModeKHR> preferredPresentModes;
+          if (presentPolicy.mode == PresentPolicyMode::DEFAULT) {
+            preferredPresentModes = {VK_PRESENT_MODE_MAILBOX_KHR};
+          } else if (presentPolicy.mode == PresentPolicyMode::LOWEST_LATENCY) {
+            preferredPresentModes = {VK_PRESENT_MODE_MAILBOX_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR};
+          } else if (presentPolicy.mode == PresentPolicyMode::POWER_SAVING) {
+            preferredPresentModes = {VK_PRESENT_MODE_FIFO_RELAXED_KHR};
+          }
+          for (const VkPresentModeKHR& preferredPresentMode : preferredPresentModes) {
+            if (std::find(availablePresentModes.begin(), availablePresentModes.end(), preferredPresentMode) != availablePresentModes.end()) {
+              return preferredPresentMode;
+            }
+          }
+          // fifo is the only mode every surface supports
+          return VK_PRESENT_MODE_FIFO_KHR;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      uint32_t chooseSwapImageCount(
+          const VkSurfaceCapabilitiesKHR& capabilities,
+          const PresentPolicy& presentPolicy,
+          VkPresentModeKHR presentMode
+      ) override {
+        try {
+          uint32_t imageCount = presentPolicy.minImageCount;
+          if (imageCount == 0) {
+            // the default, mailbox and smooth fifo keep a spare image, immediate and power saving queue as little as possible
+            bool spareImage = presentPolicy.mode == PresentPolicyMode::DEFAULT
+                || presentMode == VK_PRESENT_MODE_MAILBOX_KHR
+                || (presentMode == VK_PRESENT_MODE_FIFO_KHR && presentPolicy.mode == PresentPolicyMode::SMOOTH);
+            imageCount = capabilities.minImageCount + (spareImage ? 1 : 0);
+          }
+          imageCount = std::max(imageCount, capabilities.minImageCount);
+          if (capabilities.maxImageCount > 0 && imageCount > capabilities.maxImageCount) {
+            imageCount = capabilities.maxImageCount;
+          }
+          return imageCount;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      VkExtent2D chooseSwapExtent(
+          VkSurfaceCapabilitiesKHR& capabilities,
+          const uint32_t& width,
+          const uint32_t& height
+      ) override {
+        try {
+          if (capabilities.currentExtent.width != UINT32_MAX) {
+            return capabilities.currentExtent;
+          } else {
+            VkExtent2D actualExtent = {
+                static_cast<uint32_t>(width),
+                static_cast<uint32_t>(height)
+            };
+            actualExtent.width = std::clamp(actualExtent.width, capabilities.minImageExtent.width, capabilities.maxImageExtent.width);
+            actualExtent.height = std::clamp(actualExtent.height, capabilities.minImageExtent.height, capabilities.maxImageExtent.height);
+            return actualExtent;
+          }
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      VkFormat findDepthFormat(VkPhysicalDevice& physicalDevice) override {
+        try {
+          return findSupportedFormat(
+              physicalDevice,
+              {VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT},
+              VK_IMAGE_TILING_OPTIMAL,
+              VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT
+          );
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+    protected:
+
+      // cache keys are compared byte for byte, a matching key is a matching input
+      template <typename T>
+      void keyCombine(std::string& key, const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+      }
+
+      void keyCombine(std::string& key, const std::string& value) {
+        keyCombine(key, value.size());
+        key.append(value);
+      }
+
+      template <typename T>
+      void keyCombine(std::string& key, std::span<const T> values) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        keyCombine(key, values.size());
+        key.append(reinterpret_cast<const char*>(values.data()), values.size_bytes());
+      }
+
+      // render passes unknown to the render pass factory are only compatible with themselves
+      virtual std::string getRenderPassKey(const VkRenderPass& renderPass) {
+        try {
+          std::string key = {};
+          keyCombine(key, renderPass);
+          return key;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  // the helpers that query the driver, they dispatch the way the factories that compose them do
+  template<typename Dispatch>
+  class BasicUtilityBase:
+      virtual public UtilityBase
+  {
+
+    public:
+
       bool checkValidationLayerSupport(const std::vector<const char*>& validationLayers) override {
         try {
           uint32_t layerCount;
-          functions().enumerateInstanceLayerProperties(&layerCount, nullptr);
+          Dispatch::functions(*this).enumerateInstanceLayerProperties(&layerCount, nullptr);
 
           std::vector<VkLayerProperties> availableLayers(layerCount);
-          functions().enumerateInstanceLayerProperties(&layerCount, availableLayers.data());
+          Dispatch::functions(*this).enumerateInstanceLayerProperties(&layerCount, availableLayers.data());
 
           for (const std::string& layerName: validationLayers) {
             bool layerFound = false;
@@ -111,23 +284,6 @@ namespace exqudens::vulkan {
         }
       }
 
-      void populateDebugMessengerCreateInfo(VkDebugUtilsMessengerCreateInfoEXT& object, Logger& logger) override {
-        try {
-          object = {};
-          object.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT;
-          object.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_VERBOSE_BIT_EXT
-              | VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT
-              | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
-          object.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT
-              | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT
-              | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
-          object.pfnUserCallback = &Logger::call;
-          object.pUserData = &logger;
-        } catch (...) {
-          std::throw_with_nested(std::runtime_error(CALL_INFO()));
-        }
-      }
-
       QueueFamilyIndexInfo findQueueFamilies(
           VkPhysicalDevice& physicalDevice,
           bool computeFamilyRequired,
@@ -143,10 +299,10 @@ namespace exqudens::vulkan {
           result.presentFamilyRequired = surface != nullptr;
 
           uint32_t queueFamilyCount = 0;
-          functions().getPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
+          Dispatch::functions(*this).getPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, nullptr);
 
           std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
-          functions().getPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
+          Dispatch::functions(*this).getPhysicalDeviceQueueFamilyProperties(physicalDevice, &queueFamilyCount, queueFamilies.data());
 
           int i = 0;
           for (const auto& queueFamily : queueFamilies) {
@@ -173,7 +329,7 @@ namespace exqudens::vulkan {
 
             if (result.presentFamilyRequired) {
               VkBool32 presentSupport = false;
-              functions().getPhysicalDeviceSurfaceSupportKHR(physicalDevice, i, surface, &presentSupport);
+              Dispatch::functions(*this).getPhysicalDeviceSurfaceSupportKHR(physicalDevice, i, surface, &presentSupport);
               if (presentSupport) {
                 result.presentFamily = i;
                 result.presentFamilyQueueCount = queueFamily.queueCount;
@@ -226,10 +382,10 @@ namespace exqudens::vulkan {
       ) override {
         try {
           uint32_t extensionCount;
-          functions().enumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, nullptr);
+          Dispatch::functions(*this).enumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, nullptr);
 
           std::vector<VkExtensionProperties> availableExtensions(extensionCount);
-          functions().enumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, availableExtensions.data());
+          Dispatch::functions(*this).enumerateDeviceExtensionProperties(physicalDevice, nullptr, &extensionCount, availableExtensions.data());
 
           std::set<std::string> requiredExtensions(deviceExtensions.begin(), deviceExtensions.end());
 
@@ -254,22 +410,22 @@ namespace exqudens::vulkan {
 
           SwapChainSupportDetails details;
 
-          functions().getPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, &details.capabilities);
+          Dispatch::functions(*this).getPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, &details.capabilities);
 
           uint32_t formatCount;
-          functions().getPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, &formatCount, nullptr);
+          Dispatch::functions(*this).getPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, &formatCount, nullptr);
 
           if (formatCount != 0) {
             details.formats.resize(formatCount);
-            functions().getPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, &formatCount, details.formats.data());
+            Dispatch::functions(*this).getPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, &formatCount, details.formats.data());
           }
 
           uint32_t presentModeCount;
-          functions().getPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, &presentModeCount, nullptr);
+          Dispatch::functions(*this).getPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, &presentModeCount, nullptr);
 
           if (presentModeCount != 0) {
             details.presentModes.resize(presentModeCount);
-            functions().getPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, &presentModeCount, details.presentModes.data());
+            Dispatch::functions(*this).getPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, &presentModeCount, details.presentModes.data());
           }
 
           return details;
@@ -278,54 +434,6 @@ namespace exqudens::vulkan {
         }
       }
 
-      VkSurfaceFormatKHR chooseSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& availableFormats) override {
-        try {
-          for (const auto& availableFormat : availableFormats) {
-            if (availableFormat.format == VK_FORMAT_B8G8R8A8_SRGB && availableFormat.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR) {
-              return availableFormat;
-            }
-          }
-          return availableFormats[0];
-        } catch (...) {
-          std::throw_with_nested(std::runtime_error(CALL_INFO()));
-        }
-      }
-
-      VkPresentModeKHR chooseSwapPresentMode(const std::vector<VkPresentModeKHR>& availablePresentModes) override {
-        try {
-          for (const auto& availablePresentMode : availablePresentModes) {
-            if (availablePresentMode == VK_PRESENT_MODE_MAILBOX_KHR) {
-              return availablePresentMode;
-            }
-          }
-          return VK_PRESENT_MODE_FIFO_KHR;
-        } catch (...) {
-          std::throw_with_nested(std::runtime_error(CALL_INFO()));
-        }
-      }
-
-      VkExtent2D chooseSwapExtent(
-          VkSurfaceCapabilitiesKHR& capabilities,
-          const uint32_t& width,
-          const uint32_t& height
-      ) override {
-        try {
-          if (capabilities.currentExtent.width != UINT32_MAX) {
-            return capabilities.currentExtent;
-          } else {
-            VkExtent2D actualExtent = {
-                static_cast<uint32_t>(width),
-                static_cast<uint32_t>(height)
-            };
-            actualExtent.width = std::clamp(actualExtent.width, capabilities.minImageExtent.width, capabilities.maxImageExtent.width);
-            actualExtent.height = std::clamp(actualExtent.height, capabilities.minImageExtent.height, capabilities.maxImageExtent.height);
-            return actualExtent;
-          }
-        } catch (...) {
-          std::throw_with_nested(std::runtime_error(CALL_INFO()));
-        }
-      }
-
       uint32_t findMemoryType(
           VkPhysicalDevice& physicalDevice,
           uint32_t typeFilter,
@@ -333,7 +441,7 @@ namespace exqudens::vulkan {
       ) override {
         try {
           VkPhysicalDeviceMemoryProperties memProperties;
-          functions().getPhysicalDeviceMemoryProperties(physicalDevice, &memProperties);
+          Dispatch::functions(*this).getPhysicalDeviceMemoryProperties(physicalDevice, &memProperties);
 
           for (uint32_t i = 0; i < memProperties.memoryTypeCount; i++) {
             if ((typeFilter & (1 << i)) && (memProperties.memoryTypes[i].propertyFlags & properties) == properties) {
@@ -356,7 +464,7 @@ namespace exqudens::vulkan {
         try {
           for (VkFormat format : candidates) {
             VkFormatProperties props;
-            functions().getPhysicalDeviceFormatProperties(physicalDevice, format, &props);
+            Dispatch::functions(*this).getPhysicalDeviceFormatProperties(physicalDevice, format, &props);
             if (tiling == VK_IMAGE_TILING_LINEAR && (props.linearTilingFeatures & features) == features) {
               return format;
             } else if (tiling == VK_IMAGE_TILING_OPTIMAL && (props.optimalTilingFeatures & features) == features) {
@@ -369,19 +477,6 @@ namespace exqudens::vulkan {
         }
       }
 
-      VkFormat findDepthFormat(VkPhysicalDevice& physicalDevice) override {
-        try {
-          return findSupportedFormat(
-              physicalDevice,
-              {VK_FORMAT_D32_SFLOAT, VK_FORMAT_D32_SFLOAT_S8_UINT, VK_FORMAT_D24_UNORM_S8_UINT},
-              VK_IMAGE_TILING_OPTIMAL,
-              VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT
-          );
-        } catch (...) {
-          std::throw_with_nested(std::runtime_error(CALL_INFO()));
-        }
-      }
-
   };
 
 }
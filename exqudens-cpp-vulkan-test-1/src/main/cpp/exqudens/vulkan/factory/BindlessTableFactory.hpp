@@ -0,0 +1,26 @@
+#pragma once
+
+#include <source_location>
+
+#include "exqudens/vulkan/model/BindlessTable.hpp"
+
+namespace exqudens::vulkan {
+
+  class BindlessTableFactory {
+
+    public:
+
+      virtual BindlessTable createBindlessTable(
+          VkDevice& device,
+          uint32_t capacity,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+
+      virtual uint32_t registerTexture(BindlessTable& bindlessTable, VkImageView& imageView, VkSampler& sampler) = 0;
+      virtual void unregisterTexture(BindlessTable& bindlessTable, uint32_t slot) = 0;
+
+      virtual void destroyBindlessTable(BindlessTable& bindlessTable) = 0;
+
+  };
+
+}
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <source_location>
+
+#include "exqudens/vulkan/factory/BindlessTableFactory.hpp"
+#include "exqudens/vulkan/factory/DescriptorSetLayoutFactoryBase.hpp"
+#include "exqudens/vulkan/factory/DescriptorPoolFactoryBase.hpp"
+#include "exqudens/vulkan/factory/DescriptorSetFactoryBase.hpp"
+
+namespace exqudens::vulkan {
+
+  template<typename Dispatch>
+  class BasicBindlessTableFactoryBase:
+      virtual public BindlessTableFactory,
+      virtual public BasicDescriptorSetLayoutFactoryBase<Dispatch>,
+      virtual public BasicDescriptorPoolFactoryBase<Dispatch>,
+      virtual public BasicDescriptorSetFactoryBase<Dispatch>
+  {
+
+    public:
+
+      BindlessTable createBindlessTable(
+          VkDevice& device,
+          uint32_t capacity,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          if (capacity == 0) {
+            throw std::invalid_argument(CALL_INFO() + ": failed to create bindless table capacity is zero!");
+          }
+
+          // layout and pool belong to the table, they are not registered on their own
+          DescriptorSetLayout layout = BasicDescriptorSetLayoutFactoryBase<Dispatch>::createDescriptorSetLayout(
+              device,
+              DescriptorSetLayoutCreateInfo {
+                  .flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT,
+                  .bindings = {
+                      VkDescriptorSetLayoutBinding {
+                          .binding = 0,
+                          .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                          .descriptorCount = capacity,
+                          .stageFlags = VK_SHADER_STAGE_ALL,
+                          .pImmutableSamplers = nullptr
+                      }
+                  },
+                  .bindingFlags = {
+                      VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT
+                      | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT
+                      | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT
+                  }
+              }
+          );
+
+          DescriptorPool pool = BasicDescriptorPoolFactoryBase<Dispatch>::createDescriptorPool(
+              device,
+              DescriptorPoolCreateInfo {
+                  .flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT,
+                  .maxSets = 1,
+                  .poolSizes = {
+                      VkDescriptorPoolSize {
+                          .type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                          .descriptorCount = capacity
+                      }
+                  }
+              }
+          );
+
+          std::vector<VkDescriptorSet> values;
+          if (this->allocateDescriptorSetValues(device, pool.value, {layout.value}, values) != VK_SUCCESS) {
+            throw std::runtime_error(CALL_INFO() + ": failed to allocate bindless descriptor set!");
+          }
+
+          return {
+              .device = device,
+              .capacity = capacity,
+              .nextSlot = 0,
+              .freeSlots = {},
+              .layout = layout.value,
+              .pool = pool.value,
+              .value = values.front()
+          };
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      uint32_t registerTexture(BindlessTable& bindlessTable, VkImageView& imageView, VkSampler& sampler) override {
+        try {
+          uint32_t slot;
+          if (!bindlessTable.freeSlots.empty()) {
+            slot = bindlessTable.freeSlots.back();
+            bindlessTable.freeSlots.pop_back();
+          } else if (bindlessTable.nextSlot < bindlessTable.capacity) {
+            slot = bindlessTable.nextSlot++;
+          } else {
+            throw std::runtime_error(CALL_INFO() + ": failed to register texture bindless table is full!");
+          }
+
+          VkDescriptorImageInfo imageInfo = {
+              .sampler = sampler,
+              .imageView = imageView,
+              .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+          };
+
+          VkWriteDescriptorSet write = {
+              .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+              .pNext = nullptr,
+              .dstSet = bindlessTable.value,
+              .dstBinding = 0,
+              .dstArrayElement = slot,
+              .descriptorCount = 1,
+              .descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+              .pImageInfo = &imageInfo,
+              .pBufferInfo = nullptr,
+              .pTexelBufferView = nullptr
+          };
+
+          Dispatch::functions(*this).updateDescriptorSets(bindlessTable.device, 1, &write, 0, nullptr);
+
+          return slot;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void unregisterTexture(BindlessTable& bindlessTable, uint32_t slot) override {
+        try {
+          if (
+              slot >= bindlessTable.nextSlot
+              || std::find(bindlessTable.freeSlots.begin(), bindlessTable.freeSlots.end(), slot) != bindlessTable.freeSlots.end()
+          ) {
+            throw std::invalid_argument(CALL_INFO() + ": slot '" + std::to_string(slot) + "' is not registered!");
+          }
+          // partially bound: the stale descriptor stays until the slot is reused and is never read
+          bindlessTable.freeSlots.emplace_back(slot);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void destroyBindlessTable(BindlessTable& bindlessTable) override {
+        try {
+          if (bindlessTable.pool != nullptr) {
+            Dispatch::functions(*this).destroyDescriptorPool(bindlessTable.device, bindlessTable.pool, nullptr);
+            bindlessTable.pool = nullptr;
+            bindlessTable.value = nullptr;
+          }
+          if (bindlessTable.layout != nullptr) {
+            Dispatch::functions(*this).destroyDescriptorSetLayout(bindlessTable.device, bindlessTable.layout, nullptr);
+            bindlessTable.layout = nullptr;
+          }
+          bindlessTable.device = nullptr;
+          bindlessTable.nextSlot = 0;
+          bindlessTable.freeSlots.clear();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  using BindlessTableFactoryBase = BasicBindlessTableFactoryBase<FunctionsDispatch>;
+
+}
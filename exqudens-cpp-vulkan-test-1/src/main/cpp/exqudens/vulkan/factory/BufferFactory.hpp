@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/BufferCreateInfo.hpp"
 #include "exqudens/vulkan/model/Buffer.hpp"
 
@@ -13,14 +15,16 @@ namespace exqudens::vulkan {
           VkPhysicalDevice& physicalDevice,
           VkDevice& device,
           const BufferCreateInfo& createInfo,
-          VkMemoryPropertyFlags properties
+          VkMemoryPropertyFlags properties,
+          std::source_location location = std::source_location::current()
       ) = 0;
       virtual Buffer createBuffer(
           VkPhysicalDevice& physicalDevice,
           VkDevice& device,
           VkDeviceSize memorySize,
           VkBufferUsageFlags usage,
-          VkMemoryPropertyFlags properties
+          VkMemoryPropertyFlags properties,
+          std::source_location location = std::source_location::current()
       ) = 0;
       virtual std::vector<Buffer> createBuffers(
           VkPhysicalDevice& physicalDevice,
@@ -28,7 +32,8 @@ namespace exqudens::vulkan {
           VkDeviceSize memorySize,
           VkBufferUsageFlags usage,
           VkMemoryPropertyFlags properties,
-          std::size_t size
+          std::size_t size,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual void destroyBuffer(Buffer& buffer) = 0;
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/BufferFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class BufferFactoryBase:
+  template<typename Dispatch>
+  class BasicBufferFactoryBase:
       virtual public BufferFactory,
       virtual public UtilityBase
   {
@@ -16,7 +20,8 @@ namespace exqudens::vulkan {
           VkPhysicalDevice& physicalDevice,
           VkDevice& device,
           const BufferCreateInfo& createInfo,
-          VkMemoryPropertyFlags properties
+          VkMemoryPropertyFlags properties,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           VkBuffer buffer = nullptr;
@@ -32,7 +37,7 @@ namespace exqudens::vulkan {
           };
 
           if (
-              functions().createBuffer(device, &bufferInfo, nullptr, &buffer) != VK_SUCCESS
+              Dispatch::functions(*this).createBuffer(device, &bufferInfo, nullptr, &buffer) != VK_SUCCESS
               || buffer == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create buffer!");
@@ -41,7 +46,7 @@ namespace exqudens::vulkan {
           VkDeviceMemory bufferMemory = nullptr;
 
           VkMemoryRequirements memRequirements;
-          functions().getBufferMemoryRequirements(device, buffer, &memRequirements);
+          Dispatch::functions(*this).getBufferMemoryRequirements(device, buffer, &memRequirements);
 
           VkMemoryAllocateInfo allocInfo{};
           allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
@@ -49,13 +54,13 @@ namespace exqudens::vulkan {
           allocInfo.memoryTypeIndex = findMemoryType(physicalDevice, memRequirements.memoryTypeBits, properties);
 
           if (
-              functions().allocateMemory(device, &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS
+              Dispatch::functions(*this).allocateMemory(device, &allocInfo, nullptr, &bufferMemory) != VK_SUCCESS
               || bufferMemory == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to allocate buffer memory!");
           }
 
-          if (functions().bindBufferMemory(device, buffer, bufferMemory, 0) != VK_SUCCESS) {
+          if (Dispatch::functions(*this).bindBufferMemory(device, buffer, bufferMemory, 0) != VK_SUCCESS) {
             throw std::runtime_error(CALL_INFO() + ": failed to bind buffer memory!");
           }
 
@@ -63,6 +68,7 @@ namespace exqudens::vulkan {
               .device = device,
               .memory = bufferMemory,
               .memorySize = createInfo.size,
+              .allocationSize = memRequirements.size,
               .memoryProperties = properties,
               .value = buffer
           };
@@ -76,7 +82,8 @@ namespace exqudens::vulkan {
           VkDevice& device,
           VkDeviceSize memorySize,
           VkBufferUsageFlags usage,
-          VkMemoryPropertyFlags properties
+          VkMemoryPropertyFlags properties,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           return createBuffer(
@@ -89,7 +96,8 @@ namespace exqudens::vulkan {
                   .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
                   .queueFamilyIndices = {}
               },
-              properties
+              properties,
+              location
           );
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -102,13 +110,14 @@ namespace exqudens::vulkan {
           VkDeviceSize memorySize,
           VkBufferUsageFlags usage,
           VkMemoryPropertyFlags properties,
-          std::size_t size
+          std::size_t size,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           std::vector<Buffer> buffers;
           buffers.resize(size);
           for (std::size_t i = 0; i < size; i++) {
-            buffers[i] = createBuffer(physicalDevice, device, memorySize, usage, properties);
+            buffers[i] = createBuffer(physicalDevice, device, memorySize, usage, properties, location);
           }
           return buffers;
         } catch (...) {
@@ -131,13 +140,13 @@ namespace exqudens::vulkan {
                 unmapMemory
                 && (buffer.memoryProperties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
             ) {
-              functions().unmapMemory(buffer.device, buffer.memory);
+              Dispatch::functions(*this).unmapMemory(buffer.device, buffer.memory);
             }
-            functions().freeMemory(buffer.device, buffer.memory, nullptr);
+            Dispatch::functions(*this).freeMemory(buffer.device, buffer.memory, nullptr);
             buffer.memory = nullptr;
           }
           if (buffer.value != nullptr) {
-            functions().destroyBuffer(buffer.device, buffer.value, nullptr);
+            Dispatch::functions(*this).destroyBuffer(buffer.device, buffer.value, nullptr);
             buffer.device = nullptr;
             buffer.value = nullptr;
           }
@@ -170,4 +179,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using BufferFactoryBase = BasicBufferFactoryBase<FunctionsDispatch>;
+
 }
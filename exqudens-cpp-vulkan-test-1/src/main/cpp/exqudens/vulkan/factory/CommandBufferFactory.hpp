@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/CommandBuffer.hpp"
 
 namespace exqudens::vulkan {
@@ -8,11 +10,16 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual CommandBuffer createCommandBuffer(VkDevice& device, VkCommandPool& commandPool) = 0;
+      virtual CommandBuffer createCommandBuffer(
+          VkDevice& device,
+          VkCommandPool& commandPool,
+          std::source_location location = std::source_location::current()
+      ) = 0;
       virtual std::vector<CommandBuffer> createCommandBuffers(
           VkDevice& device,
           VkCommandPool& commandPool,
-          std::size_t size
+          std::size_t size,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual void destroyCommandBuffer(CommandBuffer& commandBuffer) = 0;
@@ -1,18 +1,26 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/CommandBufferFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class CommandBufferFactoryBase:
+  template<typename Dispatch>
+  class BasicCommandBufferFactoryBase:
       virtual public CommandBufferFactory,
       virtual public UtilityBase
   {
 
     public:
 
-      CommandBuffer createCommandBuffer(VkDevice& device, VkCommandPool& commandPool) override {
+      CommandBuffer createCommandBuffer(
+          VkDevice& device,
+          VkCommandPool& commandPool,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           VkCommandBuffer commandBuffer = nullptr;
 
@@ -25,7 +33,7 @@ namespace exqudens::vulkan {
           allocInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
           allocInfo.commandBufferCount = (uint32_t) commandBuffers.size();
 
-          if (functions().allocateCommandBuffers(device, &allocInfo, commandBuffers.data()) != VK_SUCCESS) {
+          if (Dispatch::functions(*this).allocateCommandBuffers(device, &allocInfo, commandBuffers.data()) != VK_SUCCESS) {
             throw std::runtime_error(CALL_INFO() + ": failed to allocate command buffer!");
           }
 
@@ -48,14 +56,15 @@ namespace exqudens::vulkan {
       std::vector<CommandBuffer> createCommandBuffers(
           VkDevice& device,
           VkCommandPool& commandPool,
-          std::size_t size
+          std::size_t size,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           std::vector<CommandBuffer> commandBuffers;
           commandBuffers.resize(size);
 
           for (std::size_t i = 0; i < commandBuffers.size(); i++) {
-            commandBuffers[i] = createCommandBuffer(device, commandPool);
+            commandBuffers[i] = createCommandBuffer(device, commandPool, location);
           }
 
           return commandBuffers;
@@ -67,7 +76,7 @@ namespace exqudens::vulkan {
       void destroyCommandBuffer(CommandBuffer& commandBuffer) override {
         try {
           if (commandBuffer.value != nullptr) {
-            functions().freeCommandBuffers(commandBuffer.device, commandBuffer.commandPool, 1, &commandBuffer.value);
+            Dispatch::functions(*this).freeCommandBuffers(commandBuffer.device, commandBuffer.commandPool, 1, &commandBuffer.value);
             commandBuffer.device = nullptr;
             commandBuffer.commandPool = nullptr;
             commandBuffer.value = nullptr;
@@ -90,4 +99,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using CommandBufferFactoryBase = BasicCommandBufferFactoryBase<FunctionsDispatch>;
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/CommandPool.hpp"
 
 namespace exqudens::vulkan {
@@ -10,12 +12,14 @@ namespace exqudens::vulkan {
 
       virtual CommandPool createCommandPool(
           VkDevice& device,
-          uint32_t queueFamilyIndex
+          uint32_t queueFamilyIndex,
+          std::source_location location = std::source_location::current()
       ) = 0;
       virtual CommandPool createCommandPool(
           VkDevice& device,
           uint32_t queueFamilyIndex,
-          VkCommandPoolCreateFlags flags
+          VkCommandPoolCreateFlags flags,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual void destroyCommandPool(CommandPool& commandPool) = 0;
@@ -1,20 +1,28 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/CommandPoolFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class CommandPoolFactoryBase:
+  template<typename Dispatch>
+  class BasicCommandPoolFactoryBase:
       virtual public CommandPoolFactory,
       virtual public UtilityBase
   {
 
     public:
 
-      CommandPool createCommandPool(VkDevice& device, uint32_t queueFamilyIndex) override {
+      CommandPool createCommandPool(
+          VkDevice& device,
+          uint32_t queueFamilyIndex,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
-          return createCommandPool(device, queueFamilyIndex, 0);
+          return createCommandPool(device, queueFamilyIndex, 0, location);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -23,7 +31,8 @@ namespace exqudens::vulkan {
       CommandPool createCommandPool(
           VkDevice& device,
           uint32_t queueFamilyIndex,
-          VkCommandPoolCreateFlags flags
+          VkCommandPoolCreateFlags flags,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           VkCommandPool commandPool = nullptr;
@@ -34,7 +43,7 @@ namespace exqudens::vulkan {
           createInfo.flags = flags;
 
           if (
-              functions().createCommandPool(device, &createInfo, nullptr, &commandPool) != VK_SUCCESS
+              Dispatch::functions(*this).createCommandPool(device, &createInfo, nullptr, &commandPool) != VK_SUCCESS
               || commandPool == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create compute command pool!");
@@ -52,7 +61,7 @@ namespace exqudens::vulkan {
       void destroyCommandPool(CommandPool& commandPool) override {
         try {
           if (commandPool.value != nullptr) {
-            functions().destroyCommandPool(commandPool.device, commandPool.value, nullptr);
+            Dispatch::functions(*this).destroyCommandPool(commandPool.device, commandPool.value, nullptr);
             commandPool.device = nullptr;
             commandPool.value = nullptr;
           }
@@ -63,4 +72,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using CommandPoolFactoryBase = BasicCommandPoolFactoryBase<FunctionsDispatch>;
+
 }
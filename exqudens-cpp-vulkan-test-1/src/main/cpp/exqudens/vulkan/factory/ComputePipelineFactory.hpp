@@ -0,0 +1,38 @@
+#pragma once
+
+#include <source_location>
+
+#include "exqudens/vulkan/Utility.hpp"
+#include "exqudens/vulkan/model/SpecializationInfo.hpp"
+#include "exqudens/vulkan/model/PipelineLayoutCreateInfo.hpp"
+#include "exqudens/vulkan/model/Pipeline.hpp"
+
+namespace exqudens::vulkan {
+
+  class ComputePipelineFactory {
+
+    public:
+
+      virtual Pipeline createComputePipeline(
+          VkDevice& device,
+          const std::string& shaderPath,
+          const PipelineLayoutCreateInfo& layoutCreateInfo,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual Pipeline createComputePipeline(
+          VkDevice& device,
+          const std::string& shaderPath,
+          const SpecializationInfo& specializationInfo,
+          const PipelineLayoutCreateInfo& layoutCreateInfo,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual Pipeline createComputePipeline(
+          VkDevice& device,
+          const std::string& shaderPath,
+          std::vector<VkDescriptorSetLayout> descriptorSetLayouts,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+
+  };
+
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <source_location>
+
+#include "exqudens/vulkan/factory/ComputePipelineFactory.hpp"
+#include "exqudens/vulkan/factory/PipelineFactoryBase.hpp"
+
+namespace exqudens::vulkan {
+
+  template<typename Dispatch>
+  class BasicComputePipelineFactoryBase:
+      virtual public ComputePipelineFactory,
+      virtual public BasicPipelineFactoryBase<Dispatch>
+  {
+
+    public:
+
+      Pipeline createComputePipeline(
+          VkDevice& device,
+          const std::string& shaderPath,
+          const PipelineLayoutCreateInfo& layoutCreateInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          return createComputePipeline(device, shaderPath, SpecializationInfo {}, layoutCreateInfo, location);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      Pipeline createComputePipeline(
+          VkDevice& device,
+          const std::string& shaderPath,
+          const SpecializationInfo& specializationInfo,
+          const PipelineLayoutCreateInfo& layoutCreateInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          if (!shaderPath.ends_with(".comp.spv")) {
+            throw std::invalid_argument(CALL_INFO() + ": '" + shaderPath + "' is not a compute shader!");
+          }
+
+          Shader shader = this->createShader(device, shaderPath);
+
+          VkPipelineLayout pipelineLayout = nullptr;
+
+          VkPipelineLayoutCreateInfo vkLayoutCreateInfo = {
+              .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+              .flags = layoutCreateInfo.flags,
+              .setLayoutCount = static_cast<uint32_t>(layoutCreateInfo.setLayouts.size()),
+              .pSetLayouts = layoutCreateInfo.setLayouts.empty() ? nullptr : layoutCreateInfo.setLayouts.data(),
+              .pushConstantRangeCount = static_cast<uint32_t>(layoutCreateInfo.pushConstantRanges.size()),
+              .pPushConstantRanges = layoutCreateInfo.pushConstantRanges.empty() ? nullptr : layoutCreateInfo.pushConstantRanges.data()
+          };
+
+          if (
+              Dispatch::functions(*this).createPipelineLayout(device, &vkLayoutCreateInfo, nullptr, &pipelineLayout) != VK_SUCCESS
+              || pipelineLayout == nullptr
+          ) {
+            this->destroyShader(shader);
+            throw std::runtime_error(CALL_INFO() + ": failed to create pipeline layout!");
+          }
+
+          std::vector<VkSpecializationMapEntry> specializationMapEntries;
+          std::vector<char> specializationData;
+          VkSpecializationInfo vkSpecializationInfo = this->createSpecializationInfo(
+              specializationInfo,
+              specializationMapEntries,
+              specializationData
+          );
+          if (!specializationInfo.constants.empty()) {
+            shader.pipelineShaderStageCreateInfo.pSpecializationInfo = &vkSpecializationInfo;
+          }
+
+          VkComputePipelineCreateInfo createInfo = {
+              .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+              .flags = 0,
+              .stage = shader.pipelineShaderStageCreateInfo,
+              .layout = pipelineLayout,
+              .basePipelineHandle = nullptr,
+              .basePipelineIndex = 0
+          };
+
+          VkPipeline pipeline = nullptr;
+
+          if (
+              Dispatch::functions(*this).createComputePipelines(device, VK_NULL_HANDLE, 1, &createInfo, nullptr, &pipeline) != VK_SUCCESS
+              || pipeline == nullptr
+          ) {
+            this->destroyShader(shader);
+            Dispatch::functions(*this).destroyPipelineLayout(device, pipelineLayout, nullptr);
+            throw std::runtime_error(CALL_INFO() + ": failed to create compute pipeline!");
+          }
+
+          this->destroyShader(shader);
+
+          return {
+              .device = device,
+              .layout = pipelineLayout,
+              .value = pipeline
+          };
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      Pipeline createComputePipeline(
+          VkDevice& device,
+          const std::string& shaderPath,
+          std::vector<VkDescriptorSetLayout> descriptorSetLayouts,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          return createComputePipeline(
+              device,
+              shaderPath,
+              PipelineLayoutCreateInfo {
+                  .flags = 0,
+                  .setLayouts = descriptorSetLayouts,
+                  .pushConstantRanges = {}
+              },
+              location
+          );
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  using ComputePipelineFactoryBase = BasicComputePipelineFactoryBase<FunctionsDispatch>;
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/Logger.hpp"
 #include "exqudens/vulkan/model/DebugUtilsMessenger.hpp"
 
@@ -9,7 +11,11 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual DebugUtilsMessenger createDebugUtilsMessenger(VkInstance& instance, Logger& logger) = 0;
+      virtual DebugUtilsMessenger createDebugUtilsMessenger(
+          VkInstance& instance,
+          Logger& logger,
+          std::source_location location = std::source_location::current()
+      ) = 0;
 
       virtual void destroyDebugUtilsMessenger(DebugUtilsMessenger& debugUtilsMessenger) = 0;
 
@@ -1,24 +1,32 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/DebugUtilsMessengerFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class DebugUtilsMessengerFactoryBase:
+  template<typename Dispatch>
+  class BasicDebugUtilsMessengerFactoryBase:
       virtual public DebugUtilsMessengerFactory,
       virtual public UtilityBase
   {
 
     public:
 
-      DebugUtilsMessenger createDebugUtilsMessenger(VkInstance& instance, Logger& logger) override {
+      DebugUtilsMessenger createDebugUtilsMessenger(
+          VkInstance& instance,
+          Logger& logger,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           VkDebugUtilsMessengerEXT debugUtilsMessenger = nullptr;
 
           VkResult result;
 
-          auto func = (PFN_vkCreateDebugUtilsMessengerEXT) functions().getInstanceProcAddr(instance, "vkCreateDebugUtilsMessengerEXT");
+          auto func = (PFN_vkCreateDebugUtilsMessengerEXT) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkCreateDebugUtilsMessengerEXT");
 
           if (func != nullptr) {
             VkDebugUtilsMessengerCreateInfoEXT createInfo = {};
@@ -44,7 +52,7 @@ namespace exqudens::vulkan {
       void destroyDebugUtilsMessenger(DebugUtilsMessenger& debugUtilsMessenger) override {
         try {
           if (debugUtilsMessenger.value != nullptr) {
-            auto func = (PFN_vkDestroyDebugUtilsMessengerEXT) functions().getInstanceProcAddr(debugUtilsMessenger.instance, "vkDestroyDebugUtilsMessengerEXT");
+            auto func = (PFN_vkDestroyDebugUtilsMessengerEXT) Dispatch::functions(*this).getInstanceProcAddr(debugUtilsMessenger.instance, "vkDestroyDebugUtilsMessengerEXT");
             func(debugUtilsMessenger.instance, debugUtilsMessenger.value, nullptr);
             debugUtilsMessenger.instance = nullptr;
             debugUtilsMessenger.value = nullptr;
@@ -56,4 +64,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using DebugUtilsMessengerFactoryBase = BasicDebugUtilsMessengerFactoryBase<FunctionsDispatch>;
+
 }
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <source_location>
+
+#include "exqudens/vulkan/model/DescriptorPoolCreateInfo.hpp"
+#include "exqudens/vulkan/model/WriteDescriptorSet.hpp"
+#include "exqudens/vulkan/model/DescriptorSet.hpp"
+#include "exqudens/vulkan/model/DescriptorAllocator.hpp"
+
+namespace exqudens::vulkan {
+
+  class DescriptorAllocatorFactory {
+
+    public:
+
+      virtual DescriptorAllocator createDescriptorAllocator(
+          VkDevice& device,
+          const DescriptorPoolCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+
+      virtual std::vector<DescriptorSet> allocateDescriptorSets(
+          DescriptorAllocator& descriptorAllocator,
+          const std::vector<VkDescriptorSetLayout>& descriptorSetLayouts,
+          const std::vector<std::vector<WriteDescriptorSet>>& writeDescriptorSets
+      ) = 0;
+
+      virtual void resetDescriptorAllocator(DescriptorAllocator& descriptorAllocator) = 0;
+
+      virtual void destroyDescriptorAllocator(DescriptorAllocator& descriptorAllocator) = 0;
+
+  };
+
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <source_location>
+
+#include "exqudens/vulkan/factory/DescriptorAllocatorFactory.hpp"
+#include "exqudens/vulkan/factory/DescriptorPoolFactoryBase.hpp"
+#include "exqudens/vulkan/factory/DescriptorSetFactoryBase.hpp"
+
+namespace exqudens::vulkan {
+
+  template<typename Dispatch>
+  class BasicDescriptorAllocatorFactoryBase:
+      virtual public DescriptorAllocatorFactory,
+      virtual public BasicDescriptorPoolFactoryBase<Dispatch>,
+      virtual public BasicDescriptorSetFactoryBase<Dispatch>
+  {
+
+    public:
+
+      DescriptorAllocator createDescriptorAllocator(
+          VkDevice& device,
+          const DescriptorPoolCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          if (createInfo.maxSets == 0) {
+            throw std::invalid_argument(CALL_INFO() + ": failed to create descriptor allocator max sets is zero!");
+          }
+          return {
+              .device = device,
+              .createInfo = createInfo,
+              .setsPerPool = createInfo.maxSets,
+              .allocatedSets = 0,
+              .peakSets = 0,
+              .current = nullptr,
+              .usedPools = {},
+              .freePools = {}
+          };
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      std::vector<DescriptorSet> allocateDescriptorSets(
+          DescriptorAllocator& descriptorAllocator,
+          const std::vector<VkDescriptorSetLayout>& descriptorSetLayouts,
+          const std::vector<std::vector<WriteDescriptorSet>>& writeDescriptorSets
+      ) override {
+        try {
+          std::vector<VkDescriptorSet> values;
+
+          VkResult result = VK_ERROR_OUT_OF_POOL_MEMORY;
+          if (descriptorAllocator.current != nullptr) {
+            result = this->allocateDescriptorSetValues(
+                descriptorAllocator.device,
+                descriptorAllocator.current,
+                descriptorSetLayouts,
+                values
+            );
+          }
+
+          // recycled pools may still be too small, a freshly created one is the last attempt
+          while (result == VK_ERROR_OUT_OF_POOL_MEMORY || result == VK_ERROR_FRAGMENTED_POOL) {
+            bool recycled = !descriptorAllocator.freePools.empty();
+            uint32_t requiredSets = descriptorAllocator.allocatedSets + static_cast<uint32_t>(descriptorSetLayouts.size());
+            descriptorAllocator.current = nextDescriptorPool(descriptorAllocator, requiredSets);
+            result = this->allocateDescriptorSetValues(
+                descriptorAllocator.device,
+                descriptorAllocator.current,
+                descriptorSetLayouts,
+                values
+            );
+            if (!recycled) {
+              break;
+            }
+          }
+
+          if (result != VK_SUCCESS) {
+            throw std::runtime_error(CALL_INFO() + ": failed to allocate descriptor sets!");
+          }
+
+          descriptorAllocator.allocatedSets += static_cast<uint32_t>(values.size());
+          descriptorAllocator.peakSets = std::max(descriptorAllocator.peakSets, descriptorAllocator.allocatedSets);
+
+          this->updateDescriptorSetValues(descriptorAllocator.device, values, writeDescriptorSets);
+
+          std::vector<DescriptorSet> descriptorSets;
+          descriptorSets.reserve(values.size());
+          for (VkDescriptorSet& value : values) {
+            descriptorSets.emplace_back(DescriptorSet {
+                .value = value
+            });
+          }
+          return descriptorSets;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void resetDescriptorAllocator(DescriptorAllocator& descriptorAllocator) override {
+        try {
+          for (VkDescriptorPool& pool : descriptorAllocator.usedPools) {
+            if (Dispatch::functions(*this).resetDescriptorPool(descriptorAllocator.device, pool, 0) != VK_SUCCESS) {
+              throw std::runtime_error(CALL_INFO() + ": failed to reset descriptor pool!");
+            }
+          }
+
+          // chaining happened during the last cycle: replace the chain with one pool that fits the peak
+          if (descriptorAllocator.usedPools.size() > 1) {
+            destroyDescriptorPools(descriptorAllocator);
+            descriptorAllocator.setsPerPool = std::max(descriptorAllocator.setsPerPool, descriptorAllocator.peakSets);
+          } else {
+            descriptorAllocator.freePools.insert(
+                descriptorAllocator.freePools.end(),
+                descriptorAllocator.usedPools.begin(),
+                descriptorAllocator.usedPools.end()
+            );
+            descriptorAllocator.usedPools.clear();
+          }
+
+          descriptorAllocator.current = nullptr;
+          descriptorAllocator.allocatedSets = 0;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void destroyDescriptorAllocator(DescriptorAllocator& descriptorAllocator) override {
+        try {
+          destroyDescriptorPools(descriptorAllocator);
+          descriptorAllocator.current = nullptr;
+          descriptorAllocator.allocatedSets = 0;
+          descriptorAllocator.device = nullptr;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+    protected:
+
+      VkDescriptorPool nextDescriptorPool(DescriptorAllocator& descriptorAllocator, uint32_t requiredSets) {
+        try {
+          if (!descriptorAllocator.freePools.empty()) {
+            VkDescriptorPool pool = descriptorAllocator.freePools.back();
+            descriptorAllocator.freePools.pop_back();
+            descriptorAllocator.usedPools.emplace_back(pool);
+            return pool;
+          }
+
+          // pool sizes scale with the sets per pool at the ratio given by the create info
+          uint32_t maxSets = std::max(descriptorAllocator.setsPerPool, requiredSets);
+          std::vector<VkDescriptorPoolSize> poolSizes = descriptorAllocator.createInfo.poolSizes;
+          for (VkDescriptorPoolSize& poolSize : poolSizes) {
+            uint64_t descriptorCount = static_cast<uint64_t>(poolSize.descriptorCount) * maxSets;
+            poolSize.descriptorCount = static_cast<uint32_t>(
+                (descriptorCount + descriptorAllocator.createInfo.maxSets - 1) / descriptorAllocator.createInfo.maxSets
+            );
+          }
+
+          DescriptorPool pool = BasicDescriptorPoolFactoryBase<Dispatch>::createDescriptorPool(
+              descriptorAllocator.device,
+              DescriptorPoolCreateInfo {
+                  .flags = descriptorAllocator.createInfo.flags,
+                  .maxSets = maxSets,
+                  .poolSizes = poolSizes
+              }
+          );
+          descriptorAllocator.usedPools.emplace_back(pool.value);
+          return pool.value;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void destroyDescriptorPools(DescriptorAllocator& descriptorAllocator) {
+        try {
+          for (std::vector<VkDescriptorPool>* pools : {&descriptorAllocator.usedPools, &descriptorAllocator.freePools}) {
+            for (VkDescriptorPool& pool : *pools) {
+              Dispatch::functions(*this).destroyDescriptorPool(descriptorAllocator.device, pool, nullptr);
+            }
+            pools->clear();
+          }
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  using DescriptorAllocatorFactoryBase = BasicDescriptorAllocatorFactoryBase<FunctionsDispatch>;
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/DescriptorPoolCreateInfo.hpp"
 #include "exqudens/vulkan/model/DescriptorPool.hpp"
 
@@ -9,8 +11,16 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual DescriptorPool createDescriptorPool(VkDevice& device, uint32_t maxSets) = 0;
-      virtual DescriptorPool createDescriptorPool(VkDevice& device, const DescriptorPoolCreateInfo& createInfo) = 0;
+      virtual DescriptorPool createDescriptorPool(
+          VkDevice& device,
+          uint32_t maxSets,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual DescriptorPool createDescriptorPool(
+          VkDevice& device,
+          const DescriptorPoolCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) = 0;
 
       virtual void destroyDescriptorPool(DescriptorPool& descriptorPool) = 0;
 
@@ -1,18 +1,26 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/DescriptorPoolFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class DescriptorPoolFactoryBase:
+  template<typename Dispatch>
+  class BasicDescriptorPoolFactoryBase:
       virtual public DescriptorPoolFactory,
       virtual public UtilityBase
   {
 
     public:
 
-      DescriptorPool createDescriptorPool(VkDevice& device, uint32_t maxSets) override {
+      DescriptorPool createDescriptorPool(
+          VkDevice& device,
+          uint32_t maxSets,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           return createDescriptorPool(
               device,
@@ -28,14 +36,19 @@ namespace exqudens::vulkan {
                           .descriptorCount = maxSets
                       }
                   }
-              }
+              },
+              location
           );
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
-      DescriptorPool createDescriptorPool(VkDevice& device, const DescriptorPoolCreateInfo& createInfo) override {
+      DescriptorPool createDescriptorPool(
+          VkDevice& device,
+          const DescriptorPoolCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           VkDescriptorPool descriptorPool = nullptr;
 
@@ -47,7 +60,7 @@ namespace exqudens::vulkan {
           poolInfo.flags = createInfo.flags;
 
           if (
-              functions().createDescriptorPool(device, &poolInfo, nullptr, &descriptorPool) != VK_SUCCESS
+              Dispatch::functions(*this).createDescriptorPool(device, &poolInfo, nullptr, &descriptorPool) != VK_SUCCESS
               || descriptorPool == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create descriptor pool!");
@@ -65,7 +78,7 @@ namespace exqudens::vulkan {
       void destroyDescriptorPool(DescriptorPool& descriptorPool) override {
         try {
           if (descriptorPool.value != nullptr) {
-            functions().destroyDescriptorPool(descriptorPool.device, descriptorPool.value, nullptr);
+            Dispatch::functions(*this).destroyDescriptorPool(descriptorPool.device, descriptorPool.value, nullptr);
             descriptorPool.device = nullptr;
             descriptorPool.value = nullptr;
           }
@@ -76,4 +89,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using DescriptorPoolFactoryBase = BasicDescriptorPoolFactoryBase<FunctionsDispatch>;
+
 }
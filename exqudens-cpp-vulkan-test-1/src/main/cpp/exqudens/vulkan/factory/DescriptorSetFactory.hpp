@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/WriteDescriptorSet.hpp"
 #include "exqudens/vulkan/model/DescriptorSet.hpp"
 
@@ -13,7 +15,15 @@ namespace exqudens::vulkan {
           VkDevice& device,
           VkDescriptorPool& descriptorPool,
           VkDescriptorSetLayout& descriptorSetLayout,
-          const std::vector<WriteDescriptorSet>& writeDescriptorSets
+          const std::vector<WriteDescriptorSet>& writeDescriptorSets,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual std::vector<DescriptorSet> createDescriptorSets(
+          VkDevice& device,
+          VkDescriptorPool& descriptorPool,
+          const std::vector<VkDescriptorSetLayout>& descriptorSetLayouts,
+          const std::vector<std::vector<WriteDescriptorSet>>& writeDescriptorSets,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual void destroyDescriptorSet(DescriptorSet& descriptorSet) = 0;
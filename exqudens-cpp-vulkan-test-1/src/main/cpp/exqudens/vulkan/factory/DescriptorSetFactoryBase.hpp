@@ -1,11 +1,15 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/DescriptorSetFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class DescriptorSetFactoryBase:
+  template<typename Dispatch>
+  class BasicDescriptorSetFactoryBase:
       virtual public DescriptorSetFactory,
       virtual public UtilityBase
   {
@@ -16,47 +20,49 @@ namespace exqudens::vulkan {
           VkDevice& device,
           VkDescriptorPool& descriptorPool,
           VkDescriptorSetLayout& descriptorSetLayout,
-          const std::vector<WriteDescriptorSet>& writeDescriptorSets
+          const std::vector<WriteDescriptorSet>& writeDescriptorSets,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          VkDescriptorSet descriptorSet = nullptr;
-
-          VkDescriptorSetAllocateInfo allocInfo = {};
-          allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-          allocInfo.descriptorPool = descriptorPool;
-          allocInfo.descriptorSetCount = descriptorSetLayout == nullptr ? 0 : 1;
-          allocInfo.pSetLayouts = descriptorSetLayout == nullptr ? nullptr : &descriptorSetLayout;
-
-          if (
-              functions().allocateDescriptorSets(device, &allocInfo, &descriptorSet) != VK_SUCCESS
-              || descriptorSet == nullptr
-          ) {
+          if (descriptorSetLayout == nullptr) {
             throw std::runtime_error(CALL_INFO()+ ": failed to allocate descriptor sets!");
           }
+          return createDescriptorSets(
+              device,
+              descriptorPool,
+              {descriptorSetLayout},
+              {writeDescriptorSets},
+              location
+          ).front();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          std::vector<VkWriteDescriptorSet> writes;
-          writes.resize(writeDescriptorSets.size());
-
-          for (std::size_t i = 0; i < writes.size(); i++) {
-            writes[i] = {
-                .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
-                .pNext = nullptr,
-                .dstSet = descriptorSet,
-                .dstBinding = writeDescriptorSets[i].dstBinding,
-                .dstArrayElement = writeDescriptorSets[i].dstArrayElement,
-                .descriptorCount = writeDescriptorSets[i].descriptorCount,
-                .descriptorType = writeDescriptorSets[i].descriptorType,
-                .pImageInfo = writeDescriptorSets[i].imageInfo.empty() ? nullptr : writeDescriptorSets[i].imageInfo.data(),
-                .pBufferInfo = writeDescriptorSets[i].bufferInfo.empty() ? nullptr : writeDescriptorSets[i].bufferInfo.data(),
-                .pTexelBufferView = writeDescriptorSets[i].texelBufferView.empty() ? nullptr : writeDescriptorSets[i].texelBufferView.data()
-            };
+      std::vector<DescriptorSet> createDescriptorSets(
+          VkDevice& device,
+          VkDescriptorPool& descriptorPool,
+          const std::vector<VkDescriptorSetLayout>& descriptorSetLayouts,
+          const std::vector<std::vector<WriteDescriptorSet>>& writeDescriptorSets,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          std::vector<VkDescriptorSet> values;
+
+          if (allocateDescriptorSetValues(device, descriptorPool, descriptorSetLayouts, values) != VK_SUCCESS) {
+            throw std::runtime_error(CALL_INFO()+ ": failed to allocate descriptor sets!");
           }
 
-          functions().updateDescriptorSets(device, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+          updateDescriptorSetValues(device, values, writeDescriptorSets);
 
-          return {
-              .value = descriptorSet
-          };
+          std::vector<DescriptorSet> descriptorSets;
+          descriptorSets.reserve(values.size());
+          for (VkDescriptorSet& value : values) {
+            descriptorSets.emplace_back(DescriptorSet {
+                .value = value
+            });
+          }
+          return descriptorSets;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -83,6 +89,99 @@ namespace exqudens::vulkan {
         }
       }
 
+    protected:
+
+      VkResult allocateDescriptorSetValues(
+          VkDevice& device,
+          VkDescriptorPool& descriptorPool,
+          const std::vector<VkDescriptorSetLayout>& descriptorSetLayouts,
+          std::vector<VkDescriptorSet>& values
+      ) {
+        try {
+          values.clear();
+          values.resize(descriptorSetLayouts.size(), nullptr);
+
+          if (values.empty()) {
+            return VK_SUCCESS;
+          }
+
+          VkDescriptorSetAllocateInfo allocInfo = {};
+          allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+          allocInfo.descriptorPool = descriptorPool;
+          allocInfo.descriptorSetCount = static_cast<uint32_t>(descriptorSetLayouts.size());
+          allocInfo.pSetLayouts = descriptorSetLayouts.data();
+
+          VkResult result = Dispatch::functions(*this).allocateDescriptorSets(device, &allocInfo, values.data());
+
+          if (result == VK_SUCCESS) {
+            for (VkDescriptorSet& value : values) {
+              if (value == nullptr) {
+                throw std::runtime_error(CALL_INFO()+ ": failed to allocate descriptor sets!");
+              }
+            }
+          }
+
+          return result;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void updateDescriptorSetValues(
+          VkDevice& device,
+          const std::vector<VkDescriptorSet>& values,
+          const std::vector<std::vector<WriteDescriptorSet>>& writeDescriptorSets
+      ) {
+        try {
+          if (writeDescriptorSets.empty()) {
+            return;
+          }
+
+          if (writeDescriptorSets.size() != values.size()) {
+            throw std::invalid_argument(CALL_INFO() + ": write descriptor sets size not equal to descriptor sets size!");
+          }
+
+          std::size_t writeCount = 0;
+          for (const std::vector<WriteDescriptorSet>& setWrites : writeDescriptorSets) {
+            writeCount += setWrites.size();
+          }
+
+          std::vector<VkWriteDescriptorSet> writes;
+          writes.reserve(writeCount);
+
+          for (std::size_t i = 0; i < values.size(); i++) {
+            for (const WriteDescriptorSet& write : writeDescriptorSets[i]) {
+              writes.emplace_back(VkWriteDescriptorSet {
+                  .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+                  .pNext = nullptr,
+                  .dstSet = values[i],
+                  .dstBinding = write.dstBinding,
+                  .dstArrayElement = write.dstArrayElement,
+                  .descriptorCount = write.descriptorCount,
+                  .descriptorType = write.descriptorType,
+                  .pImageInfo = write.imageInfo.empty() ? nullptr : write.imageInfo.data(),
+                  .pBufferInfo = write.bufferInfo.empty() ? nullptr : write.bufferInfo.data(),
+                  .pTexelBufferView = write.texelBufferView.empty() ? nullptr : write.texelBufferView.data()
+              });
+            }
+          }
+
+          if (!writes.empty()) {
+            Dispatch::functions(*this).updateDescriptorSets(
+                device,
+                static_cast<uint32_t>(writes.size()),
+                writes.data(),
+                0,
+                nullptr
+            );
+          }
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
   };
 
+  using DescriptorSetFactoryBase = BasicDescriptorSetFactoryBase<FunctionsDispatch>;
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/DescriptorSetLayoutCreateInfo.hpp"
 #include "exqudens/vulkan/model/DescriptorSetLayout.hpp"
 
@@ -9,10 +11,19 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual DescriptorSetLayout createDescriptorSetLayout(VkDevice& device) = 0;
       virtual DescriptorSetLayout createDescriptorSetLayout(
           VkDevice& device,
-          const DescriptorSetLayoutCreateInfo& createInfo
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual DescriptorSetLayout createDescriptorSetLayout(
+          VkDevice& device,
+          const DescriptorSetLayoutCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual DescriptorSetLayout createPushDescriptorSetLayout(
+          VkDevice& device,
+          const DescriptorSetLayoutCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual void destroyDescriptorSetLayout(DescriptorSetLayout& descriptorSetLayout) = 0;
@@ -1,18 +1,25 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/DescriptorSetLayoutFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class DescriptorSetLayoutFactoryBase:
+  template<typename Dispatch>
+  class BasicDescriptorSetLayoutFactoryBase:
       virtual public DescriptorSetLayoutFactory,
       virtual public UtilityBase
   {
 
     public:
 
-      DescriptorSetLayout createDescriptorSetLayout(VkDevice& device) override {
+      DescriptorSetLayout createDescriptorSetLayout(
+          VkDevice& device,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           return createDescriptorSetLayout(
               device,
@@ -34,7 +41,8 @@ namespace exqudens::vulkan {
                           .pImmutableSamplers = nullptr
                       }
                   }
-              }
+              },
+              location
           );
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -43,7 +51,8 @@ namespace exqudens::vulkan {
 
       DescriptorSetLayout createDescriptorSetLayout(
           VkDevice& device,
-          const DescriptorSetLayoutCreateInfo& createInfo
+          const DescriptorSetLayoutCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           VkDescriptorSetLayout descriptorSetLayout = nullptr;
@@ -54,8 +63,19 @@ namespace exqudens::vulkan {
           layoutInfo.bindingCount = static_cast<uint32_t>(createInfo.bindings.size());
           layoutInfo.pBindings = createInfo.bindings.data();
 
+          VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo = {};
+          if (!createInfo.bindingFlags.empty()) {
+            if (createInfo.bindingFlags.size() != createInfo.bindings.size()) {
+              throw std::invalid_argument(CALL_INFO() + ": binding flags size not equal to bindings size!");
+            }
+            bindingFlagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+            bindingFlagsInfo.bindingCount = static_cast<uint32_t>(createInfo.bindingFlags.size());
+            bindingFlagsInfo.pBindingFlags = createInfo.bindingFlags.data();
+            layoutInfo.pNext = &bindingFlagsInfo;
+          }
+
           if (
-              functions().createDescriptorSetLayout(device, &layoutInfo, nullptr, &descriptorSetLayout) != VK_SUCCESS
+              Dispatch::functions(*this).createDescriptorSetLayout(device, &layoutInfo, nullptr, &descriptorSetLayout) != VK_SUCCESS
               || descriptorSetLayout == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create descriptor set layout!");
@@ -70,10 +90,24 @@ namespace exqudens::vulkan {
         }
       }
 
+      DescriptorSetLayout createPushDescriptorSetLayout(
+          VkDevice& device,
+          const DescriptorSetLayoutCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          DescriptorSetLayoutCreateInfo pushCreateInfo = createInfo;
+          pushCreateInfo.flags |= VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+          return createDescriptorSetLayout(device, pushCreateInfo, location);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
       void destroyDescriptorSetLayout(DescriptorSetLayout& descriptorSetLayout) override {
         try {
           if (descriptorSetLayout.value != nullptr) {
-            functions().destroyDescriptorSetLayout(descriptorSetLayout.device, descriptorSetLayout.value, nullptr);
+            Dispatch::functions(*this).destroyDescriptorSetLayout(descriptorSetLayout.device, descriptorSetLayout.value, nullptr);
             descriptorSetLayout.device = nullptr;
             descriptorSetLayout.value = nullptr;
           }
@@ -84,4 +118,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using DescriptorSetLayoutFactoryBase = BasicDescriptorSetLayoutFactoryBase<FunctionsDispatch>;
+
 }
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <source_location>
+
+#include "exqudens/vulkan/model/DescriptorSetLayoutCreateInfo.hpp"
+#include "exqudens/vulkan/model/DescriptorUpdateTemplate.hpp"
+
+namespace exqudens::vulkan {
+
+  class DescriptorUpdateTemplateFactory {
+
+    public:
+
+      virtual DescriptorUpdateTemplate createDescriptorUpdateTemplate(
+          VkDevice& device,
+          VkDescriptorSetLayout& descriptorSetLayout,
+          const DescriptorSetLayoutCreateInfo& descriptorSetLayoutCreateInfo,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+
+      virtual void updateDescriptorSetWithTemplate(
+          DescriptorUpdateTemplate& descriptorUpdateTemplate,
+          VkDescriptorSet& descriptorSet,
+          const void* data
+      ) = 0;
+
+      virtual void destroyDescriptorUpdateTemplate(DescriptorUpdateTemplate& descriptorUpdateTemplate) = 0;
+
+  };
+
+}
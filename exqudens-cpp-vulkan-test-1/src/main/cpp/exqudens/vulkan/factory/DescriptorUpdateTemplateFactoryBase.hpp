@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <source_location>
+
+#include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
+#include "exqudens/vulkan/factory/DescriptorUpdateTemplateFactory.hpp"
+
+namespace exqudens::vulkan {
+
+  template<typename Dispatch>
+  class BasicDescriptorUpdateTemplateFactoryBase:
+      virtual public DescriptorUpdateTemplateFactory,
+      virtual public UtilityBase
+  {
+
+    public:
+
+      DescriptorUpdateTemplate createDescriptorUpdateTemplate(
+          VkDevice& device,
+          VkDescriptorSetLayout& descriptorSetLayout,
+          const DescriptorSetLayoutCreateInfo& descriptorSetLayoutCreateInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          VkDescriptorUpdateTemplate descriptorUpdateTemplate = nullptr;
+
+          std::vector<VkDescriptorSetLayoutBinding> bindings = descriptorSetLayoutCreateInfo.bindings;
+          std::sort(
+              bindings.begin(),
+              bindings.end(),
+              [](const VkDescriptorSetLayoutBinding& a, const VkDescriptorSetLayoutBinding& b) {
+                return a.binding < b.binding;
+              }
+          );
+
+          // one entry per binding, packed in binding order like a plain struct of descriptor infos
+          std::vector<VkDescriptorUpdateTemplateEntry> entries;
+          std::size_t dataSize = 0;
+          for (const VkDescriptorSetLayoutBinding& binding : bindings) {
+            if (binding.descriptorCount == 0) {
+              continue;
+            }
+            std::size_t stride = getDescriptorInfoSize(binding.descriptorType);
+            entries.emplace_back(VkDescriptorUpdateTemplateEntry {
+                .dstBinding = binding.binding,
+                .dstArrayElement = 0,
+                .descriptorCount = binding.descriptorCount,
+                .descriptorType = binding.descriptorType,
+                .offset = dataSize,
+                .stride = stride
+            });
+            dataSize += stride * binding.descriptorCount;
+          }
+
+          VkDescriptorUpdateTemplateCreateInfo createInfo = {};
+          createInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+          createInfo.flags = 0;
+          createInfo.descriptorUpdateEntryCount = static_cast<uint32_t>(entries.size());
+          createInfo.pDescriptorUpdateEntries = entries.empty() ? nullptr : entries.data();
+          createInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+          createInfo.descriptorSetLayout = descriptorSetLayout;
+
+          if (
+              Dispatch::functions(*this).createDescriptorUpdateTemplate(device, &createInfo, nullptr, &descriptorUpdateTemplate) != VK_SUCCESS
+              || descriptorUpdateTemplate == nullptr
+          ) {
+            throw std::runtime_error(CALL_INFO() + ": failed to create descriptor update template!");
+          }
+
+          return {
+              .device = device,
+              .entries = entries,
+              .dataSize = dataSize,
+              .value = descriptorUpdateTemplate
+          };
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void updateDescriptorSetWithTemplate(
+          DescriptorUpdateTemplate& descriptorUpdateTemplate,
+          VkDescriptorSet& descriptorSet,
+          const void* data
+      ) override {
+        try {
+          Dispatch::functions(*this).updateDescriptorSetWithTemplate(
+              descriptorUpdateTemplate.device,
+              descriptorSet,
+              descriptorUpdateTemplate.value,
+              data
+          );
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void destroyDescriptorUpdateTemplate(DescriptorUpdateTemplate& descriptorUpdateTemplate) override {
+        try {
+          if (descriptorUpdateTemplate.value != nullptr) {
+            Dispatch::functions(*this).destroyDescriptorUpdateTemplate(descriptorUpdateTemplate.device, descriptorUpdateTemplate.value, nullptr);
+            descriptorUpdateTemplate.device = nullptr;
+            descriptorUpdateTemplate.value = nullptr;
+          }
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+    protected:
+
+      std::size_t getDescriptorInfoSize(VkDescriptorType descriptorType) {
+        try {
+          switch (descriptorType) {
+            case VK_DESCRIPTOR_TYPE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+            case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+            case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+            case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+              return sizeof(VkDescriptorImageInfo);
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+            case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+            case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+              return sizeof(VkDescriptorBufferInfo);
+            case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+            case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+              return sizeof(VkBufferView);
+            default:
+              throw std::invalid_argument(CALL_INFO() + ": descriptor type '" + std::to_string(descriptorType) + "' not supported by update templates!");
+          }
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+  using DescriptorUpdateTemplateFactoryBase = BasicDescriptorUpdateTemplateFactoryBase<FunctionsDispatch>;
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/Device.hpp"
 #include "exqudens/vulkan/model/Configuration.hpp"
 
@@ -12,9 +14,12 @@ namespace exqudens::vulkan {
       virtual Device createDevice(
           VkPhysicalDevice& physicalDevice,
           Configuration& configuration,
-          QueueFamilyIndexInfo& queueFamilyIndexInfo
+          QueueFamilyIndexInfo& queueFamilyIndexInfo,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
+      virtual DeviceFunctions createDeviceFunctions(VkDevice& device) = 0;
+
       virtual void destroyDevice(Device& device) = 0;
 
   };
@@ -1,11 +1,19 @@
 #pragma once
 
+#include <source_location>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "exqudens/vulkan/Extensions.hpp"
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/DeviceFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class DeviceFactoryBase:
+  template<typename Dispatch>
+  class BasicDeviceFactoryBase:
       virtual public DeviceFactory,
       virtual public UtilityBase
   {
@@ -15,7 +23,8 @@ namespace exqudens::vulkan {
       Device createDevice(
           VkPhysicalDevice& physicalDevice,
           Configuration& configuration,
-          QueueFamilyIndexInfo& queueFamilyIndexInfo
+          QueueFamilyIndexInfo& queueFamilyIndexInfo,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           VkDevice device = nullptr;
@@ -43,6 +52,24 @@ namespace exqudens::vulkan {
 
           createInfo.pEnabledFeatures = &deviceFeatures;
 
+          // extension features are chained in front of each other
+          VkPhysicalDeviceDescriptorIndexingFeatures descriptorIndexingFeatures = {};
+          descriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+          VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT graphicsPipelineLibraryFeatures = {};
+          graphicsPipelineLibraryFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
+          graphicsPipelineLibraryFeatures.graphicsPipelineLibrary = VK_TRUE;
+          for (const char* extension : configuration.deviceExtensions) {
+            if (std::string(extension) == VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME) {
+              descriptorIndexingFeatures = createDescriptorIndexingFeatures(physicalDevice);
+              descriptorIndexingFeatures.pNext = const_cast<void*>(createInfo.pNext);
+              createInfo.pNext = &descriptorIndexingFeatures;
+            }
+            if (std::string(extension) == VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME) {
+              graphicsPipelineLibraryFeatures.pNext = const_cast<void*>(createInfo.pNext);
+              createInfo.pNext = &graphicsPipelineLibraryFeatures;
+            }
+          }
+
           createInfo.enabledExtensionCount = static_cast<uint32_t>(configuration.deviceExtensions.size());
           createInfo.ppEnabledExtensionNames = configuration.deviceExtensions.data();
 
@@ -54,24 +81,94 @@ namespace exqudens::vulkan {
           }
 
           if (
-              functions().createDevice(physicalDevice, &createInfo, nullptr, &device) != VK_SUCCESS
+              Dispatch::functions(*this).createDevice(physicalDevice, &createInfo, nullptr, &device) != VK_SUCCESS
               || device == nullptr
               ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create logical device!");
           }
 
           return {
-            .value = device
+            .value = device,
+            .functions = createDeviceFunctions(device)
           };
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
+      // entries the device does not expose, e.g. swap chain ones without the extension, stay null
+      DeviceFunctions createDeviceFunctions(VkDevice& device) override {
+        try {
+          DeviceFunctions value = {};
+          value.getDeviceQueue = (PFN_vkGetDeviceQueue) Dispatch::functions(*this).getDeviceProcAddr(device, "vkGetDeviceQueue");
+          value.getBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) Dispatch::functions(*this).getDeviceProcAddr(device, "vkGetBufferMemoryRequirements");
+          value.getImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) Dispatch::functions(*this).getDeviceProcAddr(device, "vkGetImageMemoryRequirements");
+          value.getSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) Dispatch::functions(*this).getDeviceProcAddr(device, "vkGetSwapchainImagesKHR");
+          value.updateDescriptorSets = (PFN_vkUpdateDescriptorSets) Dispatch::functions(*this).getDeviceProcAddr(device, "vkUpdateDescriptorSets");
+          value.updateDescriptorSetWithTemplate = (PFN_vkUpdateDescriptorSetWithTemplate) Dispatch::functions(*this).getDeviceProcAddr(device, "vkUpdateDescriptorSetWithTemplate");
+          value.createCommandPool = (PFN_vkCreateCommandPool) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateCommandPool");
+          value.createSwapchainKHR = (PFN_vkCreateSwapchainKHR) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateSwapchainKHR");
+          value.createBuffer = (PFN_vkCreateBuffer) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateBuffer");
+          value.createImage = (PFN_vkCreateImage) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateImage");
+          value.createImageView = (PFN_vkCreateImageView) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateImageView");
+          value.createRenderPass = (PFN_vkCreateRenderPass) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateRenderPass");
+          value.createDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateDescriptorSetLayout");
+          value.createShaderModule = (PFN_vkCreateShaderModule) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateShaderModule");
+          value.createPipelineLayout = (PFN_vkCreatePipelineLayout) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreatePipelineLayout");
+          value.createGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateGraphicsPipelines");
+          value.createComputePipelines = (PFN_vkCreateComputePipelines) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateComputePipelines");
+          value.createFramebuffer = (PFN_vkCreateFramebuffer) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateFramebuffer");
+          value.createSampler = (PFN_vkCreateSampler) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateSampler");
+          value.createDescriptorPool = (PFN_vkCreateDescriptorPool) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateDescriptorPool");
+          value.createDescriptorUpdateTemplate = (PFN_vkCreateDescriptorUpdateTemplate) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateDescriptorUpdateTemplate");
+          value.createSemaphore = (PFN_vkCreateSemaphore) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateSemaphore");
+          value.createFence = (PFN_vkCreateFence) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCreateFence");
+          value.allocateMemory = (PFN_vkAllocateMemory) Dispatch::functions(*this).getDeviceProcAddr(device, "vkAllocateMemory");
+          value.allocateDescriptorSets = (PFN_vkAllocateDescriptorSets) Dispatch::functions(*this).getDeviceProcAddr(device, "vkAllocateDescriptorSets");
+          value.allocateCommandBuffers = (PFN_vkAllocateCommandBuffers) Dispatch::functions(*this).getDeviceProcAddr(device, "vkAllocateCommandBuffers");
+          value.bindBufferMemory = (PFN_vkBindBufferMemory) Dispatch::functions(*this).getDeviceProcAddr(device, "vkBindBufferMemory");
+          value.bindImageMemory = (PFN_vkBindImageMemory) Dispatch::functions(*this).getDeviceProcAddr(device, "vkBindImageMemory");
+          value.mapMemory = (PFN_vkMapMemory) Dispatch::functions(*this).getDeviceProcAddr(device, "vkMapMemory");
+          value.unmapMemory = (PFN_vkUnmapMemory) Dispatch::functions(*this).getDeviceProcAddr(device, "vkUnmapMemory");
+          value.freeMemory = (PFN_vkFreeMemory) Dispatch::functions(*this).getDeviceProcAddr(device, "vkFreeMemory");
+          value.freeCommandBuffers = (PFN_vkFreeCommandBuffers) Dispatch::functions(*this).getDeviceProcAddr(device, "vkFreeCommandBuffers");
+          value.resetDescriptorPool = (PFN_vkResetDescriptorPool) Dispatch::functions(*this).getDeviceProcAddr(device, "vkResetDescriptorPool");
+          value.destroyFence = (PFN_vkDestroyFence) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyFence");
+          value.destroySemaphore = (PFN_vkDestroySemaphore) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroySemaphore");
+          value.destroyDescriptorPool = (PFN_vkDestroyDescriptorPool) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyDescriptorPool");
+          value.destroyDescriptorUpdateTemplate = (PFN_vkDestroyDescriptorUpdateTemplate) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyDescriptorUpdateTemplate");
+          value.destroySampler = (PFN_vkDestroySampler) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroySampler");
+          value.destroyFramebuffer = (PFN_vkDestroyFramebuffer) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyFramebuffer");
+          value.destroyPipeline = (PFN_vkDestroyPipeline) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyPipeline");
+          value.destroyPipelineLayout = (PFN_vkDestroyPipelineLayout) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyPipelineLayout");
+          value.destroyShaderModule = (PFN_vkDestroyShaderModule) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyShaderModule");
+          value.destroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyDescriptorSetLayout");
+          value.destroyRenderPass = (PFN_vkDestroyRenderPass) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyRenderPass");
+          value.destroyImageView = (PFN_vkDestroyImageView) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyImageView");
+          value.destroyImage = (PFN_vkDestroyImage) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyImage");
+          value.destroyBuffer = (PFN_vkDestroyBuffer) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyBuffer");
+          value.destroySwapchainKHR = (PFN_vkDestroySwapchainKHR) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroySwapchainKHR");
+          value.destroyCommandPool = (PFN_vkDestroyCommandPool) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyCommandPool");
+          value.destroyDevice = (PFN_vkDestroyDevice) Dispatch::functions(*this).getDeviceProcAddr(device, "vkDestroyDevice");
+          value.cmdCopyBuffer = (PFN_vkCmdCopyBuffer) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCmdCopyBuffer");
+          value.cmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCmdCopyBufferToImage");
+          value.cmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCmdPipelineBarrier");
+          value.cmdBindPipeline = (PFN_vkCmdBindPipeline) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCmdBindPipeline");
+          value.cmdDispatch = (PFN_vkCmdDispatch) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCmdDispatch");
+          value.cmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCmdDispatchIndirect");
+          value.cmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCmdBindDescriptorSets");
+          value.cmdPushConstants = (PFN_vkCmdPushConstants) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCmdPushConstants");
+          value.cmdPushDescriptorSetKHR = (PFN_vkCmdPushDescriptorSetKHR) Dispatch::functions(*this).getDeviceProcAddr(device, "vkCmdPushDescriptorSetKHR");
+          return value;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
       void destroyDevice(Device& device) override {
         try {
           if (device.value != nullptr) {
-            functions().destroyDevice(device.value, nullptr);
+            Dispatch::functions(*this).destroyDevice(device.value, nullptr);
             device.value = nullptr;
           }
         } catch (...) {
@@ -79,6 +176,48 @@ namespace exqudens::vulkan {
         }
       }
 
+    protected:
+
+      // the bindless table needs every feature below, unsupported ones fail device creation instead of the first draw
+      VkPhysicalDeviceDescriptorIndexingFeatures createDescriptorIndexingFeatures(VkPhysicalDevice& physicalDevice) {
+        try {
+          VkPhysicalDeviceDescriptorIndexingFeatures supported = {};
+          supported.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+
+          VkPhysicalDeviceFeatures2 features = {};
+          features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+          features.pNext = &supported;
+
+          Dispatch::functions(*this).getPhysicalDeviceFeatures2(physicalDevice, &features);
+
+          std::vector<std::pair<VkBool32, std::string>> required = {
+              {supported.shaderSampledImageArrayNonUniformIndexing, "shaderSampledImageArrayNonUniformIndexing"},
+              {supported.descriptorBindingSampledImageUpdateAfterBind, "descriptorBindingSampledImageUpdateAfterBind"},
+              {supported.descriptorBindingUpdateUnusedWhilePending, "descriptorBindingUpdateUnusedWhilePending"},
+              {supported.descriptorBindingPartiallyBound, "descriptorBindingPartiallyBound"},
+              {supported.runtimeDescriptorArray, "runtimeDescriptorArray"}
+          };
+          for (const auto& [value, name] : required) {
+            if (value != VK_TRUE) {
+              throw std::runtime_error(CALL_INFO() + ": descriptor indexing feature '" + name + "' requested, but not supported!");
+            }
+          }
+
+          VkPhysicalDeviceDescriptorIndexingFeatures value = {};
+          value.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+          value.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+          value.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+          value.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+          value.descriptorBindingPartiallyBound = VK_TRUE;
+          value.runtimeDescriptorArray = VK_TRUE;
+          return value;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
   };
 
+  using DeviceFactoryBase = BasicDeviceFactoryBase<FunctionsDispatch>;
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/Fence.hpp"
 
 namespace exqudens::vulkan {
@@ -8,10 +10,26 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual Fence createFence(VkDevice& device) = 0;
-      virtual Fence createFence(VkDevice& device, VkFenceCreateFlags flags) = 0;
-      virtual std::vector<Fence> createFences(VkDevice& device, std::size_t size) = 0;
-      virtual std::vector<Fence> createFences(VkDevice& device, VkFenceCreateFlags flags, std::size_t size) = 0;
+      virtual Fence createFence(
+          VkDevice& device,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual Fence createFence(
+          VkDevice& device,
+          VkFenceCreateFlags flags,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual std::vector<Fence> createFences(
+          VkDevice& device,
+          std::size_t size,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual std::vector<Fence> createFences(
+          VkDevice& device,
+          VkFenceCreateFlags flags,
+          std::size_t size,
+          std::source_location location = std::source_location::current()
+      ) = 0;
 
       virtual void destroyFence(Fence& fence) = 0;
       virtual void destroyFences(std::vector<Fence>& fences) = 0;
@@ -1,26 +1,37 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/FenceFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class FenceFactoryBase:
+  template<typename Dispatch>
+  class BasicFenceFactoryBase:
       virtual public FenceFactory,
       virtual public UtilityBase
   {
 
     public:
 
-      Fence createFence(VkDevice& device) override {
+      Fence createFence(
+          VkDevice& device,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
-          return createFence(device, VK_FENCE_CREATE_SIGNALED_BIT);
+          return createFence(device, VK_FENCE_CREATE_SIGNALED_BIT, location);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
-      Fence createFence(VkDevice& device, VkFenceCreateFlags flags) override {
+      Fence createFence(
+          VkDevice& device,
+          VkFenceCreateFlags flags,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           VkFence fence = nullptr;
 
@@ -29,7 +40,7 @@ namespace exqudens::vulkan {
           fenceInfo.flags = flags;
 
           if (
-              functions().createFence(device, &fenceInfo, nullptr, &fence) != VK_SUCCESS
+              Dispatch::functions(*this).createFence(device, &fenceInfo, nullptr, &fence) != VK_SUCCESS
               || fence == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create fence!");
@@ -44,12 +55,16 @@ namespace exqudens::vulkan {
         }
       }
 
-      std::vector<Fence> createFences(VkDevice& device, std::size_t size) override {
+      std::vector<Fence> createFences(
+          VkDevice& device,
+          std::size_t size,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           std::vector<Fence> fences;
           fences.resize(size);
           for (std::size_t i = 0; i < size; i++) {
-            fences[i] = createFence(device);
+            fences[i] = createFence(device, location);
           }
           return fences;
         } catch (...) {
@@ -57,12 +72,17 @@ namespace exqudens::vulkan {
         }
       }
 
-      std::vector<Fence> createFences(VkDevice& device, VkFenceCreateFlags flags, std::size_t size) override {
+      std::vector<Fence> createFences(
+          VkDevice& device,
+          VkFenceCreateFlags flags,
+          std::size_t size,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           std::vector<Fence> fences;
           fences.resize(size);
           for (std::size_t i = 0; i < size; i++) {
-            fences[i] = createFence(device, flags);
+            fences[i] = createFence(device, flags, location);
           }
           return fences;
         } catch (...) {
@@ -73,7 +93,7 @@ namespace exqudens::vulkan {
       void destroyFence(Fence& fence) override {
         try {
           if (fence.value != nullptr) {
-            functions().destroyFence(fence.device, fence.value, nullptr);
+            Dispatch::functions(*this).destroyFence(fence.device, fence.value, nullptr);
             fence.device = nullptr;
             fence.value = nullptr;
           }
@@ -95,4 +115,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using FenceFactoryBase = BasicFenceFactoryBase<FunctionsDispatch>;
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/FrameBufferCreateInfo.hpp"
 #include "exqudens/vulkan/model/FrameBuffer.hpp"
 
@@ -9,10 +11,15 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual FrameBuffer createFrameBuffer(VkDevice& device, const FrameBufferCreateInfo& createInfo) = 0;
+      virtual FrameBuffer createFrameBuffer(
+          VkDevice& device,
+          const FrameBufferCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) = 0;
       virtual std::vector<FrameBuffer> createFrameBuffers(
           VkDevice& device,
-          const std::vector<FrameBufferCreateInfo>& createInfo
+          const std::vector<FrameBufferCreateInfo>& createInfo,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual void destroyFrameBuffer(FrameBuffer& frameBuffer) = 0;
@@ -1,18 +1,26 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/FrameBufferFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class FrameBufferFactoryBase:
+  template<typename Dispatch>
+  class BasicFrameBufferFactoryBase:
       virtual public FrameBufferFactory,
       virtual public UtilityBase
   {
 
     public:
 
-      FrameBuffer createFrameBuffer(VkDevice& device, const FrameBufferCreateInfo& createInfo) override {
+      FrameBuffer createFrameBuffer(
+          VkDevice& device,
+          const FrameBufferCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           VkFramebuffer frameBuffer = nullptr;
 
@@ -28,7 +36,7 @@ namespace exqudens::vulkan {
           };
 
           if (
-              functions().createFramebuffer(device, &frameBufferInfo, nullptr, &frameBuffer) != VK_SUCCESS
+              Dispatch::functions(*this).createFramebuffer(device, &frameBufferInfo, nullptr, &frameBuffer) != VK_SUCCESS
               || frameBuffer == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create frame buffer!");
@@ -45,14 +53,15 @@ namespace exqudens::vulkan {
 
       std::vector<FrameBuffer> createFrameBuffers(
           VkDevice& device,
-          const std::vector<FrameBufferCreateInfo>& createInfo
+          const std::vector<FrameBufferCreateInfo>& createInfo,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           std::vector<FrameBuffer> frameBuffers;
           frameBuffers.resize(createInfo.size());
 
           for (std::size_t i = 0; i < frameBuffers.size(); i++) {
-            frameBuffers[i] = createFrameBuffer(device, createInfo[i]);
+            frameBuffers[i] = createFrameBuffer(device, createInfo[i], location);
           }
 
           return frameBuffers;
@@ -64,7 +73,7 @@ namespace exqudens::vulkan {
       void destroyFrameBuffer(FrameBuffer& frameBuffer) override {
         try {
           if (frameBuffer.value != nullptr) {
-            functions().destroyFramebuffer(frameBuffer.device, frameBuffer.value, nullptr);
+            Dispatch::functions(*this).destroyFramebuffer(frameBuffer.device, frameBuffer.value, nullptr);
             frameBuffer.device = nullptr;
             frameBuffer.value = nullptr;
           }
@@ -86,4 +95,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using FrameBufferFactoryBase = BasicFrameBufferFactoryBase<FunctionsDispatch>;
+
 }
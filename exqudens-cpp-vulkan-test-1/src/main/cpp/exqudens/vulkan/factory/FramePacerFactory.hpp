@@ -0,0 +1,19 @@
+#pragma once
+
+#include "exqudens/vulkan/model/FramePacer.hpp"
+
+namespace exqudens::vulkan {
+
+  class FramePacerFactory {
+
+    public:
+
+      virtual FramePacer createFramePacer(const PresentPolicy& presentPolicy) = 0;
+
+      virtual std::chrono::steady_clock::time_point beginFrame(FramePacer& framePacer) = 0;
+      virtual void endFrameWait(FramePacer& framePacer) = 0;
+      virtual void endFrame(FramePacer& framePacer) = 0;
+
+  };
+
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <thread>
+
+#include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/factory/FramePacerFactory.hpp"
+
+namespace exqudens::vulkan {
+
+  class FramePacerFactoryBase:
+      virtual public FramePacerFactory,
+      virtual public UtilityBase
+  {
+
+    public:
+
+      FramePacer createFramePacer(const PresentPolicy& presentPolicy) override {
+        try {
+          return {
+              .policy = presentPolicy,
+              .frameCount = 0,
+              .frameBegin = {},
+              .workBegin = {},
+              .lastPresent = {},
+              .sleepTime = std::chrono::nanoseconds::zero(),
+              .presentInterval = std::chrono::nanoseconds::zero(),
+              .frameTime = std::chrono::nanoseconds::zero(),
+              .latency = std::chrono::nanoseconds::zero(),
+              .averageLatency = std::chrono::nanoseconds::zero()
+          };
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // returns the time input should be sampled at
+      std::chrono::steady_clock::time_point beginFrame(FramePacer& framePacer) override {
+        try {
+          std::chrono::steady_clock::time_point now = currentTime();
+          std::chrono::steady_clock::time_point sleepBegin = now;
+          bool paced = framePacer.policy.mode == PresentPolicyMode::SMOOTH || framePacer.policy.mode == PresentPolicyMode::POWER_SAVING;
+
+          if (paced && framePacer.frameCount > 1) {
+            // the target may slow presentation down, never below the measured display interval
+            std::chrono::nanoseconds interval = std::max(framePacer.presentInterval, framePacer.policy.pacingInterval);
+            // start late enough that the frame is ready right when the next present slot opens
+            std::chrono::steady_clock::time_point wakeUp = framePacer.lastPresent + interval - framePacer.frameTime;
+            if (wakeUp > now) {
+              sleepUntil(wakeUp);
+              now = currentTime();
+            }
+          }
+
+          framePacer.sleepTime = now - sleepBegin;
+          framePacer.frameBegin = now;
+          framePacer.workBegin = now;
+          return now;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // called once the frame's fence has signaled, a pacing sleep shortens that wait so it is not frame work
+      void endFrameWait(FramePacer& framePacer) override {
+        try {
+          framePacer.workBegin = currentTime();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void endFrame(FramePacer& framePacer) override {
+        try {
+          std::chrono::steady_clock::time_point now = currentTime();
+
+          if (framePacer.frameCount > 0) {
+            // the pacing sleep is left out, otherwise every oversleep raises the interval the next frame is paced to
+            std::chrono::nanoseconds sample = std::max(now - framePacer.lastPresent - framePacer.sleepTime, std::chrono::nanoseconds::zero());
+            framePacer.presentInterval = smoothDuration(framePacer.presentInterval, sample, framePacer.frameCount == 1);
+          }
+          framePacer.frameTime = smoothDuration(framePacer.frameTime, now - framePacer.workBegin, framePacer.frameCount == 0);
+          framePacer.latency = now - framePacer.frameBegin;
+          framePacer.averageLatency = smoothDuration(framePacer.averageLatency, framePacer.latency, framePacer.frameCount == 0);
+
+          framePacer.lastPresent = now;
+          framePacer.frameCount++;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+    protected:
+
+      virtual std::chrono::steady_clock::time_point currentTime() {
+        try {
+          return std::chrono::steady_clock::now();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      virtual void sleepUntil(const std::chrono::steady_clock::time_point& time) {
+        try {
+          std::this_thread::sleep_until(time);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      std::chrono::nanoseconds smoothDuration(
+          const std::chrono::nanoseconds& average,
+          const std::chrono::nanoseconds& sample,
+          bool first
+      ) {
+        try {
+          if (first) {
+            return sample;
+          }
+          return (average * 7 + sample) / 8;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+  };
+
+}
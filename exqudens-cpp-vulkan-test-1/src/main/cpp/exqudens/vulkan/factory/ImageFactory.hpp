@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/ImageCreateInfo.hpp"
 #include "exqudens/vulkan/model/Image.hpp"
 
@@ -13,7 +15,8 @@ namespace exqudens::vulkan {
           VkPhysicalDevice& physicalDevice,
           VkDevice& device,
           const ImageCreateInfo& createInfo,
-          VkMemoryPropertyFlags properties
+          VkMemoryPropertyFlags properties,
+          std::source_location location = std::source_location::current()
       ) = 0;
       virtual Image createImage(
           VkPhysicalDevice& physicalDevice,
@@ -23,7 +26,8 @@ namespace exqudens::vulkan {
           VkFormat format,
           VkImageTiling tiling,
           VkImageUsageFlags usage,
-          VkMemoryPropertyFlags properties
+          VkMemoryPropertyFlags properties,
+          std::source_location location = std::source_location::current()
       ) = 0;
       virtual std::vector<Image> createImages(
           VkPhysicalDevice& physicalDevice,
@@ -34,7 +38,8 @@ namespace exqudens::vulkan {
           VkImageTiling tiling,
           VkImageUsageFlags usage,
           VkMemoryPropertyFlags properties,
-          std::size_t size
+          std::size_t size,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual void destroyImage(Image& image) = 0;
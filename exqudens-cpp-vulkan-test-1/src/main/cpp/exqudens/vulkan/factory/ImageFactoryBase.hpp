@@ -1,11 +1,15 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/ImageFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class ImageFactoryBase:
+  template<typename Dispatch>
+  class BasicImageFactoryBase:
       virtual public ImageFactory,
       virtual public UtilityBase
   {
@@ -16,7 +20,8 @@ namespace exqudens::vulkan {
           VkPhysicalDevice& physicalDevice,
           VkDevice& device,
           const ImageCreateInfo& createInfo,
-          VkMemoryPropertyFlags properties
+          VkMemoryPropertyFlags properties,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           VkImageCreateInfo imageInfo = {
@@ -39,7 +44,7 @@ namespace exqudens::vulkan {
           VkImage image = nullptr;
 
           if (
-              functions().createImage(device, &imageInfo, nullptr, &image) != VK_SUCCESS
+              Dispatch::functions(*this).createImage(device, &imageInfo, nullptr, &image) != VK_SUCCESS
               || image == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create image!");
@@ -48,18 +53,18 @@ namespace exqudens::vulkan {
           VkDeviceMemory imageMemory = nullptr;
 
           VkMemoryRequirements memRequirements;
-          functions().getImageMemoryRequirements(device, image, &memRequirements);
+          Dispatch::functions(*this).getImageMemoryRequirements(device, image, &memRequirements);
 
           VkMemoryAllocateInfo allocInfo = {};
           allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
           allocInfo.allocationSize = memRequirements.size;
           allocInfo.memoryTypeIndex = findMemoryType(physicalDevice, memRequirements.memoryTypeBits, properties);
 
-          if (functions().allocateMemory(device, &allocInfo, nullptr, &imageMemory) != VK_SUCCESS) {
+          if (Dispatch::functions(*this).allocateMemory(device, &allocInfo, nullptr, &imageMemory) != VK_SUCCESS) {
             throw std::runtime_error("failed to allocate image memory!");
           }
 
-          if (functions().bindImageMemory(device, image, imageMemory, 0) != VK_SUCCESS) {
+          if (Dispatch::functions(*this).bindImageMemory(device, image, imageMemory, 0) != VK_SUCCESS) {
             throw std::runtime_error("failed to bind image memory!");
           }
 
@@ -70,6 +75,7 @@ namespace exqudens::vulkan {
               .format = createInfo.format,
               .memory = imageMemory,
               .memorySize = memRequirements.size,
+              .allocationSize = memRequirements.size,
               .memoryProperties = properties,
               .value = image
           };
@@ -86,7 +92,8 @@ namespace exqudens::vulkan {
           VkFormat format,
           VkImageTiling tiling,
           VkImageUsageFlags usage,
-          VkMemoryPropertyFlags properties
+          VkMemoryPropertyFlags properties,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           return createImage(
@@ -110,7 +117,8 @@ namespace exqudens::vulkan {
                   .queueFamilyIndices = {},
                   .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
               },
-              properties
+              properties,
+              location
           );
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -126,13 +134,14 @@ namespace exqudens::vulkan {
           VkImageTiling tiling,
           VkImageUsageFlags usage,
           VkMemoryPropertyFlags properties,
-          std::size_t size
+          std::size_t size,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           std::vector<Image> images;
           images.resize(size);
           for (std::size_t i = 0; i < size; i++) {
-            images[i] = createImage(physicalDevice, device, width, height, format, tiling, usage, properties);
+            images[i] = createImage(physicalDevice, device, width, height, format, tiling, usage, properties, location);
           }
           return images;
         } catch (...) {
@@ -158,13 +167,13 @@ namespace exqudens::vulkan {
                 unmapMemory
                 && (image.memoryProperties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
             ) {
-              functions().unmapMemory(image.device, image.memory);
+              Dispatch::functions(*this).unmapMemory(image.device, image.memory);
             }
-            functions().freeMemory(image.device, image.memory, nullptr);
+            Dispatch::functions(*this).freeMemory(image.device, image.memory, nullptr);
             image.memory = nullptr;
           }
           if (image.value != nullptr) {
-            functions().destroyImage(image.device, image.value, nullptr);
+            Dispatch::functions(*this).destroyImage(image.device, image.value, nullptr);
             image.device = nullptr;
             image.value = nullptr;
           }
@@ -197,4 +206,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using ImageFactoryBase = BasicImageFactoryBase<FunctionsDispatch>;
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/ImageView.hpp"
 
 namespace exqudens::vulkan {
@@ -8,23 +10,36 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual ImageView createImageView(VkDevice& device, VkImage& image, VkFormat format) = 0;
       virtual ImageView createImageView(
           VkDevice& device,
           VkImage& image,
           VkFormat format,
-          VkImageAspectFlags aspectMask
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual ImageView createImageView(
+          VkDevice& device,
+          VkImage& image,
+          VkFormat format,
+          VkImageAspectFlags aspectMask,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual ImageView createImageView(
+          VkDevice& device,
+          const VkImageViewCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
       ) = 0;
       virtual std::vector<ImageView> createImageViews(
           VkDevice& device,
           std::vector<Image>& images,
-          VkFormat format
+          VkFormat format,
+          std::source_location location = std::source_location::current()
       ) = 0;
       virtual std::vector<ImageView> createImageViews(
           VkDevice& device,
           std::vector<VkImage>& images,
           VkFormat format,
-          VkImageAspectFlags aspectMask
+          VkImageAspectFlags aspectMask,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual void destroyImageView(ImageView& imageView) = 0;
@@ -1,20 +1,40 @@
 #pragma once
 
+#include <map>
+#include <mutex>
+#include <source_location>
+#include <string>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/ImageViewFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class ImageViewFactoryBase:
+  template<typename Dispatch>
+  class BasicImageViewFactoryBase:
       virtual public ImageViewFactory,
       virtual public UtilityBase
   {
 
+    protected:
+
+      // held for the cache lookups and inserts only, the driver calls run outside of it
+      std::mutex imageViewCacheMutex;
+      std::map<std::string, ImageView> imageViewCache = {};
+      std::map<std::string, std::size_t> imageViewCacheReferences = {};
+      std::map<VkImageView, std::string> imageViewCacheKeys = {};
+
     public:
 
-      ImageView createImageView(VkDevice& device, VkImage& image, VkFormat format) override {
+      ImageView createImageView(
+          VkDevice& device,
+          VkImage& image,
+          VkFormat format,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
-          return createImageView(device, image, format, VK_IMAGE_ASPECT_COLOR_BIT);
+          return createImageView(device, image, format, VK_IMAGE_ASPECT_COLOR_BIT, location);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -24,7 +44,8 @@ namespace exqudens::vulkan {
           VkDevice& device,
           VkImage& image,
           VkFormat format,
-          VkImageAspectFlags aspectMask
+          VkImageAspectFlags aspectMask,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           VkImageViewCreateInfo viewInfo = {};
@@ -42,19 +63,62 @@ namespace exqudens::vulkan {
           viewInfo.subresourceRange.baseArrayLayer = 0;
           viewInfo.subresourceRange.layerCount = 1;
 
+          return createImageView(device, viewInfo, location);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      ImageView createImageView(
+          VkDevice& device,
+          const VkImageViewCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          // extension chains are not part of the key, such views are never shared
+          bool cacheable = createInfo.pNext == nullptr;
+          std::string key = cacheable ? createImageViewKey(device, createInfo) : std::string();
+
+          if (cacheable) {
+            std::lock_guard<std::mutex> lock(imageViewCacheMutex);
+            auto cached = imageViewCache.find(key);
+            if (cached != imageViewCache.end()) {
+              imageViewCacheReferences[key]++;
+              return cached->second;
+            }
+          }
+
           VkImageView imageView = nullptr;
 
           if (
-              functions().createImageView(device, &viewInfo, nullptr, &imageView) != VK_SUCCESS
+              Dispatch::functions(*this).createImageView(device, &createInfo, nullptr, &imageView) != VK_SUCCESS
               || imageView == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create texture image view!");
           }
 
-          return {
+          ImageView value = {
               .device = device,
               .value = imageView
           };
+
+          if (cacheable) {
+            std::unique_lock<std::mutex> lock(imageViewCacheMutex);
+            auto cached = imageViewCache.find(key);
+            if (cached != imageViewCache.end()) {
+              // another thread created the same image view meanwhile, the cached one is handed out
+              imageViewCacheReferences[key]++;
+              value = cached->second;
+              lock.unlock();
+              Dispatch::functions(*this).destroyImageView(device, imageView, nullptr);
+              return value;
+            }
+            imageViewCache[key] = value;
+            imageViewCacheReferences[key] = 1;
+            imageViewCacheKeys[imageView] = key;
+          }
+
+          return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -63,14 +127,15 @@ namespace exqudens::vulkan {
       std::vector<ImageView> createImageViews(
           VkDevice& device,
           std::vector<Image>& images,
-          VkFormat format
+          VkFormat format,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           std::vector<ImageView> imageViews;
           imageViews.resize(images.size());
 
           for (uint32_t i = 0; i < imageViews.size(); i++) {
-            imageViews[i] = createImageView(device, images[i].value, format);
+            imageViews[i] = createImageView(device, images[i].value, format, location);
           }
 
           return imageViews;
@@ -83,14 +148,15 @@ namespace exqudens::vulkan {
           VkDevice& device,
           std::vector<VkImage>& images,
           VkFormat format,
-          VkImageAspectFlags aspectMask
+          VkImageAspectFlags aspectMask,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           std::vector<ImageView> imageViews;
           imageViews.resize(images.size());
 
           for (uint32_t i = 0; i < imageViews.size(); i++) {
-            imageViews[i] = createImageView(device, images[i], format, aspectMask);
+            imageViews[i] = createImageView(device, images[i], format, aspectMask, location);
           }
 
           return imageViews;
@@ -102,7 +168,22 @@ namespace exqudens::vulkan {
       void destroyImageView(ImageView& imageView) override {
         try {
           if (imageView.value != nullptr) {
-            functions().destroyImageView(imageView.device, imageView.value, nullptr);
+            std::lock_guard<std::mutex> lock(imageViewCacheMutex);
+            auto cacheKey = imageViewCacheKeys.find(imageView.value);
+            if (cacheKey != imageViewCacheKeys.end()) {
+              std::string key = cacheKey->second;
+              if (--imageViewCacheReferences[key] > 0) {
+                imageView.device = nullptr;
+                imageView.value = nullptr;
+                return;
+              }
+              imageViewCache.erase(key);
+              imageViewCacheReferences.erase(key);
+              imageViewCacheKeys.erase(cacheKey);
+            }
+          }
+          if (imageView.value != nullptr) {
+            Dispatch::functions(*this).destroyImageView(imageView.device, imageView.value, nullptr);
             imageView.device = nullptr;
             imageView.value = nullptr;
           }
@@ -122,6 +203,33 @@ namespace exqudens::vulkan {
         }
       }
 
+    protected:
+
+      std::string createImageViewKey(VkDevice& device, const VkImageViewCreateInfo& createInfo) {
+        try {
+          std::string key;
+          keyCombine(key, device);
+          keyCombine(key, createInfo.flags);
+          keyCombine(key, createInfo.image);
+          keyCombine(key, createInfo.viewType);
+          keyCombine(key, createInfo.format);
+          keyCombine(key, createInfo.components.r);
+          keyCombine(key, createInfo.components.g);
+          keyCombine(key, createInfo.components.b);
+          keyCombine(key, createInfo.components.a);
+          keyCombine(key, createInfo.subresourceRange.aspectMask);
+          keyCombine(key, createInfo.subresourceRange.baseMipLevel);
+          keyCombine(key, createInfo.subresourceRange.levelCount);
+          keyCombine(key, createInfo.subresourceRange.baseArrayLayer);
+          keyCombine(key, createInfo.subresourceRange.layerCount);
+          return key;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
   };
 
+  using ImageViewFactoryBase = BasicImageViewFactoryBase<FunctionsDispatch>;
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/Logger.hpp"
 #include "exqudens/vulkan/model/Instance.hpp"
 #include "exqudens/vulkan/model/Configuration.hpp"
@@ -12,7 +14,12 @@ namespace exqudens::vulkan {
 
       virtual Instance createInstance(
           Configuration& configuration,
-          Logger& logger
+          Logger& logger,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+
+      virtual InstanceFunctions createInstanceFunctions(
+          VkInstance& instance
       ) = 0;
 
       virtual void destroyInstance(
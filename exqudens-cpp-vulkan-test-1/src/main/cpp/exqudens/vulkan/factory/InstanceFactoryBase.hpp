@@ -1,18 +1,26 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/InstanceFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class InstanceFactoryBase:
+  template<typename Dispatch>
+  class BasicInstanceFactoryBase:
       virtual public InstanceFactory,
       virtual public UtilityBase
   {
 
     public:
 
-      Instance createInstance(Configuration& configuration, Logger& logger) override {
+      Instance createInstance(
+          Configuration& configuration,
+          Logger& logger,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           VkInstance instance = nullptr;
 
@@ -26,7 +34,7 @@ namespace exqudens::vulkan {
           appInfo.applicationVersion = VK_MAKE_VERSION(1, 0, 0);
           appInfo.pEngineName = "Exqudens Engine";
           appInfo.engineVersion = VK_MAKE_VERSION(1, 0, 0);
-          appInfo.apiVersion = VK_API_VERSION_1_0;
+          appInfo.apiVersion = VK_API_VERSION_1_1;
 
           VkInstanceCreateInfo createInfo{};
           createInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
@@ -46,22 +54,48 @@ namespace exqudens::vulkan {
             createInfo.pNext = nullptr;
           }
 
-          if (functions().createInstance(&createInfo, nullptr, &instance) != VK_SUCCESS || instance == nullptr) {
+          if (Dispatch::functions(*this).createInstance(&createInfo, nullptr, &instance) != VK_SUCCESS || instance == nullptr) {
             throw std::runtime_error(CALL_INFO() + ": failed to create instance!");
           }
 
           return {
-            .value = instance
+            .value = instance,
+            .functions = createInstanceFunctions(instance)
           };
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
+      InstanceFunctions createInstanceFunctions(VkInstance& instance) override {
+        try {
+          InstanceFunctions value = {};
+          value.enumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkEnumerateDeviceExtensionProperties");
+          value.enumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkEnumeratePhysicalDevices");
+          value.getPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkGetPhysicalDeviceProperties");
+          value.getPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkGetPhysicalDeviceQueueFamilyProperties");
+          value.getPhysicalDeviceSurfaceSupportKHR = (PFN_vkGetPhysicalDeviceSurfaceSupportKHR) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceSupportKHR");
+          value.getPhysicalDeviceFeatures = (PFN_vkGetPhysicalDeviceFeatures) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures");
+          value.getPhysicalDeviceFeatures2 = (PFN_vkGetPhysicalDeviceFeatures2) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures2");
+          value.getPhysicalDeviceSurfaceCapabilitiesKHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+          value.getPhysicalDeviceSurfaceFormatsKHR = (PFN_vkGetPhysicalDeviceSurfaceFormatsKHR) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceFormatsKHR");
+          value.getPhysicalDeviceSurfacePresentModesKHR = (PFN_vkGetPhysicalDeviceSurfacePresentModesKHR) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfacePresentModesKHR");
+          value.getPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties");
+          value.getPhysicalDeviceFormatProperties = (PFN_vkGetPhysicalDeviceFormatProperties) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkGetPhysicalDeviceFormatProperties");
+          value.getDeviceProcAddr = (PFN_vkGetDeviceProcAddr) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkGetDeviceProcAddr");
+          value.createDevice = (PFN_vkCreateDevice) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkCreateDevice");
+          value.destroySurfaceKHR = (PFN_vkDestroySurfaceKHR) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkDestroySurfaceKHR");
+          value.destroyInstance = (PFN_vkDestroyInstance) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkDestroyInstance");
+          return value;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
       void destroyInstance(Instance& instance) override {
         try {
           if (instance.value != nullptr) {
-            functions().destroyInstance(instance.value, nullptr);
+            Dispatch::functions(*this).destroyInstance(instance.value, nullptr);
             instance.value = nullptr;
           }
         } catch (...) {
@@ -71,4 +105,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using InstanceFactoryBase = BasicInstanceFactoryBase<FunctionsDispatch>;
+
 }
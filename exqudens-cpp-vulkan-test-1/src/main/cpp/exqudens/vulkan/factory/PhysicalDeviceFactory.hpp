@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/Configuration.hpp"
 #include "exqudens/vulkan/model/PhysicalDevice.hpp"
 
@@ -11,13 +13,15 @@ namespace exqudens::vulkan {
 
       virtual PhysicalDevice createPhysicalDevice(
           VkInstance& instance,
-          Configuration& configuration
+          Configuration& configuration,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual PhysicalDevice createPhysicalDevice(
           VkInstance& instance,
           Configuration& configuration,
-          const VkSurfaceKHR& surface
+          const VkSurfaceKHR& surface,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual void destroyPhysicalDevice(PhysicalDevice& physicalDevice) = 0;
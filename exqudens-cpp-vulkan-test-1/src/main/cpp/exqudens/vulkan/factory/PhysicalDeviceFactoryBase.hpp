@@ -1,20 +1,28 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/PhysicalDeviceFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class PhysicalDeviceFactoryBase:
+  template<typename Dispatch>
+  class BasicPhysicalDeviceFactoryBase:
       virtual public PhysicalDeviceFactory,
       virtual public UtilityBase
   {
 
     public:
 
-      PhysicalDevice createPhysicalDevice(VkInstance& instance, Configuration& configuration) override {
+      PhysicalDevice createPhysicalDevice(
+          VkInstance& instance,
+          Configuration& configuration,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
-          return createPhysicalDevice(instance, configuration, nullptr);
+          return createPhysicalDevice(instance, configuration, nullptr, location);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -23,7 +31,8 @@ namespace exqudens::vulkan {
       PhysicalDevice createPhysicalDevice(
           VkInstance& instance,
           Configuration& configuration,
-          const VkSurfaceKHR& surface
+          const VkSurfaceKHR& surface,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           VkPhysicalDevice physicalDevice = nullptr;
@@ -40,14 +49,14 @@ namespace exqudens::vulkan {
           }
 
           uint32_t deviceCount = 0;
-          functions().enumeratePhysicalDevices(instance, &deviceCount, nullptr);
+          Dispatch::functions(*this).enumeratePhysicalDevices(instance, &deviceCount, nullptr);
 
           if (deviceCount == 0) {
             throw std::runtime_error(CALL_INFO() + ": failed to find GPUs with Vulkan support!");
           }
 
           std::vector<VkPhysicalDevice> devices(deviceCount);
-          functions().enumeratePhysicalDevices(instance, &deviceCount, devices.data());
+          Dispatch::functions(*this).enumeratePhysicalDevices(instance, &deviceCount, devices.data());
 
           QueueFamilyIndexInfo queueFamilyIndexInfo = {};
           std::optional<SwapChainSupportDetails> swapChainSupportDetails = {};
@@ -73,7 +82,7 @@ namespace exqudens::vulkan {
             }
 
             VkPhysicalDeviceFeatures supportedFeatures;
-            functions().getPhysicalDeviceFeatures(object, &supportedFeatures);
+            Dispatch::functions(*this).getPhysicalDeviceFeatures(object, &supportedFeatures);
 
             bool anisotropyAdequate = true;
             if (configuration.anisotropyRequired) {
@@ -119,4 +128,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using PhysicalDeviceFactoryBase = BasicPhysicalDeviceFactoryBase<FunctionsDispatch>;
+
 }
@@ -1,10 +1,16 @@
 #pragma once
 
+#include <map>
+#include <source_location>
+#include <span>
+
 #include "exqudens/vulkan/Utility.hpp"
 #include "exqudens/vulkan/model/Shader.hpp"
+#include "exqudens/vulkan/model/SpecializationInfo.hpp"
 #include "exqudens/vulkan/model/PipelineLayoutCreateInfo.hpp"
 #include "exqudens/vulkan/model/GraphicsPipelineCreateInfo.hpp"
 #include "exqudens/vulkan/model/Pipeline.hpp"
+#include "exqudens/vulkan/model/PipelineCacheStatistics.hpp"
 
 namespace exqudens::vulkan {
 
@@ -13,6 +19,10 @@ namespace exqudens::vulkan {
     public:
 
       virtual Shader createShader(VkDevice& device, const std::string& path) = 0;
+      virtual Shader createShader(VkDevice& device, const std::string& path, const std::vector<char>& code) = 0;
+      virtual Shader createShader(VkDevice& device, const std::string& path, std::span<const uint32_t> code) = 0;
+
+      virtual void setEmbeddedShaders(const std::map<std::string, std::span<const uint32_t>>& shaders) = 0;
 
       virtual Pipeline createPipeline(
           VkDevice& device,
@@ -20,14 +30,26 @@ namespace exqudens::vulkan {
           const std::vector<VkVertexInputBindingDescription>& vertexBindingDescriptions,
           const std::vector<VkVertexInputAttributeDescription>& vertexAttributeDescriptions,
           const PipelineLayoutCreateInfo& layoutCreateInfo,
-          const GraphicsPipelineCreateInfo& createInfo
+          const GraphicsPipelineCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual Pipeline createPipeline(
+          VkDevice& device,
+          const std::vector<std::string>& shaderPaths,
+          const std::map<VkShaderStageFlagBits, SpecializationInfo>& specializationInfos,
+          const std::vector<VkVertexInputBindingDescription>& vertexBindingDescriptions,
+          const std::vector<VkVertexInputAttributeDescription>& vertexAttributeDescriptions,
+          const PipelineLayoutCreateInfo& layoutCreateInfo,
+          const GraphicsPipelineCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual Pipeline createGraphicsPipeline(
           VkDevice& device,
           const VkExtent2D& extent,
           const std::vector<std::string>& shaderPaths,
-          VkRenderPass& renderPass
+          VkRenderPass& renderPass,
+          std::source_location location = std::source_location::current()
       ) = 0;
       virtual Pipeline createGraphicsPipeline(
           VkDevice& device,
@@ -37,13 +59,20 @@ namespace exqudens::vulkan {
           VkFrontFace frontFace,
           std::vector<VkDescriptorSetLayout> descriptorSetLayouts,
           std::vector<VkVertexInputBindingDescription> vertexBindingDescriptions,
-          std::vector<VkVertexInputAttributeDescription> vertexAttributeDescriptions
+          std::vector<VkVertexInputAttributeDescription> vertexAttributeDescriptions,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual void destroyShader(Shader& shader) = 0;
 
       virtual void destroyPipeline(Pipeline& pipeline) = 0;
 
+      virtual void setGraphicsPipelineLibraryEnabled(bool enabled, bool linkTimeOptimizationEnabled) = 0;
+
+      virtual void destroyPipelineLibraries() = 0;
+
+      virtual PipelineCacheStatistics getPipelineCacheStatistics() = 0;
+
   };
 
 }
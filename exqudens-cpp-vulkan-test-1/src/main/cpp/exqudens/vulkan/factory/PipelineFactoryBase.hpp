@@ -1,22 +1,81 @@
 #pragma once
 
+#include <set>
+#include <map>
+#include <mutex>
+#include <source_location>
+#include <span>
+#include <string>
+#include <chrono>
+#include <future>
+#include <type_traits>
+
+#include "exqudens/vulkan/Extensions.hpp"
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/PipelineFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class PipelineFactoryBase:
+  template<typename Dispatch>
+  class BasicPipelineFactoryBase:
       virtual public PipelineFactory,
       virtual public UtilityBase
   {
 
+    protected:
+
+      // held for the cache lookups, inserts and statistics only, the driver calls run outside of it
+      std::mutex pipelineCacheMutex;
+      std::size_t pipelineCacheHits = 0;
+      std::size_t pipelineCacheMisses = 0;
+
+      std::map<std::string, Pipeline> pipelineCache = {};
+      std::map<std::string, std::size_t> pipelineCacheReferences = {};
+      std::map<VkPipeline, std::string> pipelineCacheKeys = {};
+
+      std::map<std::string, std::span<const uint32_t>> embeddedShaders = {};
+
+      bool graphicsPipelineLibraryEnabled = false;
+      bool graphicsPipelineLibraryLinkTimeOptimizationEnabled = false;
+
+      // guarded by the cache mutex as well
+      std::map<std::string, Pipeline> pipelineLibraries = {};
+      std::map<std::string, std::future<Pipeline>> pipelineOptimizations = {};
+      std::map<std::string, std::vector<VkPipeline>> pipelineRetired = {};
+
     public:
 
       Shader createShader(VkDevice& device, const std::string& path) override {
         try {
-          VkShaderModule shaderModule = nullptr;
+          auto embedded = embeddedShaders.find(path);
+          if (embedded != embeddedShaders.end()) {
+            return createShader(device, path, embedded->second);
+          }
+          return createShader(device, path, readFile(path));
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      Shader createShader(VkDevice& device, const std::string& path, const std::vector<char>& code) override {
+        try {
+          if (code.size() % sizeof(uint32_t) != 0) {
+            throw std::runtime_error(CALL_INFO() + ": failed to create shader module code size is not a multiple of 4!");
+          }
+          return createShader(
+              device,
+              path,
+              std::span<const uint32_t>(reinterpret_cast<const uint32_t*>(code.data()), code.size() / sizeof(uint32_t))
+          );
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          const std::vector<char>& code = readFile(path);
+      Shader createShader(VkDevice& device, const std::string& path, std::span<const uint32_t> code) override {
+        try {
+          VkShaderModule shaderModule = nullptr;
 
           if (code.empty()) {
             throw std::runtime_error(CALL_INFO() + ": failed to create shader module code is empty!");
@@ -24,11 +83,11 @@ namespace exqudens::vulkan {
 
           VkShaderModuleCreateInfo createInfo{};
           createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-          createInfo.codeSize = code.size();
-          createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());
+          createInfo.codeSize = code.size_bytes();
+          createInfo.pCode = code.data();
 
           if (
-              functions().createShaderModule(device, &createInfo, nullptr, &shaderModule) != VK_SUCCESS
+              Dispatch::functions(*this).createShaderModule(device, &createInfo, nullptr, &shaderModule) != VK_SUCCESS
               || shaderModule == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create shader module!");
@@ -37,13 +96,7 @@ namespace exqudens::vulkan {
           VkPipelineShaderStageCreateInfo pipelineShaderStageCreateInfo = {};
           pipelineShaderStageCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
 
-          if (path.ends_with(".vert.spv")) {
-            pipelineShaderStageCreateInfo.stage = VkShaderStageFlagBits::VK_SHADER_STAGE_VERTEX_BIT;
-          } else if (path.ends_with(".frag.spv")) {
-            pipelineShaderStageCreateInfo.stage = VkShaderStageFlagBits::VK_SHADER_STAGE_FRAGMENT_BIT;
-          } else {
-            throw std::invalid_argument(CALL_INFO() + ": '" + path + "' failed to create shader!");
-          }
+          pipelineShaderStageCreateInfo.stage = getShaderStage(path);
 
           pipelineShaderStageCreateInfo.module = shaderModule;
           pipelineShaderStageCreateInfo.pName = "main";
@@ -64,25 +117,78 @@ namespace exqudens::vulkan {
           const std::vector<VkVertexInputBindingDescription>& vertexBindingDescriptions,
           const std::vector<VkVertexInputAttributeDescription>& vertexAttributeDescriptions,
           const PipelineLayoutCreateInfo& layoutCreateInfo,
-          const GraphicsPipelineCreateInfo& createInfo
+          const GraphicsPipelineCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
-          VkPipelineLayout pipelineLayout = nullptr;
+          return createPipeline(
+              device,
+              shaderPaths,
+              {},
+              vertexBindingDescriptions,
+              vertexAttributeDescriptions,
+              layoutCreateInfo,
+              createInfo,
+              location
+          );
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
 
-          VkPipelineLayoutCreateInfo vkLayoutCreateInfo = {
-              .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
-              .flags = layoutCreateInfo.flags,
-              .setLayoutCount = static_cast<uint32_t>(layoutCreateInfo.setLayouts.size()),
-              .pSetLayouts = layoutCreateInfo.setLayouts.empty() ? nullptr : layoutCreateInfo.setLayouts.data(),
-              .pushConstantRangeCount = static_cast<uint32_t>(layoutCreateInfo.pushConstantRanges.size()),
-              .pPushConstantRanges = layoutCreateInfo.pushConstantRanges.empty() ? nullptr : layoutCreateInfo.pushConstantRanges.data()
-          };
+      Pipeline createPipeline(
+          VkDevice& device,
+          const std::vector<std::string>& shaderPaths,
+          const std::map<VkShaderStageFlagBits, SpecializationInfo>& specializationInfos,
+          const std::vector<VkVertexInputBindingDescription>& vertexBindingDescriptions,
+          const std::vector<VkVertexInputAttributeDescription>& vertexAttributeDescriptions,
+          const PipelineLayoutCreateInfo& layoutCreateInfo,
+          const GraphicsPipelineCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          // the key is made of the shader code, a file changed on disk is picked up by the next create
+          std::vector<std::vector<char>> shaderFiles;
+          shaderFiles.resize(shaderPaths.size());
+          std::vector<std::span<const uint32_t>> shaderCodes;
+          shaderCodes.resize(shaderPaths.size());
+          for (std::size_t i = 0; i < shaderPaths.size(); i++) {
+            auto embedded = embeddedShaders.find(shaderPaths[i]);
+            if (embedded != embeddedShaders.end()) {
+              shaderCodes[i] = embedded->second;
+            } else {
+              shaderFiles[i] = readFile(shaderPaths[i]);
+              if (shaderFiles[i].size() % sizeof(uint32_t) != 0) {
+                throw std::runtime_error(CALL_INFO() + ": '" + shaderPaths[i] + "' code size is not a multiple of 4!");
+              }
+              shaderCodes[i] = std::span<const uint32_t>(
+                  reinterpret_cast<const uint32_t*>(shaderFiles[i].data()),
+                  shaderFiles[i].size() / sizeof(uint32_t)
+              );
+            }
+          }
 
-          if (
-              functions().createPipelineLayout(device, &vkLayoutCreateInfo, nullptr, &pipelineLayout) != VK_SUCCESS
-              || pipelineLayout == nullptr
-          ) {
-            throw std::runtime_error(CALL_INFO() + ": failed to create pipeline layout!");
+          std::string key = createPipelineKey(
+              device,
+              shaderPaths,
+              shaderCodes,
+              specializationInfos,
+              vertexBindingDescriptions,
+              vertexAttributeDescriptions,
+              layoutCreateInfo,
+              createInfo
+          );
+
+          {
+            std::lock_guard<std::mutex> lock(pipelineCacheMutex);
+            auto cached = pipelineCache.find(key);
+            if (cached != pipelineCache.end()) {
+              pipelineCacheHits++;
+              pipelineCacheReferences[key]++;
+              updateLinkTimeOptimizedPipeline(key);
+              return cached->second;
+            }
+            pipelineCacheMisses++;
           }
 
           VkPipeline pipeline = nullptr;
@@ -94,9 +200,46 @@ namespace exqudens::vulkan {
           shaders.resize(shaderPaths.size());
           std::vector<VkPipelineShaderStageCreateInfo> shaderStages;
           shaderStages.resize(shaders.size());
+          std::vector<std::vector<VkSpecializationMapEntry>> specializationMapEntries;
+          specializationMapEntries.resize(shaders.size());
+          std::vector<std::vector<char>> specializationData;
+          specializationData.resize(shaders.size());
+          std::vector<VkSpecializationInfo> vkSpecializationInfos;
+          vkSpecializationInfos.resize(shaders.size());
           for (std::size_t i = 0; i < shaderPaths.size(); i++) {
-            shaders[i] = createShader(device, shaderPaths[i]);
+            shaders[i] = createShader(device, shaderPaths[i], shaderCodes[i]);
             shaderStages[i] = shaders[i].pipelineShaderStageCreateInfo;
+
+            auto specializationInfo = specializationInfos.find(shaderStages[i].stage);
+            if (specializationInfo != specializationInfos.end()) {
+              vkSpecializationInfos[i] = createSpecializationInfo(
+                  specializationInfo->second,
+                  specializationMapEntries[i],
+                  specializationData[i]
+              );
+              shaderStages[i].pSpecializationInfo = &vkSpecializationInfos[i];
+            }
+          }
+
+          VkPipelineLayout pipelineLayout = nullptr;
+
+          VkPipelineLayoutCreateInfo vkLayoutCreateInfo = {
+              .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+              .flags = layoutCreateInfo.flags,
+              .setLayoutCount = static_cast<uint32_t>(layoutCreateInfo.setLayouts.size()),
+              .pSetLayouts = layoutCreateInfo.setLayouts.empty() ? nullptr : layoutCreateInfo.setLayouts.data(),
+              .pushConstantRangeCount = static_cast<uint32_t>(layoutCreateInfo.pushConstantRanges.size()),
+              .pPushConstantRanges = layoutCreateInfo.pushConstantRanges.empty() ? nullptr : layoutCreateInfo.pushConstantRanges.data()
+          };
+
+          if (
+              Dispatch::functions(*this).createPipelineLayout(device, &vkLayoutCreateInfo, nullptr, &pipelineLayout) != VK_SUCCESS
+              || pipelineLayout == nullptr
+          ) {
+            for (Shader& shader : shaders) {
+              destroyShader(shader);
+            }
+            throw std::runtime_error(CALL_INFO() + ": failed to create pipeline layout!");
           }
 
           iCreateInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
@@ -112,8 +255,9 @@ namespace exqudens::vulkan {
 
           iCreateInfo.pVertexInputState = &vertexInputInfo;
 
+          VkPipelineInputAssemblyStateCreateInfo vkPipelineInputAssemblyStateCreateInfo = {};
           if (createInfo.inputAssemblyState.has_value()) {
-            VkPipelineInputAssemblyStateCreateInfo vkPipelineInputAssemblyStateCreateInfo = {
+            vkPipelineInputAssemblyStateCreateInfo = {
                 .sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
                 .flags = createInfo.inputAssemblyState.value().flags,
                 .topology = createInfo.inputAssemblyState.value().topology,
@@ -123,8 +267,9 @@ namespace exqudens::vulkan {
             iCreateInfo.pInputAssemblyState = &vkPipelineInputAssemblyStateCreateInfo;
           }
 
+          VkPipelineTessellationStateCreateInfo vkPipelineTessellationStateCreateInfo = {};
           if (createInfo.tessellationState.has_value()) {
-            VkPipelineTessellationStateCreateInfo vkPipelineTessellationStateCreateInfo {
+            vkPipelineTessellationStateCreateInfo = {
                 .sType = VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO,
                 .flags = createInfo.tessellationState.value().flags,
                 .patchControlPoints = createInfo.tessellationState.value().patchControlPoints
@@ -132,8 +277,9 @@ namespace exqudens::vulkan {
             iCreateInfo.pTessellationState = &vkPipelineTessellationStateCreateInfo;
           }
 
+          VkPipelineViewportStateCreateInfo viewportState = {};
           if (createInfo.viewportState.has_value()) {
-            VkPipelineViewportStateCreateInfo viewportState = {
+            viewportState = {
                 .sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
                 .viewportCount = static_cast<uint32_t>(createInfo.viewportState.value().viewports.size()),
                 .pViewports = createInfo.viewportState.value().viewports.empty() ? nullptr : createInfo.viewportState.value().viewports.data(),
@@ -144,8 +290,9 @@ namespace exqudens::vulkan {
             iCreateInfo.pViewportState = &viewportState;
           }
 
+          VkPipelineRasterizationStateCreateInfo vkPipelineRasterizationStateCreateInfo = {};
           if (createInfo.rasterizationState.has_value()) {
-            VkPipelineRasterizationStateCreateInfo vkPipelineRasterizationStateCreateInfo = {
+            vkPipelineRasterizationStateCreateInfo = {
                 .sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
                 .flags = createInfo.rasterizationState.value().flags,
                 .depthClampEnable = createInfo.rasterizationState.value().depthClampEnable,
@@ -162,8 +309,9 @@ namespace exqudens::vulkan {
             iCreateInfo.pRasterizationState = &vkPipelineRasterizationStateCreateInfo;
           }
 
+          VkPipelineMultisampleStateCreateInfo vkPipelineMultisampleStateCreateInfo = {};
           if (createInfo.multisampleState.has_value()) {
-            VkPipelineMultisampleStateCreateInfo vkPipelineMultisampleStateCreateInfo = {
+            vkPipelineMultisampleStateCreateInfo = {
                 .sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
                 .flags = createInfo.multisampleState.value().flags,
                 .rasterizationSamples = createInfo.multisampleState.value().rasterizationSamples,
@@ -176,8 +324,9 @@ namespace exqudens::vulkan {
             iCreateInfo.pMultisampleState = &vkPipelineMultisampleStateCreateInfo;
           }
 
+          VkPipelineDepthStencilStateCreateInfo vkPipelineDepthStencilStateCreateInfo = {};
           if (createInfo.depthStencilState.has_value()) {
-            VkPipelineDepthStencilStateCreateInfo vkPipelineDepthStencilStateCreateInfo = {
+            vkPipelineDepthStencilStateCreateInfo = {
                 .sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
                 .flags = createInfo.depthStencilState.value().flags,
                 .depthTestEnable = createInfo.depthStencilState.value().depthTestEnable,
@@ -193,8 +342,9 @@ namespace exqudens::vulkan {
             iCreateInfo.pDepthStencilState = &vkPipelineDepthStencilStateCreateInfo;
           }
 
+          VkPipelineColorBlendStateCreateInfo colorBlending = {};
           if (createInfo.colorBlendState.has_value()) {
-            VkPipelineColorBlendStateCreateInfo colorBlending = {
+            colorBlending = {
                 .sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
                 .flags = createInfo.colorBlendState.value().flags,
                 .logicOpEnable = createInfo.colorBlendState.value().logicOpEnable,
@@ -210,8 +360,9 @@ namespace exqudens::vulkan {
             iCreateInfo.pColorBlendState = &colorBlending;
           }
 
+          VkPipelineDynamicStateCreateInfo dynamicState = {};
           if (createInfo.dynamicState.has_value()) {
-            VkPipelineDynamicStateCreateInfo dynamicState {
+            dynamicState = {
                 .sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
                 .flags = createInfo.dynamicState.value().flags,
                 .dynamicStateCount = static_cast<uint32_t>(createInfo.dynamicState.value().dynamicStates.size()),
@@ -226,10 +377,46 @@ namespace exqudens::vulkan {
           iCreateInfo.basePipelineHandle = createInfo.basePipelineHandle;
           iCreateInfo.basePipelineIndex = createInfo.basePipelineIndex;
 
-          if (
-              functions().createGraphicsPipelines(device, VK_NULL_HANDLE, 1, &iCreateInfo, nullptr, &pipeline) != VK_SUCCESS
+          std::vector<VkPipeline> libraries = {};
+          if (graphicsPipelineLibraryEnabled) {
+            try {
+              libraries = createPipelineLibraries(
+                  device,
+                  createPipelineLibraryKeys(
+                      device,
+                      shaderPaths,
+                      shaderCodes,
+                      specializationInfos,
+                      vertexBindingDescriptions,
+                      vertexAttributeDescriptions,
+                      layoutCreateInfo,
+                      createInfo
+                  ),
+                  iCreateInfo
+              );
+              pipeline = linkPipelineLibraries(
+                  Dispatch::functions(*this).createGraphicsPipelines,
+                  device,
+                  libraries,
+                  pipelineLayout,
+                  false
+              );
+            } catch (...) {
+              // cached parts stay, they are released with the other libraries
+              for (Shader& shader : shaders) {
+                destroyShader(shader);
+              }
+              Dispatch::functions(*this).destroyPipelineLayout(device, pipelineLayout, nullptr);
+              throw;
+            }
+          } else if (
+              Dispatch::functions(*this).createGraphicsPipelines(device, VK_NULL_HANDLE, 1, &iCreateInfo, nullptr, &pipeline) != VK_SUCCESS
               || pipeline == nullptr
           ) {
+            for (Shader& shader : shaders) {
+              destroyShader(shader);
+            }
+            Dispatch::functions(*this).destroyPipelineLayout(device, pipelineLayout, nullptr);
             throw std::runtime_error(CALL_INFO() + ": failed to create graphics pipeline!");
           }
 
@@ -237,11 +424,42 @@ namespace exqudens::vulkan {
             destroyShader(shader);
           }
 
-          return {
+          Pipeline value = {
               .device = device,
               .layout = pipelineLayout,
               .value = pipeline
           };
+
+          std::unique_lock<std::mutex> lock(pipelineCacheMutex);
+          auto cached = pipelineCache.find(key);
+          if (cached != pipelineCache.end()) {
+            // another thread created the same pipeline meanwhile, the cached one is handed out
+            pipelineCacheReferences[key]++;
+            Pipeline cachedValue = cached->second;
+            lock.unlock();
+            Dispatch::functions(*this).destroyPipeline(device, pipeline, nullptr);
+            Dispatch::functions(*this).destroyPipelineLayout(device, pipelineLayout, nullptr);
+            return cachedValue;
+          }
+          pipelineCache[key] = value;
+          pipelineCacheReferences[key] = 1;
+          pipelineCacheKeys[pipeline] = key;
+
+          // the fast link is handed out now, the optimized one replaces it on a later hit
+          if (!libraries.empty() && graphicsPipelineLibraryLinkTimeOptimizationEnabled) {
+            pipelineOptimizations[key] = std::async(
+                std::launch::async,
+                [createGraphicsPipelines = Dispatch::functions(*this).createGraphicsPipelines, device, libraries, pipelineLayout]() {
+                  return Pipeline {
+                      .device = device,
+                      .layout = nullptr,
+                      .value = linkPipelineLibraries(createGraphicsPipelines, device, libraries, pipelineLayout, true)
+                  };
+                }
+            );
+          }
+
+          return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -251,7 +469,8 @@ namespace exqudens::vulkan {
           VkDevice& device,
           const VkExtent2D& extent,
           const std::vector<std::string>& shaderPaths,
-          VkRenderPass& renderPass
+          VkRenderPass& renderPass,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           VkFrontFace frontFace = VkFrontFace::VK_FRONT_FACE_CLOCKWISE;
@@ -266,7 +485,8 @@ namespace exqudens::vulkan {
               frontFace,
               descriptorSetLayouts,
               vertexBindingDescriptions,
-              vertexAttributeDescriptions
+              vertexAttributeDescriptions,
+              location
           );
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -281,7 +501,8 @@ namespace exqudens::vulkan {
           VkFrontFace frontFace,
           std::vector<VkDescriptorSetLayout> descriptorSetLayouts,
           std::vector<VkVertexInputBindingDescription> vertexBindingDescriptions,
-          std::vector<VkVertexInputAttributeDescription> vertexAttributeDescriptions
+          std::vector<VkVertexInputAttributeDescription> vertexAttributeDescriptions,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           return createPipeline(
@@ -369,12 +590,19 @@ namespace exqudens::vulkan {
                       },
                       .blendConstants = {0.0f, 0.0f, 0.0f, 0.0f}
                   },
-                  .dynamicState = {},
+                  .dynamicState = PipelineDynamicStateCreateInfo {
+                      .flags = 0,
+                      .dynamicStates = {
+                          VK_DYNAMIC_STATE_VIEWPORT,
+                          VK_DYNAMIC_STATE_SCISSOR
+                      }
+                  },
                   .renderPass = renderPass,
                   .subpass = 0,
                   .basePipelineHandle = nullptr,
                   .basePipelineIndex = 0
-              }
+              },
+              location
           );
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -383,12 +611,51 @@ namespace exqudens::vulkan {
 
       void destroyPipeline(Pipeline& pipeline) override {
         try {
+          std::vector<VkPipeline> values = {};
+          std::future<Pipeline> optimization = {};
           if (pipeline.value != nullptr) {
-            functions().destroyPipeline(pipeline.device, pipeline.value, nullptr);
+            std::lock_guard<std::mutex> lock(pipelineCacheMutex);
+            auto cacheKey = pipelineCacheKeys.find(pipeline.value);
+            if (cacheKey != pipelineCacheKeys.end()) {
+              std::string key = cacheKey->second;
+              if (--pipelineCacheReferences[key] > 0) {
+                pipeline.value = nullptr;
+                pipeline.layout = nullptr;
+                pipeline.device = nullptr;
+                return;
+              }
+
+              // the last reference takes the handles replaced by an optimized link along
+              values = pipelineRetired[key];
+              values.emplace_back(pipelineCache[key].value);
+              auto pending = pipelineOptimizations.find(key);
+              if (pending != pipelineOptimizations.end()) {
+                optimization = std::move(pending->second);
+                pipelineOptimizations.erase(pending);
+              }
+              for (const VkPipeline& value : values) {
+                pipelineCacheKeys.erase(value);
+              }
+              pipelineCache.erase(key);
+              pipelineCacheReferences.erase(key);
+              pipelineRetired.erase(key);
+              pipeline.value = nullptr;
+            }
+          }
+          if (optimization.valid()) {
+            values.emplace_back(optimization.get().value);
+          }
+          for (const VkPipeline& value : values) {
+            if (value != nullptr) {
+              Dispatch::functions(*this).destroyPipeline(pipeline.device, value, nullptr);
+            }
+          }
+          if (pipeline.value != nullptr) {
+            Dispatch::functions(*this).destroyPipeline(pipeline.device, pipeline.value, nullptr);
             pipeline.value = nullptr;
           }
           if (pipeline.layout != nullptr) {
-            vkDestroyPipelineLayout(pipeline.device, pipeline.layout, nullptr);
+            Dispatch::functions(*this).destroyPipelineLayout(pipeline.device, pipeline.layout, nullptr);
             pipeline.layout = nullptr;
           }
           pipeline.device = nullptr;
@@ -397,10 +664,62 @@ namespace exqudens::vulkan {
         }
       }
 
+      void setEmbeddedShaders(const std::map<std::string, std::span<const uint32_t>>& shaders) override {
+        try {
+          embeddedShaders = shaders;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void setGraphicsPipelineLibraryEnabled(bool enabled, bool linkTimeOptimizationEnabled) override {
+        try {
+          graphicsPipelineLibraryEnabled = enabled;
+          graphicsPipelineLibraryLinkTimeOptimizationEnabled = enabled && linkTimeOptimizationEnabled;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void destroyPipelineLibraries() override {
+        try {
+          std::map<std::string, Pipeline> libraries = {};
+          std::map<std::string, std::future<Pipeline>> optimizations = {};
+          {
+            std::lock_guard<std::mutex> lock(pipelineCacheMutex);
+            libraries.swap(pipelineLibraries);
+            optimizations.swap(pipelineOptimizations);
+          }
+          // background links still read the libraries, their results were never handed out
+          for (auto& [key, optimization] : optimizations) {
+            Pipeline optimized = optimization.get();
+            Dispatch::functions(*this).destroyPipeline(optimized.device, optimized.value, nullptr);
+          }
+          for (auto& [key, library] : libraries) {
+            Dispatch::functions(*this).destroyPipeline(library.device, library.value, nullptr);
+          }
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      PipelineCacheStatistics getPipelineCacheStatistics() override {
+        try {
+          std::lock_guard<std::mutex> lock(pipelineCacheMutex);
+          return {
+              .hits = pipelineCacheHits,
+              .misses = pipelineCacheMisses,
+              .size = pipelineCache.size()
+          };
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
       void destroyShader(Shader& shader) override {
         try {
           if (shader.shaderModule != nullptr) {
-            functions().destroyShaderModule(shader.device, shader.shaderModule, nullptr);
+            Dispatch::functions(*this).destroyShaderModule(shader.device, shader.shaderModule, nullptr);
             shader.device = nullptr;
             shader.shaderModule = nullptr;
           }
@@ -410,6 +729,486 @@ namespace exqudens::vulkan {
         }
       }
 
+    protected:
+
+      VkSpecializationInfo createSpecializationInfo(
+          const SpecializationInfo& specializationInfo,
+          std::vector<VkSpecializationMapEntry>& mapEntries,
+          std::vector<char>& data
+      ) {
+        try {
+          mapEntries.clear();
+          data.clear();
+
+          for (auto const& [constantId, constant] : specializationInfo.constants) {
+            std::visit(
+                [&mapEntries, &data, constantId = constantId](auto&& value) {
+                  using T = std::decay_t<decltype(value)>;
+                  // booleans are VkBool32 on the shader side
+                  if constexpr (std::is_same_v<T, bool>) {
+                    VkBool32 bool32 = value ? VK_TRUE : VK_FALSE;
+                    mapEntries.emplace_back(VkSpecializationMapEntry {
+                        .constantID = constantId,
+                        .offset = static_cast<uint32_t>(data.size()),
+                        .size = sizeof(VkBool32)
+                    });
+                    data.insert(data.end(), reinterpret_cast<const char*>(&bool32), reinterpret_cast<const char*>(&bool32) + sizeof(VkBool32));
+                  } else {
+                    mapEntries.emplace_back(VkSpecializationMapEntry {
+                        .constantID = constantId,
+                        .offset = static_cast<uint32_t>(data.size()),
+                        .size = sizeof(T)
+                    });
+                    data.insert(data.end(), reinterpret_cast<const char*>(&value), reinterpret_cast<const char*>(&value) + sizeof(T));
+                  }
+                },
+                constant
+            );
+          }
+
+          return {
+              .mapEntryCount = static_cast<uint32_t>(mapEntries.size()),
+              .pMapEntries = mapEntries.empty() ? nullptr : mapEntries.data(),
+              .dataSize = data.size(),
+              .pData = data.empty() ? nullptr : data.data()
+          };
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      VkShaderStageFlagBits getShaderStage(const std::string& path) {
+        try {
+          if (path.ends_with(".vert.spv")) {
+            return VkShaderStageFlagBits::VK_SHADER_STAGE_VERTEX_BIT;
+          } else if (path.ends_with(".frag.spv")) {
+            return VkShaderStageFlagBits::VK_SHADER_STAGE_FRAGMENT_BIT;
+          } else if (path.ends_with(".comp.spv")) {
+            return VkShaderStageFlagBits::VK_SHADER_STAGE_COMPUTE_BIT;
+          } else {
+            throw std::invalid_argument(CALL_INFO() + ": '" + path + "' failed to create shader!");
+          }
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // one library per part: vertex input, pre-rasterization, fragment shader, fragment output
+      std::vector<VkPipeline> createPipelineLibraries(
+          VkDevice& device,
+          const std::vector<std::string>& libraryKeys,
+          const VkGraphicsPipelineCreateInfo& createInfo
+      ) {
+        try {
+          std::vector<VkGraphicsPipelineLibraryFlagsEXT> parts = {
+              VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+              VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT,
+              VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT,
+              VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT
+          };
+
+          std::vector<VkPipeline> libraries;
+          libraries.resize(parts.size());
+          for (std::size_t i = 0; i < parts.size(); i++) {
+            {
+              std::lock_guard<std::mutex> lock(pipelineCacheMutex);
+              auto cached = pipelineLibraries.find(libraryKeys[i]);
+              if (cached != pipelineLibraries.end()) {
+                libraries[i] = cached->second.value;
+                continue;
+              }
+            }
+
+            VkPipeline library = createPipelineLibrary(device, parts[i], createInfo);
+
+            std::unique_lock<std::mutex> lock(pipelineCacheMutex);
+            auto cached = pipelineLibraries.find(libraryKeys[i]);
+            if (cached != pipelineLibraries.end()) {
+              // another thread created the same part meanwhile
+              libraries[i] = cached->second.value;
+              lock.unlock();
+              Dispatch::functions(*this).destroyPipeline(device, library, nullptr);
+              continue;
+            }
+            pipelineLibraries[libraryKeys[i]] = {
+                .device = device,
+                .layout = nullptr,
+                .value = library
+            };
+            libraries[i] = library;
+          }
+
+          return libraries;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      VkPipeline createPipelineLibrary(
+          VkDevice& device,
+          VkGraphicsPipelineLibraryFlagsEXT part,
+          VkGraphicsPipelineCreateInfo createInfo
+      ) {
+        try {
+          VkPipeline library = nullptr;
+
+          std::vector<VkPipelineShaderStageCreateInfo> shaderStages = {};
+          for (uint32_t i = 0; i < createInfo.stageCount; i++) {
+            bool fragment = createInfo.pStages[i].stage == VK_SHADER_STAGE_FRAGMENT_BIT;
+            if (
+                (part == VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT && !fragment)
+                || (part == VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT && fragment)
+            ) {
+              shaderStages.emplace_back(createInfo.pStages[i]);
+            }
+          }
+
+          VkGraphicsPipelineLibraryCreateInfoEXT libraryCreateInfo = {
+              .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+              .pNext = nullptr,
+              .flags = part
+          };
+
+          // state outside of the part is ignored by the driver
+          createInfo.pNext = &libraryCreateInfo;
+          createInfo.flags |= VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+          if (graphicsPipelineLibraryLinkTimeOptimizationEnabled) {
+            createInfo.flags |= VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+          }
+          createInfo.stageCount = static_cast<uint32_t>(shaderStages.size());
+          createInfo.pStages = shaderStages.empty() ? nullptr : shaderStages.data();
+          createInfo.basePipelineHandle = VK_NULL_HANDLE;
+          createInfo.basePipelineIndex = -1;
+
+          if (
+              Dispatch::functions(*this).createGraphicsPipelines(device, VK_NULL_HANDLE, 1, &createInfo, nullptr, &library) != VK_SUCCESS
+              || library == nullptr
+          ) {
+            throw std::runtime_error(CALL_INFO() + ": failed to create graphics pipeline library!");
+          }
+
+          return library;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // static as the optimized link runs on a background thread with a copy of the entry point
+      template<typename CreateGraphicsPipelines>
+      static VkPipeline linkPipelineLibraries(
+          const CreateGraphicsPipelines& createGraphicsPipelines,
+          VkDevice device,
+          const std::vector<VkPipeline>& libraries,
+          VkPipelineLayout layout,
+          bool linkTimeOptimization
+      ) {
+        try {
+          VkPipeline pipeline = nullptr;
+
+          VkPipelineLibraryCreateInfoKHR libraryCreateInfo = {
+              .sType = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR,
+              .pNext = nullptr,
+              .libraryCount = static_cast<uint32_t>(libraries.size()),
+              .pLibraries = libraries.data()
+          };
+
+          VkGraphicsPipelineCreateInfo createInfo = {};
+          createInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+          createInfo.pNext = &libraryCreateInfo;
+          createInfo.flags = linkTimeOptimization ? VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT : 0;
+          createInfo.layout = layout;
+          createInfo.basePipelineHandle = VK_NULL_HANDLE;
+          createInfo.basePipelineIndex = -1;
+
+          if (
+              createGraphicsPipelines(device, VK_NULL_HANDLE, 1, &createInfo, nullptr, &pipeline) != VK_SUCCESS
+              || pipeline == nullptr
+          ) {
+            throw std::runtime_error(CALL_INFO() + ": failed to link graphics pipeline libraries!");
+          }
+
+          return pipeline;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // called with the cache mutex held, never waits for the background link
+      void updateLinkTimeOptimizedPipeline(const std::string& key) {
+        try {
+          auto optimization = pipelineOptimizations.find(key);
+          if (
+              optimization == pipelineOptimizations.end()
+              || optimization->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready
+          ) {
+            return;
+          }
+
+          std::future<Pipeline> future = std::move(optimization->second);
+          pipelineOptimizations.erase(optimization);
+          VkPipeline optimized = future.get().value;
+
+          // handles given out before the swap stay valid until the last reference is destroyed
+          pipelineRetired[key].emplace_back(pipelineCache[key].value);
+          pipelineCache[key].value = optimized;
+          pipelineCacheKeys[optimized] = key;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // the pipeline key is made of the library keys, a linked and a monolithic pipeline are interchangeable
+      std::string createPipelineKey(
+          VkDevice& device,
+          const std::vector<std::string>& shaderPaths,
+          const std::vector<std::span<const uint32_t>>& shaderCodes,
+          const std::map<VkShaderStageFlagBits, SpecializationInfo>& specializationInfos,
+          const std::vector<VkVertexInputBindingDescription>& vertexBindingDescriptions,
+          const std::vector<VkVertexInputAttributeDescription>& vertexAttributeDescriptions,
+          const PipelineLayoutCreateInfo& layoutCreateInfo,
+          const GraphicsPipelineCreateInfo& createInfo
+      ) {
+        try {
+          std::string key = {};
+
+          std::vector<std::string> libraryKeys = createPipelineLibraryKeys(
+              device,
+              shaderPaths,
+              shaderCodes,
+              specializationInfos,
+              vertexBindingDescriptions,
+              vertexAttributeDescriptions,
+              layoutCreateInfo,
+              createInfo
+          );
+          for (const std::string& libraryKey : libraryKeys) {
+            keyCombine(key, libraryKey);
+          }
+
+          keyCombine(key, createInfo.flags);
+          keyCombine(key, createInfo.basePipelineHandle);
+          keyCombine(key, createInfo.basePipelineIndex);
+
+          return key;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // shaders are keyed by their code and render passes by their compatibility, not by path or handle,
+      // the device and set layout handles stay as the cached pipeline layout is built from them
+      std::vector<std::string> createPipelineLibraryKeys(
+          VkDevice& device,
+          const std::vector<std::string>& shaderPaths,
+          const std::vector<std::span<const uint32_t>>& shaderCodes,
+          const std::map<VkShaderStageFlagBits, SpecializationInfo>& specializationInfos,
+          const std::vector<VkVertexInputBindingDescription>& vertexBindingDescriptions,
+          const std::vector<VkVertexInputAttributeDescription>& vertexAttributeDescriptions,
+          const PipelineLayoutCreateInfo& layoutCreateInfo,
+          const GraphicsPipelineCreateInfo& createInfo
+      ) {
+        try {
+          std::vector<std::string> keys = {{}, {}, {}, {}};
+
+          std::set<VkDynamicState> dynamicStates = {};
+          if (createInfo.dynamicState.has_value()) {
+            dynamicStates.insert(createInfo.dynamicState.value().dynamicStates.begin(), createInfo.dynamicState.value().dynamicStates.end());
+          }
+
+          for (std::size_t i = 0; i < keys.size(); i++) {
+            keyCombine(keys[i], i);
+            keyCombine(keys[i], device);
+            keyCombine(keys[i], graphicsPipelineLibraryLinkTimeOptimizationEnabled);
+            keyCombine(keys[i], createInfo.dynamicState.has_value());
+            if (createInfo.dynamicState.has_value()) {
+              keyCombine(keys[i], createInfo.dynamicState.value().flags);
+            }
+            keyCombine(keys[i], dynamicStates.size());
+            for (const VkDynamicState& dynamicState : dynamicStates) {
+              keyCombine(keys[i], dynamicState);
+            }
+          }
+
+          std::string& vertexInputKey = keys[0];
+          std::string& preRasterizationKey = keys[1];
+          std::string& fragmentShaderKey = keys[2];
+          std::string& fragmentOutputKey = keys[3];
+
+          for (std::size_t i = 0; i < shaderPaths.size(); i++) {
+            VkShaderStageFlagBits stage = getShaderStage(shaderPaths[i]);
+            std::string& key = stage == VK_SHADER_STAGE_FRAGMENT_BIT ? fragmentShaderKey : preRasterizationKey;
+            keyCombine(key, stage);
+            keyCombine(key, shaderCodes[i]);
+            auto specializationInfo = specializationInfos.find(stage);
+            keyCombine(key, specializationInfo != specializationInfos.end());
+            if (specializationInfo != specializationInfos.end()) {
+              keyCombine(key, specializationInfo->second.constants.size());
+              for (auto const& [constantId, constant] : specializationInfo->second.constants) {
+                keyCombine(key, constantId);
+                keyCombine(key, constant.index());
+                std::visit([this, &key](auto&& value) { keyCombine(key, value); }, constant);
+              }
+            }
+          }
+
+          keyCombine(vertexInputKey, vertexBindingDescriptions.size());
+          for (const VkVertexInputBindingDescription& description : vertexBindingDescriptions) {
+            keyCombine(vertexInputKey, description.binding);
+            keyCombine(vertexInputKey, description.stride);
+            keyCombine(vertexInputKey, description.inputRate);
+          }
+          keyCombine(vertexInputKey, vertexAttributeDescriptions.size());
+          for (const VkVertexInputAttributeDescription& description : vertexAttributeDescriptions) {
+            keyCombine(vertexInputKey, description.location);
+            keyCombine(vertexInputKey, description.binding);
+            keyCombine(vertexInputKey, description.format);
+            keyCombine(vertexInputKey, description.offset);
+          }
+
+          keyCombine(vertexInputKey, createInfo.inputAssemblyState.has_value());
+          if (createInfo.inputAssemblyState.has_value()) {
+            keyCombine(vertexInputKey, createInfo.inputAssemblyState.value().flags);
+            keyCombine(vertexInputKey, createInfo.inputAssemblyState.value().topology);
+            keyCombine(vertexInputKey, createInfo.inputAssemblyState.value().primitiveRestartEnable);
+          }
+
+          for (std::string* key : {&preRasterizationKey, &fragmentShaderKey}) {
+            keyCombine(*key, layoutCreateInfo.flags);
+            keyCombine(*key, layoutCreateInfo.setLayouts.size());
+            for (const VkDescriptorSetLayout& setLayout : layoutCreateInfo.setLayouts) {
+              keyCombine(*key, setLayout);
+            }
+            keyCombine(*key, layoutCreateInfo.pushConstantRanges.size());
+            for (const VkPushConstantRange& range : layoutCreateInfo.pushConstantRanges) {
+              keyCombine(*key, range.stageFlags);
+              keyCombine(*key, range.offset);
+              keyCombine(*key, range.size);
+            }
+          }
+
+          keyCombine(preRasterizationKey, createInfo.tessellationState.has_value());
+          if (createInfo.tessellationState.has_value()) {
+            keyCombine(preRasterizationKey, createInfo.tessellationState.value().flags);
+            keyCombine(preRasterizationKey, createInfo.tessellationState.value().patchControlPoints);
+          }
+
+          // dynamic viewports and scissors are not part of the pipeline, only their count is
+          keyCombine(preRasterizationKey, createInfo.viewportState.has_value());
+          if (createInfo.viewportState.has_value()) {
+            keyCombine(preRasterizationKey, createInfo.viewportState.value().flags);
+            keyCombine(preRasterizationKey, createInfo.viewportState.value().viewports.size());
+            if (!dynamicStates.contains(VK_DYNAMIC_STATE_VIEWPORT)) {
+              for (const VkViewport& viewport : createInfo.viewportState.value().viewports) {
+                keyCombine(preRasterizationKey, viewport.x);
+                keyCombine(preRasterizationKey, viewport.y);
+                keyCombine(preRasterizationKey, viewport.width);
+                keyCombine(preRasterizationKey, viewport.height);
+                keyCombine(preRasterizationKey, viewport.minDepth);
+                keyCombine(preRasterizationKey, viewport.maxDepth);
+              }
+            }
+            keyCombine(preRasterizationKey, createInfo.viewportState.value().scissors.size());
+            if (!dynamicStates.contains(VK_DYNAMIC_STATE_SCISSOR)) {
+              for (const VkRect2D& scissor : createInfo.viewportState.value().scissors) {
+                keyCombine(preRasterizationKey, scissor.offset.x);
+                keyCombine(preRasterizationKey, scissor.offset.y);
+                keyCombine(preRasterizationKey, scissor.extent.width);
+                keyCombine(preRasterizationKey, scissor.extent.height);
+              }
+            }
+          }
+
+          keyCombine(preRasterizationKey, createInfo.rasterizationState.has_value());
+          if (createInfo.rasterizationState.has_value()) {
+            keyCombine(preRasterizationKey, createInfo.rasterizationState.value().flags);
+            keyCombine(preRasterizationKey, createInfo.rasterizationState.value().depthClampEnable);
+            keyCombine(preRasterizationKey, createInfo.rasterizationState.value().rasterizerDiscardEnable);
+            keyCombine(preRasterizationKey, createInfo.rasterizationState.value().polygonMode);
+            keyCombine(preRasterizationKey, createInfo.rasterizationState.value().cullMode);
+            keyCombine(preRasterizationKey, createInfo.rasterizationState.value().frontFace);
+            keyCombine(preRasterizationKey, createInfo.rasterizationState.value().depthBiasEnable);
+            keyCombine(preRasterizationKey, createInfo.rasterizationState.value().depthBiasConstantFactor);
+            keyCombine(preRasterizationKey, createInfo.rasterizationState.value().depthBiasClamp);
+            keyCombine(preRasterizationKey, createInfo.rasterizationState.value().depthBiasSlopeFactor);
+            if (!dynamicStates.contains(VK_DYNAMIC_STATE_LINE_WIDTH)) {
+              keyCombine(preRasterizationKey, createInfo.rasterizationState.value().lineWidth);
+            }
+          }
+
+          for (std::string* key : {&fragmentShaderKey, &fragmentOutputKey}) {
+            keyCombine(*key, createInfo.multisampleState.has_value());
+            if (createInfo.multisampleState.has_value()) {
+              keyCombine(*key, createInfo.multisampleState.value().flags);
+              keyCombine(*key, createInfo.multisampleState.value().rasterizationSamples);
+              keyCombine(*key, createInfo.multisampleState.value().sampleShadingEnable);
+              keyCombine(*key, createInfo.multisampleState.value().minSampleShading);
+              keyCombine(*key, createInfo.multisampleState.value().pSampleMask != nullptr);
+              if (createInfo.multisampleState.value().pSampleMask != nullptr) {
+                keyCombine(*key, createInfo.multisampleState.value().pSampleMask[0]);
+              }
+              keyCombine(*key, createInfo.multisampleState.value().alphaToCoverageEnable);
+              keyCombine(*key, createInfo.multisampleState.value().alphaToOneEnable);
+            }
+          }
+
+          keyCombine(fragmentShaderKey, createInfo.depthStencilState.has_value());
+          if (createInfo.depthStencilState.has_value()) {
+            keyCombine(fragmentShaderKey, createInfo.depthStencilState.value().flags);
+            keyCombine(fragmentShaderKey, createInfo.depthStencilState.value().depthTestEnable);
+            keyCombine(fragmentShaderKey, createInfo.depthStencilState.value().depthWriteEnable);
+            keyCombine(fragmentShaderKey, createInfo.depthStencilState.value().depthCompareOp);
+            keyCombine(fragmentShaderKey, createInfo.depthStencilState.value().depthBoundsTestEnable);
+            keyCombine(fragmentShaderKey, createInfo.depthStencilState.value().stencilTestEnable);
+            for (const VkStencilOpState& state : {createInfo.depthStencilState.value().front, createInfo.depthStencilState.value().back}) {
+              keyCombine(fragmentShaderKey, state.failOp);
+              keyCombine(fragmentShaderKey, state.passOp);
+              keyCombine(fragmentShaderKey, state.depthFailOp);
+              keyCombine(fragmentShaderKey, state.compareOp);
+              keyCombine(fragmentShaderKey, state.compareMask);
+              keyCombine(fragmentShaderKey, state.writeMask);
+              keyCombine(fragmentShaderKey, state.reference);
+            }
+            keyCombine(fragmentShaderKey, createInfo.depthStencilState.value().minDepthBounds);
+            keyCombine(fragmentShaderKey, createInfo.depthStencilState.value().maxDepthBounds);
+          }
+
+          keyCombine(fragmentOutputKey, createInfo.colorBlendState.has_value());
+          if (createInfo.colorBlendState.has_value()) {
+            keyCombine(fragmentOutputKey, createInfo.colorBlendState.value().flags);
+            keyCombine(fragmentOutputKey, createInfo.colorBlendState.value().logicOpEnable);
+            keyCombine(fragmentOutputKey, createInfo.colorBlendState.value().logicOp);
+            keyCombine(fragmentOutputKey, createInfo.colorBlendState.value().attachments.size());
+            for (const VkPipelineColorBlendAttachmentState& attachment : createInfo.colorBlendState.value().attachments) {
+              keyCombine(fragmentOutputKey, attachment.blendEnable);
+              keyCombine(fragmentOutputKey, attachment.srcColorBlendFactor);
+              keyCombine(fragmentOutputKey, attachment.dstColorBlendFactor);
+              keyCombine(fragmentOutputKey, attachment.colorBlendOp);
+              keyCombine(fragmentOutputKey, attachment.srcAlphaBlendFactor);
+              keyCombine(fragmentOutputKey, attachment.dstAlphaBlendFactor);
+              keyCombine(fragmentOutputKey, attachment.alphaBlendOp);
+              keyCombine(fragmentOutputKey, attachment.colorWriteMask);
+            }
+            if (!dynamicStates.contains(VK_DYNAMIC_STATE_BLEND_CONSTANTS)) {
+              for (const float& blendConstant : createInfo.colorBlendState.value().blendConstants) {
+                keyCombine(fragmentOutputKey, blendConstant);
+              }
+            }
+          }
+
+          std::string renderPassKey = getRenderPassKey(createInfo.renderPass);
+          for (std::string* key : {&preRasterizationKey, &fragmentShaderKey, &fragmentOutputKey}) {
+            keyCombine(*key, renderPassKey);
+            keyCombine(*key, createInfo.subpass);
+          }
+
+          return keys;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
   };
 
+  using PipelineFactoryBase = BasicPipelineFactoryBase<FunctionsDispatch>;
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/Queue.hpp"
 
 namespace exqudens::vulkan {
@@ -11,7 +13,8 @@ namespace exqudens::vulkan {
       virtual Queue createQueue(
           VkDevice& device,
           uint32_t queueFamilyIndex,
-          uint32_t queueIndex
+          uint32_t queueIndex,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual void destroyQueue(Queue& queue) = 0;
@@ -1,22 +1,31 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/QueueFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class QueueFactoryBase:
+  template<typename Dispatch>
+  class BasicQueueFactoryBase:
       virtual public QueueFactory,
       virtual public UtilityBase
   {
 
     public:
 
-      Queue createQueue(VkDevice& device, uint32_t queueFamilyIndex, uint32_t queueIndex) override {
+      Queue createQueue(
+          VkDevice& device,
+          uint32_t queueFamilyIndex,
+          uint32_t queueIndex,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           VkQueue queue = nullptr;
 
-          functions().getDeviceQueue(device, queueFamilyIndex, queueIndex, &queue);
+          Dispatch::functions(*this).getDeviceQueue(device, queueFamilyIndex, queueIndex, &queue);
 
           if (queue == nullptr) {
             throw std::runtime_error(CALL_INFO() + ": failed to create compute queue!");
@@ -44,4 +53,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using QueueFactoryBase = BasicQueueFactoryBase<FunctionsDispatch>;
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/RenderPassCreateInfo.hpp"
 #include "exqudens/vulkan/model/RenderPass.hpp"
 
@@ -9,8 +11,16 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual RenderPass createRenderPass(VkDevice& device, VkFormat& format) = 0;
-      virtual RenderPass createRenderPass(VkDevice& device, const RenderPassCreateInfo& createInfo) = 0;
+      virtual RenderPass createRenderPass(
+          VkDevice& device,
+          VkFormat& format,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual RenderPass createRenderPass(
+          VkDevice& device,
+          const RenderPassCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) = 0;
 
       virtual void destroyRenderPass(RenderPass& renderPass) = 0;
 
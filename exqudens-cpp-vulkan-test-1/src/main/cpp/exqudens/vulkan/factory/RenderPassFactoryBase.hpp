@@ -1,18 +1,34 @@
 #pragma once
 
+#include <map>
+#include <mutex>
+#include <source_location>
+#include <string>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/RenderPassFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class RenderPassFactoryBase:
+  template<typename Dispatch>
+  class BasicRenderPassFactoryBase:
       virtual public RenderPassFactory,
       virtual public UtilityBase
   {
 
+    protected:
+
+      std::mutex renderPassKeyMutex;
+      std::map<VkRenderPass, std::string> renderPassKeys = {};
+
     public:
 
-      RenderPass createRenderPass(VkDevice& device, VkFormat& format) override {
+      RenderPass createRenderPass(
+          VkDevice& device,
+          VkFormat& format,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           return createRenderPass(
               device,
@@ -50,14 +66,19 @@ namespace exqudens::vulkan {
                           .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
                       }
                   }
-              }
+              },
+              location
           );
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
-      RenderPass createRenderPass(VkDevice& device, const RenderPassCreateInfo& createInfo) override {
+      RenderPass createRenderPass(
+          VkDevice& device,
+          const RenderPassCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           VkRenderPass renderPass = nullptr;
 
@@ -93,12 +114,17 @@ namespace exqudens::vulkan {
           };
 
           if (
-              functions().createRenderPass(device, &info, nullptr, &renderPass) != VK_SUCCESS
+              Dispatch::functions(*this).createRenderPass(device, &info, nullptr, &renderPass) != VK_SUCCESS
               || renderPass == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create render pass!");
           }
 
+          {
+            std::lock_guard<std::mutex> lock(renderPassKeyMutex);
+            renderPassKeys[renderPass] = createRenderPassKey(createInfo);
+          }
+
           return {
               .device = device,
               .value = renderPass
@@ -111,7 +137,11 @@ namespace exqudens::vulkan {
       void destroyRenderPass(RenderPass& renderPass) override {
         try {
           if (renderPass.value != nullptr) {
-            functions().destroyRenderPass(renderPass.device, renderPass.value, nullptr);
+            {
+              std::lock_guard<std::mutex> lock(renderPassKeyMutex);
+              renderPassKeys.erase(renderPass.value);
+            }
+            Dispatch::functions(*this).destroyRenderPass(renderPass.device, renderPass.value, nullptr);
             renderPass.device = nullptr;
             renderPass.value = nullptr;
           }
@@ -120,6 +150,73 @@ namespace exqudens::vulkan {
         }
       }
 
+    protected:
+
+      std::string getRenderPassKey(const VkRenderPass& renderPass) override {
+        try {
+          {
+            std::lock_guard<std::mutex> lock(renderPassKeyMutex);
+            auto key = renderPassKeys.find(renderPass);
+            if (key != renderPassKeys.end()) {
+              return key->second;
+            }
+          }
+          return UtilityBase::getRenderPassKey(renderPass);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      // what makes two render passes compatible: attachment formats and sample counts and the subpass layout,
+      // load and store ops and image layouts are left out
+      std::string createRenderPassKey(const RenderPassCreateInfo& createInfo) {
+        try {
+          std::string key = {};
+
+          keyCombine(key, createInfo.flags);
+          keyCombine(key, createInfo.attachments.size());
+          for (const VkAttachmentDescription& attachment : createInfo.attachments) {
+            keyCombine(key, attachment.flags);
+            keyCombine(key, attachment.format);
+            keyCombine(key, attachment.samples);
+          }
+
+          keyCombine(key, createInfo.subPasses.size());
+          for (const SubPassDescription& subPass : createInfo.subPasses) {
+            keyCombine(key, subPass.flags);
+            keyCombine(key, subPass.pipelineBindPoint);
+            for (const std::vector<VkAttachmentReference>* references : {&subPass.inputAttachments, &subPass.colorAttachments, &subPass.resolveAttachments}) {
+              keyCombine(key, references->size());
+              for (const VkAttachmentReference& reference : *references) {
+                keyCombine(key, reference.attachment);
+              }
+            }
+            keyCombine(key, subPass.depthStencilAttachment.has_value());
+            if (subPass.depthStencilAttachment.has_value()) {
+              keyCombine(key, subPass.depthStencilAttachment.value().attachment);
+            }
+            keyCombine(key, std::span<const uint32_t>(subPass.preserveAttachments));
+          }
+
+          keyCombine(key, createInfo.dependencies.size());
+          for (const VkSubpassDependency& dependency : createInfo.dependencies) {
+            keyCombine(key, dependency.srcSubpass);
+            keyCombine(key, dependency.dstSubpass);
+            keyCombine(key, dependency.srcStageMask);
+            keyCombine(key, dependency.dstStageMask);
+            keyCombine(key, dependency.srcAccessMask);
+            keyCombine(key, dependency.dstAccessMask);
+            keyCombine(key, dependency.dependencyFlags);
+          }
+
+          return key;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
   };
 
+  using RenderPassFactoryBase = BasicRenderPassFactoryBase<FunctionsDispatch>;
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/Sampler.hpp"
 
 namespace exqudens::vulkan {
@@ -8,9 +10,24 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual Sampler createSampler(VkPhysicalDevice& physicalDevice, VkDevice& device) = 0;
-
-      virtual Sampler createSampler(VkPhysicalDevice& physicalDevice, VkDevice& device, bool anisotropyEnable) = 0;
+      virtual Sampler createSampler(
+          VkPhysicalDevice& physicalDevice,
+          VkDevice& device,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+
+      virtual Sampler createSampler(
+          VkPhysicalDevice& physicalDevice,
+          VkDevice& device,
+          bool anisotropyEnable,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+
+      virtual Sampler createSampler(
+          VkDevice& device,
+          const VkSamplerCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) = 0;
 
       virtual void destroySampler(Sampler& sampler) = 0;
 
@@ -1,29 +1,51 @@
 #pragma once
 
+#include <map>
+#include <mutex>
+#include <source_location>
+#include <string>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/SamplerFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class SamplerFactoryBase:
+  template<typename Dispatch>
+  class BasicSamplerFactoryBase:
       virtual public SamplerFactory,
       virtual public UtilityBase
   {
 
+    protected:
+
+      // held for the cache lookups and inserts only, the driver calls run outside of it
+      std::mutex samplerCacheMutex;
+      std::map<std::string, Sampler> samplerCache = {};
+      std::map<std::string, std::size_t> samplerCacheReferences = {};
+      std::map<VkSampler, std::string> samplerCacheKeys = {};
+
     public:
 
-      Sampler createSampler(VkPhysicalDevice& physicalDevice, VkDevice& device) override {
+      Sampler createSampler(
+          VkPhysicalDevice& physicalDevice,
+          VkDevice& device,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
-          return createSampler(physicalDevice, device, false);
+          return createSampler(physicalDevice, device, false, location);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
-      Sampler createSampler(VkPhysicalDevice& physicalDevice, VkDevice& device, bool anisotropyEnable) override {
+      Sampler createSampler(
+          VkPhysicalDevice& physicalDevice,
+          VkDevice& device,
+          bool anisotropyEnable,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
-          VkSampler sampler = nullptr;
-
           VkSamplerCreateInfo samplerInfo = {};
           samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
           samplerInfo.magFilter = VK_FILTER_LINEAR;
@@ -34,7 +56,7 @@ namespace exqudens::vulkan {
 
           if (anisotropyEnable) {
             VkPhysicalDeviceProperties properties = {};
-            functions().getPhysicalDeviceProperties(physicalDevice, &properties);
+            Dispatch::functions(*this).getPhysicalDeviceProperties(physicalDevice, &properties);
 
             samplerInfo.anisotropyEnable = VK_TRUE;
             samplerInfo.maxAnisotropy = properties.limits.maxSamplerAnisotropy;
@@ -46,17 +68,62 @@ namespace exqudens::vulkan {
           samplerInfo.compareOp = VK_COMPARE_OP_ALWAYS;
           samplerInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
 
+          return createSampler(device, samplerInfo, location);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      Sampler createSampler(
+          VkDevice& device,
+          const VkSamplerCreateInfo& createInfo,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          // extension chains are not part of the key, such samplers are never shared
+          bool cacheable = createInfo.pNext == nullptr;
+          std::string key = cacheable ? createSamplerKey(device, createInfo) : std::string();
+
+          if (cacheable) {
+            std::lock_guard<std::mutex> lock(samplerCacheMutex);
+            auto cached = samplerCache.find(key);
+            if (cached != samplerCache.end()) {
+              samplerCacheReferences[key]++;
+              return cached->second;
+            }
+          }
+
+          VkSampler sampler = nullptr;
+
           if (
-              functions().createSampler(device, &samplerInfo, nullptr, &sampler) != VK_SUCCESS
+              Dispatch::functions(*this).createSampler(device, &createInfo, nullptr, &sampler) != VK_SUCCESS
               || sampler == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create sampler!");
           }
 
-          return {
+          Sampler value = {
               .device = device,
               .value = sampler
           };
+
+          if (cacheable) {
+            std::unique_lock<std::mutex> lock(samplerCacheMutex);
+            auto cached = samplerCache.find(key);
+            if (cached != samplerCache.end()) {
+              // another thread created the same sampler meanwhile, the cached one is handed out
+              samplerCacheReferences[key]++;
+              value = cached->second;
+              lock.unlock();
+              Dispatch::functions(*this).destroySampler(device, sampler, nullptr);
+              return value;
+            }
+            samplerCache[key] = value;
+            samplerCacheReferences[key] = 1;
+            samplerCacheKeys[sampler] = key;
+          }
+
+          return value;
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -65,7 +132,22 @@ namespace exqudens::vulkan {
       void destroySampler(Sampler& sampler) override {
         try {
           if (sampler.value != nullptr) {
-            functions().destroySampler(sampler.device, sampler.value, nullptr);
+            std::lock_guard<std::mutex> lock(samplerCacheMutex);
+            auto cacheKey = samplerCacheKeys.find(sampler.value);
+            if (cacheKey != samplerCacheKeys.end()) {
+              std::string key = cacheKey->second;
+              if (--samplerCacheReferences[key] > 0) {
+                sampler.device = nullptr;
+                sampler.value = nullptr;
+                return;
+              }
+              samplerCache.erase(key);
+              samplerCacheReferences.erase(key);
+              samplerCacheKeys.erase(cacheKey);
+            }
+          }
+          if (sampler.value != nullptr) {
+            Dispatch::functions(*this).destroySampler(sampler.device, sampler.value, nullptr);
             sampler.device = nullptr;
             sampler.value = nullptr;
           }
@@ -74,6 +156,36 @@ namespace exqudens::vulkan {
         }
       }
 
+    protected:
+
+      std::string createSamplerKey(VkDevice& device, const VkSamplerCreateInfo& createInfo) {
+        try {
+          std::string key;
+          keyCombine(key, device);
+          keyCombine(key, createInfo.flags);
+          keyCombine(key, createInfo.magFilter);
+          keyCombine(key, createInfo.minFilter);
+          keyCombine(key, createInfo.mipmapMode);
+          keyCombine(key, createInfo.addressModeU);
+          keyCombine(key, createInfo.addressModeV);
+          keyCombine(key, createInfo.addressModeW);
+          keyCombine(key, createInfo.mipLodBias);
+          keyCombine(key, createInfo.anisotropyEnable);
+          keyCombine(key, createInfo.maxAnisotropy);
+          keyCombine(key, createInfo.compareEnable);
+          keyCombine(key, createInfo.compareOp);
+          keyCombine(key, createInfo.minLod);
+          keyCombine(key, createInfo.maxLod);
+          keyCombine(key, createInfo.borderColor);
+          keyCombine(key, createInfo.unnormalizedCoordinates);
+          return key;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
   };
 
+  using SamplerFactoryBase = BasicSamplerFactoryBase<FunctionsDispatch>;
+
 }
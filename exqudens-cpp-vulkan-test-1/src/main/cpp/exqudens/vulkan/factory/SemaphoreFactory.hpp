@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/Semaphore.hpp"
 
 namespace exqudens::vulkan {
@@ -8,13 +10,25 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual Semaphore createSemaphore(VkDevice& device) = 0;
-      virtual Semaphore createSemaphore(VkDevice& device, VkSemaphoreCreateFlags flags) = 0;
-      virtual std::vector<Semaphore> createSemaphores(VkDevice& device, std::size_t size) = 0;
+      virtual Semaphore createSemaphore(
+          VkDevice& device,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual Semaphore createSemaphore(
+          VkDevice& device,
+          VkSemaphoreCreateFlags flags,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual std::vector<Semaphore> createSemaphores(
+          VkDevice& device,
+          std::size_t size,
+          std::source_location location = std::source_location::current()
+      ) = 0;
       virtual std::vector<Semaphore> createSemaphores(
           VkDevice& device,
           VkSemaphoreCreateFlags flags,
-          std::size_t size
+          std::size_t size,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
       virtual void destroySemaphore(Semaphore& semaphore) = 0;
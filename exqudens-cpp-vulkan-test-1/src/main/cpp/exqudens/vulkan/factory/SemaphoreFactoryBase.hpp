@@ -1,26 +1,37 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/SemaphoreFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class SemaphoreFactoryBase:
+  template<typename Dispatch>
+  class BasicSemaphoreFactoryBase:
       virtual public SemaphoreFactory,
       virtual public UtilityBase
   {
 
     public:
 
-      Semaphore createSemaphore(VkDevice& device) override {
+      Semaphore createSemaphore(
+          VkDevice& device,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
-          return createSemaphore(device, 0);
+          return createSemaphore(device, 0, location);
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
       }
 
-      Semaphore createSemaphore(VkDevice& device, VkSemaphoreCreateFlags flags) override {
+      Semaphore createSemaphore(
+          VkDevice& device,
+          VkSemaphoreCreateFlags flags,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           VkSemaphore semaphore = nullptr;
 
@@ -29,7 +40,7 @@ namespace exqudens::vulkan {
           semaphoreInfo.flags = flags;
 
           if (
-              functions().createSemaphore(device, &semaphoreInfo, nullptr, &semaphore) != VK_SUCCESS
+              Dispatch::functions(*this).createSemaphore(device, &semaphoreInfo, nullptr, &semaphore) != VK_SUCCESS
               || semaphore == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create semaphore!");
@@ -44,13 +55,17 @@ namespace exqudens::vulkan {
         }
       }
 
-      std::vector<Semaphore> createSemaphores(VkDevice& device, std::size_t size) override {
+      std::vector<Semaphore> createSemaphores(
+          VkDevice& device,
+          std::size_t size,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
           std::vector<Semaphore> semaphores;
           semaphores.resize(size);
 
           for (std::size_t i = 0; i < size; i++) {
-            semaphores[i] = createSemaphore(device);
+            semaphores[i] = createSemaphore(device, location);
           }
 
           return semaphores;
@@ -62,14 +77,15 @@ namespace exqudens::vulkan {
       std::vector<Semaphore> createSemaphores(
           VkDevice& device,
           VkSemaphoreCreateFlags flags,
-          std::size_t size
+          std::size_t size,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           std::vector<Semaphore> semaphores;
           semaphores.resize(size);
 
           for (std::size_t i = 0; i < size; i++) {
-            semaphores[i] = createSemaphore(device, flags);
+            semaphores[i] = createSemaphore(device, flags, location);
           }
 
           return semaphores;
@@ -81,7 +97,7 @@ namespace exqudens::vulkan {
       void destroySemaphore(Semaphore& semaphore) override {
         try {
           if (semaphore.value != nullptr) {
-            functions().destroySemaphore(semaphore.device, semaphore.value, nullptr);
+            Dispatch::functions(*this).destroySemaphore(semaphore.device, semaphore.value, nullptr);
             semaphore.device = nullptr;
             semaphore.value = nullptr;
           }
@@ -103,4 +119,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using SemaphoreFactoryBase = BasicSemaphoreFactoryBase<FunctionsDispatch>;
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <source_location>
+
 #include <vulkan/vulkan.h>
 
 #include "exqudens/vulkan/model/Surface.hpp"
@@ -10,7 +12,10 @@ namespace exqudens::vulkan {
 
     public:
 
-      virtual Surface createSurface(VkInstance& instance) = 0;
+      virtual Surface createSurface(
+          VkInstance& instance,
+          std::source_location location = std::source_location::current()
+      ) = 0;
 
       virtual void destroySurface(Surface& surface) = 0;
 
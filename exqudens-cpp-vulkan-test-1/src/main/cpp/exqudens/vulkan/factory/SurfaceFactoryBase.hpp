@@ -1,20 +1,50 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/SurfaceFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class SurfaceFactoryBase:
+  template<typename Dispatch>
+  class BasicSurfaceFactoryBase:
       virtual public SurfaceFactory,
       virtual public UtilityBase
   {
 
     public:
 
-      Surface createSurface(VkInstance& instance) override {
+      // window surfaces come from the windowing library and are handed over with Context::add
+      Surface createSurface(
+          VkInstance& instance,
+          std::source_location location = std::source_location::current()
+      ) override {
         try {
-          throw std::runtime_error("Not implemented!!!");
+#ifdef VK_EXT_headless_surface
+          auto func = (PFN_vkCreateHeadlessSurfaceEXT) Dispatch::functions(*this).getInstanceProcAddr(instance, "vkCreateHeadlessSurfaceEXT");
+
+          if (func == nullptr) {
+            throw std::runtime_error(CALL_INFO() + ": '" + std::string(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME) + "' requested, but not available!");
+          }
+
+          VkHeadlessSurfaceCreateInfoEXT createInfo = {};
+          createInfo.sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT;
+
+          VkSurfaceKHR surface = nullptr;
+
+          if (func(instance, &createInfo, nullptr, &surface) != VK_SUCCESS || surface == nullptr) {
+            throw std::runtime_error(CALL_INFO() + ": failed to create headless surface!");
+          }
+
+          return {
+              .instance = instance,
+              .value = surface
+          };
+#else
+          throw std::runtime_error(CALL_INFO() + ": 'VK_EXT_headless_surface' requested, but not available in vulkan headers!");
+#endif
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
         }
@@ -23,7 +53,7 @@ namespace exqudens::vulkan {
       void destroySurface(Surface& surface) override {
         try {
           if (surface.value != nullptr) {
-            functions().destroySurfaceKHR(surface.instance, surface.value, nullptr);
+            Dispatch::functions(*this).destroySurfaceKHR(surface.instance, surface.value, nullptr);
             surface.instance = nullptr;
             surface.value = nullptr;
           }
@@ -34,4 +64,6 @@ namespace exqudens::vulkan {
 
   };
 
+  using SurfaceFactoryBase = BasicSurfaceFactoryBase<FunctionsDispatch>;
+
 }
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <source_location>
+
 #include "exqudens/vulkan/model/SwapChain.hpp"
+#include "exqudens/vulkan/model/PresentPolicy.hpp"
 
 namespace exqudens::vulkan {
 
@@ -14,9 +17,34 @@ namespace exqudens::vulkan {
           VkSurfaceKHR& surface,
           VkDevice& device,
           const uint32_t& width,
-          const uint32_t& height
+          const uint32_t& height,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+      virtual SwapChain createSwapChain(
+          SwapChainSupportDetails& swapChainSupport,
+          QueueFamilyIndexInfo& queueFamilyIndexInfo,
+          VkSurfaceKHR& surface,
+          VkDevice& device,
+          const uint32_t& width,
+          const uint32_t& height,
+          VkSwapchainKHR& oldSwapChain,
+          std::source_location location = std::source_location::current()
       ) = 0;
 
+      virtual SwapChain recreateSwapChain(
+          SwapChain& oldSwapChain,
+          SwapChainSupportDetails& swapChainSupport,
+          QueueFamilyIndexInfo& queueFamilyIndexInfo,
+          VkSurfaceKHR& surface,
+          const uint32_t& width,
+          const uint32_t& height,
+          std::source_location location = std::source_location::current()
+      ) = 0;
+
+      virtual std::vector<VkSwapchainKHR> releaseRetiredSwapChains() = 0;
+
+      virtual void setPresentPolicy(const PresentPolicy& presentPolicy) = 0;
+
       virtual std::vector<Image> createSwapChainImages(
           VkDevice& device,
           VkSwapchainKHR& swapChain
@@ -24,6 +52,8 @@ namespace exqudens::vulkan {
 
       virtual void destroySwapChain(SwapChain& swapChain) = 0;
 
+      virtual void destroyRetiredSwapChains() = 0;
+
   };
 
 }
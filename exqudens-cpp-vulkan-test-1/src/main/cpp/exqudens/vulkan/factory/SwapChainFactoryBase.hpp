@@ -1,15 +1,32 @@
 #pragma once
 
+#include <map>
+#include <source_location>
+
 #include "exqudens/vulkan/UtilityBase.hpp"
+#include "exqudens/vulkan/FunctionsDispatch.hpp"
 #include "exqudens/vulkan/factory/SwapChainFactory.hpp"
 
 namespace exqudens::vulkan {
 
-  class SwapChainFactoryBase:
+  template<typename Dispatch>
+  class BasicSwapChainFactoryBase:
       virtual public SwapChainFactory,
       virtual public UtilityBase
   {
 
+    protected:
+
+      PresentPolicy presentPolicy = {
+          .mode = PresentPolicyMode::DEFAULT,
+          .minImageCount = 0,
+          .pacingInterval = std::chrono::nanoseconds::zero()
+      };
+
+      // old chains stay alive until enough images of their successor were acquired
+      std::map<VkSwapchainKHR, SwapChain> retiredSwapChains = {};
+      std::map<VkSwapchainKHR, uint32_t> retiredSwapChainAcquires = {};
+
     public:
 
       SwapChain createSwapChain(
@@ -18,7 +35,26 @@ namespace exqudens::vulkan {
           VkSurfaceKHR& surface,
           VkDevice& device,
           const uint32_t& width,
-          const uint32_t& height
+          const uint32_t& height,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          VkSwapchainKHR oldSwapChain = nullptr;
+          return createSwapChain(swapChainSupport, queueFamilyIndexInfo, surface, device, width, height, oldSwapChain, location);
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      SwapChain createSwapChain(
+          SwapChainSupportDetails& swapChainSupport,
+          QueueFamilyIndexInfo& queueFamilyIndexInfo,
+          VkSurfaceKHR& surface,
+          VkDevice& device,
+          const uint32_t& width,
+          const uint32_t& height,
+          VkSwapchainKHR& oldSwapChain,
+          std::source_location location = std::source_location::current()
       ) override {
         try {
           if (surface == nullptr) {
@@ -28,14 +64,10 @@ namespace exqudens::vulkan {
           VkSwapchainKHR swapChain = nullptr;
 
           VkSurfaceFormatKHR surfaceFormat = chooseSwapSurfaceFormat(swapChainSupport.formats);
-          VkPresentModeKHR presentMode = chooseSwapPresentMode(swapChainSupport.presentModes);
+          VkPresentModeKHR presentMode = chooseSwapPresentMode(swapChainSupport.presentModes, presentPolicy);
           VkExtent2D extent = chooseSwapExtent(swapChainSupport.capabilities, width, height);
 
-          uint32_t imageCount = swapChainSupport.capabilities.minImageCount + 1;
-
-          if (swapChainSupport.capabilities.maxImageCount > 0 && imageCount > swapChainSupport.capabilities.maxImageCount) {
-            imageCount = swapChainSupport.capabilities.maxImageCount;
-          }
+          uint32_t imageCount = chooseSwapImageCount(swapChainSupport.capabilities, presentPolicy, presentMode);
 
           VkSwapchainCreateInfoKHR createInfo{};
           createInfo.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
@@ -66,10 +98,10 @@ namespace exqudens::vulkan {
           createInfo.presentMode = presentMode;
           createInfo.clipped = VK_TRUE;
 
-          createInfo.oldSwapchain = nullptr;
+          createInfo.oldSwapchain = oldSwapChain;
 
           if (
-              functions().createSwapchainKHR(device, &createInfo, nullptr, &swapChain) != VK_SUCCESS
+              Dispatch::functions(*this).createSwapchainKHR(device, &createInfo, nullptr, &swapChain) != VK_SUCCESS
               || swapChain == nullptr
           ) {
             throw std::runtime_error(CALL_INFO() + ": failed to create swap chain!");
@@ -80,6 +112,7 @@ namespace exqudens::vulkan {
               .format = surfaceFormat.format,
               .extent = extent,
               .imageCount = imageCount,
+              .presentMode = presentMode,
               .width = width,
               .height = height,
               .value = swapChain
@@ -89,18 +122,93 @@ namespace exqudens::vulkan {
         }
       }
 
+      SwapChain recreateSwapChain(
+          SwapChain& oldSwapChain,
+          SwapChainSupportDetails& swapChainSupport,
+          QueueFamilyIndexInfo& queueFamilyIndexInfo,
+          VkSurfaceKHR& surface,
+          const uint32_t& width,
+          const uint32_t& height,
+          std::source_location location = std::source_location::current()
+      ) override {
+        try {
+          if (oldSwapChain.value == nullptr) {
+            throw std::invalid_argument(CALL_INFO() + ": old swap chain is null!");
+          }
+
+          SwapChain swapChain = createSwapChain(
+              swapChainSupport,
+              queueFamilyIndexInfo,
+              surface,
+              oldSwapChain.device,
+              width,
+              height,
+              oldSwapChain.value,
+              location
+          );
+
+          uint32_t imageCount = 0;
+          if (Dispatch::functions(*this).getSwapchainImagesKHR(swapChain.device, swapChain.value, &imageCount, nullptr) != VK_SUCCESS) {
+            throw std::runtime_error(CALL_INFO() + ": failed to get swap chain image count!");
+          }
+
+          // presents are in order, once more images than the new chain owns were acquired
+          // the engine has released a newer image and the old presents are done
+          retiredSwapChains[oldSwapChain.value] = oldSwapChain;
+          retiredSwapChainAcquires[oldSwapChain.value] = imageCount + 1;
+
+          oldSwapChain.device = nullptr;
+          oldSwapChain.value = nullptr;
+          oldSwapChain.extent = {};
+
+          return swapChain;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      std::vector<VkSwapchainKHR> releaseRetiredSwapChains() override {
+        try {
+          std::vector<VkSwapchainKHR> released;
+          for (auto& [key, value] : retiredSwapChainAcquires) {
+            if (value > 0) {
+              value--;
+            }
+            if (value == 0) {
+              released.emplace_back(key);
+            }
+          }
+          for (VkSwapchainKHR& key : released) {
+            Dispatch::functions(*this).destroySwapchainKHR(retiredSwapChains[key].device, key, nullptr);
+            retiredSwapChains.erase(key);
+            retiredSwapChainAcquires.erase(key);
+          }
+          return released;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void setPresentPolicy(const PresentPolicy& presentPolicy) override {
+        try {
+          this->presentPolicy = presentPolicy;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
       std::vector<Image> createSwapChainImages(VkDevice& device, VkSwapchainKHR& swapChain) override {
         try {
           uint32_t imageCount = 0;
           std::vector<VkImage> vkImages;
 
-          if (functions().getSwapchainImagesKHR(device, swapChain, &imageCount, nullptr) != VK_SUCCESS) {
+          if (Dispatch::functions(*this).getSwapchainImagesKHR(device, swapChain, &imageCount, nullptr) != VK_SUCCESS) {
             throw std::runtime_error("failed to get swap chain image count!");
           }
 
           vkImages.resize(imageCount);
 
-          if (functions().getSwapchainImagesKHR(device, swapChain, &imageCount, vkImages.data()) != VK_SUCCESS) {
+          if (Dispatch::functions(*this).getSwapchainImagesKHR(device, swapChain, &imageCount, vkImages.data()) != VK_SUCCESS) {
             throw std::runtime_error("failed to get swap chain images!");
           }
 
@@ -122,7 +230,7 @@ namespace exqudens::vulkan {
       void destroySwapChain(SwapChain& swapChain) override {
         try {
           if (swapChain.value != nullptr) {
-            functions().destroySwapchainKHR(swapChain.device, swapChain.value, nullptr);
+            Dispatch::functions(*this).destroySwapchainKHR(swapChain.device, swapChain.value, nullptr);
             swapChain.device = nullptr;
             swapChain.value = nullptr;
           }
@@ -132,6 +240,20 @@ namespace exqudens::vulkan {
         }
       }
 
+      void destroyRetiredSwapChains() override {
+        try {
+          for (auto& [key, value] : retiredSwapChains) {
+            Dispatch::functions(*this).destroySwapchainKHR(value.device, key, nullptr);
+          }
+          retiredSwapChains.clear();
+          retiredSwapChainAcquires.clear();
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
   };
 
+  using SwapChainFactoryBase = BasicSwapChainFactoryBase<FunctionsDispatch>;
+
 }
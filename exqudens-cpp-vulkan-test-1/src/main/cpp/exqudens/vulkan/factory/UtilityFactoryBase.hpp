@@ -94,7 +94,12 @@ namespace exqudens::vulkan {
               .transferQueueFamilyRequired = true,
               .graphicsQueueFamilyRequired = true,
               .presentQueueFamilyRequired = true,
-              .anisotropyRequired = true
+              .anisotropyRequired = true,
+              .presentPolicy = {
+                  .mode = PresentPolicyMode::DEFAULT,
+                  .minImageCount = 0,
+                  .pacingInterval = std::chrono::nanoseconds::zero()
+              }
           };
         } catch (...) {
           std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace exqudens::vulkan {
+
+  struct BindlessTable {
+
+    uint64_t id;
+    bool destroyed;
+    VkDevice device;
+    uint32_t capacity;
+    uint32_t nextSlot;
+    std::vector<uint32_t> freeSlots;
+    VkDescriptorSetLayout layout;
+    VkDescriptorPool pool;
+    VkDescriptorSet value;
+
+  };
+
+}
@@ -6,11 +6,12 @@ namespace exqudens::vulkan {
 
   struct Buffer {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     VkDevice device;
     VkDeviceMemory memory;
     VkDeviceSize memorySize;
+    VkDeviceSize allocationSize; // memory bound to the buffer, the requirement can round it up past memorySize
     VkMemoryPropertyFlags memoryProperties; // VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
     VkBuffer value;
 
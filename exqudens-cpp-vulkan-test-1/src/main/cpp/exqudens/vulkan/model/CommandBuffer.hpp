@@ -6,7 +6,7 @@ namespace exqudens::vulkan {
 
   struct CommandBuffer {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     VkDevice device;
     VkCommandPool commandPool;
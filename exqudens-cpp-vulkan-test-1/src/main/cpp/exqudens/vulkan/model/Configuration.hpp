@@ -3,6 +3,8 @@
 #include <string>
 #include <vector>
 
+#include "exqudens/vulkan/model/PresentPolicy.hpp"
+
 namespace exqudens::vulkan {
 
   struct Configuration {
@@ -24,6 +26,7 @@ namespace exqudens::vulkan {
     bool graphicsQueueFamilyRequired;
     bool presentQueueFamilyRequired;
     bool anisotropyRequired;
+    PresentPolicy presentPolicy;
 
   };
 
@@ -6,7 +6,7 @@ namespace exqudens::vulkan {
 
   struct DebugUtilsMessenger {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     VkInstance instance;
     VkDebugUtilsMessengerEXT value;
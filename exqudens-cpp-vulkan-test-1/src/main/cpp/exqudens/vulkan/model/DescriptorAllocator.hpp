@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "exqudens/vulkan/model/DescriptorPoolCreateInfo.hpp"
+
+namespace exqudens::vulkan {
+
+  struct DescriptorAllocator {
+
+    uint64_t id;
+    bool destroyed;
+    VkDevice device;
+    DescriptorPoolCreateInfo createInfo;
+    uint32_t setsPerPool;
+    uint32_t allocatedSets;
+    uint32_t peakSets;
+    VkDescriptorPool current;
+    std::vector<VkDescriptorPool> usedPools;
+    std::vector<VkDescriptorPool> freePools;
+
+  };
+
+}
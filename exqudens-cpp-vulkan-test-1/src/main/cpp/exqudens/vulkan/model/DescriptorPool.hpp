@@ -6,7 +6,7 @@ namespace exqudens::vulkan {
 
   struct DescriptorPool {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     VkDevice device;
     VkDescriptorPool value;
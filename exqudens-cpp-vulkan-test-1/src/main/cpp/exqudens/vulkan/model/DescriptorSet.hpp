@@ -6,7 +6,7 @@ namespace exqudens::vulkan {
 
   struct DescriptorSet {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     VkDescriptorSet value;
 
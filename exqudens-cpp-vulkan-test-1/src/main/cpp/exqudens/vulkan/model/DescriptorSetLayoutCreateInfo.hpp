@@ -10,6 +10,7 @@ namespace exqudens::vulkan {
 
     VkDescriptorSetLayoutCreateFlags flags;
     std::vector<VkDescriptorSetLayoutBinding> bindings;
+    std::vector<VkDescriptorBindingFlags> bindingFlags;
 
   };
 
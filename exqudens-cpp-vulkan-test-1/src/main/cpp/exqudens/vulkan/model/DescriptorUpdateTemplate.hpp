@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace exqudens::vulkan {
+
+  struct DescriptorUpdateTemplate {
+
+    uint64_t id;
+    bool destroyed;
+    VkDevice device;
+    std::vector<VkDescriptorUpdateTemplateEntry> entries;
+    std::size_t dataSize;
+    VkDescriptorUpdateTemplate value;
+
+  };
+
+}
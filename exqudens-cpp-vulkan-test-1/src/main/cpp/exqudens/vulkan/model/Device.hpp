@@ -2,13 +2,16 @@
 
 #include <vulkan/vulkan.h>
 
+#include "exqudens/vulkan/model/DeviceFunctions.hpp"
+
 namespace exqudens::vulkan {
 
   struct Device {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     VkDevice value;
+    DeviceFunctions functions;
 
   };
 
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+namespace exqudens::vulkan {
+
+  struct DeviceFunctions {
+
+    PFN_vkGetDeviceQueue getDeviceQueue = nullptr;
+    PFN_vkGetBufferMemoryRequirements getBufferMemoryRequirements = nullptr;
+    PFN_vkGetImageMemoryRequirements getImageMemoryRequirements = nullptr;
+    PFN_vkGetSwapchainImagesKHR getSwapchainImagesKHR = nullptr;
+    PFN_vkUpdateDescriptorSets updateDescriptorSets = nullptr;
+    PFN_vkUpdateDescriptorSetWithTemplate updateDescriptorSetWithTemplate = nullptr;
+    PFN_vkCreateCommandPool createCommandPool = nullptr;
+    PFN_vkCreateSwapchainKHR createSwapchainKHR = nullptr;
+    PFN_vkCreateBuffer createBuffer = nullptr;
+    PFN_vkCreateImage createImage = nullptr;
+    PFN_vkCreateImageView createImageView = nullptr;
+    PFN_vkCreateRenderPass createRenderPass = nullptr;
+    PFN_vkCreateDescriptorSetLayout createDescriptorSetLayout = nullptr;
+    PFN_vkCreateShaderModule createShaderModule = nullptr;
+    PFN_vkCreatePipelineLayout createPipelineLayout = nullptr;
+    PFN_vkCreateGraphicsPipelines createGraphicsPipelines = nullptr;
+    PFN_vkCreateComputePipelines createComputePipelines = nullptr;
+    PFN_vkCreateFramebuffer createFramebuffer = nullptr;
+    PFN_vkCreateSampler createSampler = nullptr;
+    PFN_vkCreateDescriptorPool createDescriptorPool = nullptr;
+    PFN_vkCreateDescriptorUpdateTemplate createDescriptorUpdateTemplate = nullptr;
+    PFN_vkCreateSemaphore createSemaphore = nullptr;
+    PFN_vkCreateFence createFence = nullptr;
+    PFN_vkAllocateMemory allocateMemory = nullptr;
+    PFN_vkAllocateDescriptorSets allocateDescriptorSets = nullptr;
+    PFN_vkAllocateCommandBuffers allocateCommandBuffers = nullptr;
+    PFN_vkBindBufferMemory bindBufferMemory = nullptr;
+    PFN_vkBindImageMemory bindImageMemory = nullptr;
+    PFN_vkMapMemory mapMemory = nullptr;
+    PFN_vkUnmapMemory unmapMemory = nullptr;
+    PFN_vkFreeMemory freeMemory = nullptr;
+    PFN_vkFreeCommandBuffers freeCommandBuffers = nullptr;
+    PFN_vkResetDescriptorPool resetDescriptorPool = nullptr;
+    PFN_vkDestroyFence destroyFence = nullptr;
+    PFN_vkDestroySemaphore destroySemaphore = nullptr;
+    PFN_vkDestroyDescriptorPool destroyDescriptorPool = nullptr;
+    PFN_vkDestroyDescriptorUpdateTemplate destroyDescriptorUpdateTemplate = nullptr;
+    PFN_vkDestroySampler destroySampler = nullptr;
+    PFN_vkDestroyFramebuffer destroyFramebuffer = nullptr;
+    PFN_vkDestroyPipeline destroyPipeline = nullptr;
+    PFN_vkDestroyPipelineLayout destroyPipelineLayout = nullptr;
+    PFN_vkDestroyShaderModule destroyShaderModule = nullptr;
+    PFN_vkDestroyDescriptorSetLayout destroyDescriptorSetLayout = nullptr;
+    PFN_vkDestroyRenderPass destroyRenderPass = nullptr;
+    PFN_vkDestroyImageView destroyImageView = nullptr;
+    PFN_vkDestroyImage destroyImage = nullptr;
+    PFN_vkDestroyBuffer destroyBuffer = nullptr;
+    PFN_vkDestroySwapchainKHR destroySwapchainKHR = nullptr;
+    PFN_vkDestroyCommandPool destroyCommandPool = nullptr;
+    PFN_vkDestroyDevice destroyDevice = nullptr;
+    PFN_vkCmdCopyBuffer cmdCopyBuffer = nullptr;
+    PFN_vkCmdCopyBufferToImage cmdCopyBufferToImage = nullptr;
+    PFN_vkCmdPipelineBarrier cmdPipelineBarrier = nullptr;
+    PFN_vkCmdBindPipeline cmdBindPipeline = nullptr;
+    PFN_vkCmdDispatch cmdDispatch = nullptr;
+    PFN_vkCmdDispatchIndirect cmdDispatchIndirect = nullptr;
+    PFN_vkCmdBindDescriptorSets cmdBindDescriptorSets = nullptr;
+    PFN_vkCmdPushConstants cmdPushConstants = nullptr;
+    PFN_vkCmdPushDescriptorSetKHR cmdPushDescriptorSetKHR = nullptr;
+
+  };
+
+}
@@ -0,0 +1,834 @@
+#pragma once
+
+#include <cstdint>
+
+#include <vulkan/vulkan.h>
+
+namespace exqudens::vulkan {
+
+  // the driver entries of Functions as plain calls the compiler can inline,
+  // createSurfaceKHR is left out as it is supplied by the window system integration
+  struct DirectFunctions {
+
+    struct {
+      void operator()(
+          uint32_t*                                 pPropertyCount,
+          VkLayerProperties*                        pProperties
+      ) const {
+        vkEnumerateInstanceLayerProperties(pPropertyCount, pProperties);
+      }
+    } enumerateInstanceLayerProperties;
+
+    struct {
+      void operator()(
+          VkPhysicalDevice                          physicalDevice,
+          const char*                               pLayerName,
+          uint32_t*                                 pPropertyCount,
+          VkExtensionProperties*                    pProperties
+      ) const {
+        vkEnumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties);
+      }
+    } enumerateDeviceExtensionProperties;
+
+    struct {
+      void operator()(
+          VkInstance                                instance,
+          uint32_t*                                 pPhysicalDeviceCount,
+          VkPhysicalDevice*                         pPhysicalDevices
+      ) const {
+        vkEnumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
+      }
+    } enumeratePhysicalDevices;
+
+    struct {
+      void operator()(
+          VkPhysicalDevice                          physicalDevice,
+          VkPhysicalDeviceProperties*               pProperties
+      ) const {
+        vkGetPhysicalDeviceProperties(physicalDevice, pProperties);
+      }
+    } getPhysicalDeviceProperties;
+
+    struct {
+      void operator()(
+          VkPhysicalDevice                          physicalDevice,
+          uint32_t*                                 pQueueFamilyPropertyCount,
+          VkQueueFamilyProperties*                  pQueueFamilyProperties
+      ) const {
+        vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+      }
+    } getPhysicalDeviceQueueFamilyProperties;
+
+    struct {
+      void operator()(
+          VkPhysicalDevice                          physicalDevice,
+          uint32_t                                  queueFamilyIndex,
+          VkSurfaceKHR                              surface,
+          VkBool32*                                 pSupported
+      ) const {
+        vkGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, queueFamilyIndex, surface, pSupported);
+      }
+    } getPhysicalDeviceSurfaceSupportKHR;
+
+    struct {
+      void operator()(
+          VkPhysicalDevice                          physicalDevice,
+          VkPhysicalDeviceFeatures*                 pFeatures
+      ) const {
+        vkGetPhysicalDeviceFeatures(physicalDevice, pFeatures);
+      }
+    } getPhysicalDeviceFeatures;
+
+    struct {
+      void operator()(
+          VkPhysicalDevice                          physicalDevice,
+          VkPhysicalDeviceFeatures2*                pFeatures
+      ) const {
+        vkGetPhysicalDeviceFeatures2(physicalDevice, pFeatures);
+      }
+    } getPhysicalDeviceFeatures2;
+
+    struct {
+      void operator()(
+          VkPhysicalDevice                          physicalDevice,
+          VkSurfaceKHR                              surface,
+          VkSurfaceCapabilitiesKHR*                 pSurfaceCapabilities
+      ) const {
+        vkGetPhysicalDeviceSurfaceCapabilitiesKHR(physicalDevice, surface, pSurfaceCapabilities);
+      }
+    } getPhysicalDeviceSurfaceCapabilitiesKHR;
+
+    struct {
+      void operator()(
+          VkPhysicalDevice                          physicalDevice,
+          VkSurfaceKHR                              surface,
+          uint32_t*                                 pSurfaceFormatCount,
+          VkSurfaceFormatKHR*                       pSurfaceFormats
+      ) const {
+        vkGetPhysicalDeviceSurfaceFormatsKHR(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+      }
+    } getPhysicalDeviceSurfaceFormatsKHR;
+
+    struct {
+      void operator()(
+          VkPhysicalDevice                          physicalDevice,
+          VkSurfaceKHR                              surface,
+          uint32_t*                                 pPresentModeCount,
+          VkPresentModeKHR*                         pPresentModes
+      ) const {
+        vkGetPhysicalDeviceSurfacePresentModesKHR(physicalDevice, surface, pPresentModeCount, pPresentModes);
+      }
+    } getPhysicalDeviceSurfacePresentModesKHR;
+
+    struct {
+      void operator()(
+          VkPhysicalDevice                          physicalDevice,
+          VkPhysicalDeviceMemoryProperties*         pMemoryProperties
+      ) const {
+        vkGetPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
+      }
+    } getPhysicalDeviceMemoryProperties;
+
+    struct {
+      void operator()(
+          VkPhysicalDevice                          physicalDevice,
+          VkFormat                                  format,
+          VkFormatProperties*                       pFormatProperties
+      ) const {
+        vkGetPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
+      }
+    } getPhysicalDeviceFormatProperties;
+
+    struct {
+      PFN_vkVoidFunction operator()(
+          VkInstance                                instance,
+          const char*                               pName
+      ) const {
+        return vkGetInstanceProcAddr(instance, pName);
+      }
+    } getInstanceProcAddr;
+
+    struct {
+      PFN_vkVoidFunction operator()(
+          VkDevice                                  device,
+          const char*                               pName
+      ) const {
+        return vkGetDeviceProcAddr(device, pName);
+      }
+    } getDeviceProcAddr;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          uint32_t                                  queueFamilyIndex,
+          uint32_t                                  queueIndex,
+          VkQueue*                                  pQueue
+      ) const {
+        vkGetDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+      }
+    } getDeviceQueue;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkBuffer                                  buffer,
+          VkMemoryRequirements*                     pMemoryRequirements
+      ) const {
+        vkGetBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+      }
+    } getBufferMemoryRequirements;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkImage                                   image,
+          VkMemoryRequirements*                     pMemoryRequirements
+      ) const {
+        vkGetImageMemoryRequirements(device, image, pMemoryRequirements);
+      }
+    } getImageMemoryRequirements;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          VkSwapchainKHR                            swapchain,
+          uint32_t*                                 pSwapchainImageCount,
+          VkImage*                                  pSwapchainImages
+      ) const {
+        return vkGetSwapchainImagesKHR(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+      }
+    } getSwapchainImagesKHR;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          uint32_t                                  descriptorWriteCount,
+          const VkWriteDescriptorSet*               pDescriptorWrites,
+          uint32_t                                  descriptorCopyCount,
+          const VkCopyDescriptorSet*                pDescriptorCopies
+      ) const {
+        vkUpdateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+      }
+    } updateDescriptorSets;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkDescriptorSet                           descriptorSet,
+          VkDescriptorUpdateTemplate                descriptorUpdateTemplate,
+          const void*                               pData
+      ) const {
+        vkUpdateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, pData);
+      }
+    } updateDescriptorSetWithTemplate;
+
+    struct {
+      VkResult operator()(
+          const VkInstanceCreateInfo*               pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkInstance*                               pInstance
+      ) const {
+        return vkCreateInstance(pCreateInfo, pAllocator, pInstance);
+      }
+    } createInstance;
+
+    struct {
+      VkResult operator()(
+          VkPhysicalDevice                          physicalDevice,
+          const VkDeviceCreateInfo*                 pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkDevice*                                 pDevice
+      ) const {
+        return vkCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+      }
+    } createDevice;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkCommandPoolCreateInfo*            pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkCommandPool*                            pCommandPool
+      ) const {
+        return vkCreateCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+      }
+    } createCommandPool;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkSwapchainCreateInfoKHR*           pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkSwapchainKHR*                           pSwapchain
+      ) const {
+        return vkCreateSwapchainKHR(device, pCreateInfo, pAllocator, pSwapchain);
+      }
+    } createSwapchainKHR;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkBufferCreateInfo*                 pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkBuffer*                                 pBuffer
+      ) const {
+        return vkCreateBuffer(device, pCreateInfo, pAllocator, pBuffer);
+      }
+    } createBuffer;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkImageCreateInfo*                  pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkImage*                                  pImage
+      ) const {
+        return vkCreateImage(device, pCreateInfo, pAllocator, pImage);
+      }
+    } createImage;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkImageViewCreateInfo*              pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkImageView*                              pView
+      ) const {
+        return vkCreateImageView(device, pCreateInfo, pAllocator, pView);
+      }
+    } createImageView;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkRenderPassCreateInfo*             pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkRenderPass*                             pRenderPass
+      ) const {
+        return vkCreateRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+      }
+    } createRenderPass;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkDescriptorSetLayoutCreateInfo*    pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkDescriptorSetLayout*                    pSetLayout
+      ) const {
+        return vkCreateDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+      }
+    } createDescriptorSetLayout;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkShaderModuleCreateInfo*           pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkShaderModule*                           pShaderModule
+      ) const {
+        return vkCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
+      }
+    } createShaderModule;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkPipelineLayoutCreateInfo*         pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkPipelineLayout*                         pPipelineLayout
+      ) const {
+        return vkCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
+      }
+    } createPipelineLayout;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          VkPipelineCache                           pipelineCache,
+          uint32_t                                  createInfoCount,
+          const VkGraphicsPipelineCreateInfo*       pCreateInfos,
+          const VkAllocationCallbacks*              pAllocator,
+          VkPipeline*                               pPipelines
+      ) const {
+        return vkCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+      }
+    } createGraphicsPipelines;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          VkPipelineCache                           pipelineCache,
+          uint32_t                                  createInfoCount,
+          const VkComputePipelineCreateInfo*        pCreateInfos,
+          const VkAllocationCallbacks*              pAllocator,
+          VkPipeline*                               pPipelines
+      ) const {
+        return vkCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+      }
+    } createComputePipelines;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkFramebufferCreateInfo*            pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkFramebuffer*                            pFramebuffer
+      ) const {
+        return vkCreateFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+      }
+    } createFramebuffer;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkSamplerCreateInfo*                pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkSampler*                                pSampler
+      ) const {
+        return vkCreateSampler(device, pCreateInfo, pAllocator, pSampler);
+      }
+    } createSampler;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkDescriptorPoolCreateInfo*         pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkDescriptorPool*                         pDescriptorPool
+      ) const {
+        return vkCreateDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
+      }
+    } createDescriptorPool;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkDescriptorUpdateTemplateCreateInfo*pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkDescriptorUpdateTemplate*               pDescriptorUpdateTemplate
+      ) const {
+        return vkCreateDescriptorUpdateTemplate(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+      }
+    } createDescriptorUpdateTemplate;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkSemaphoreCreateInfo*              pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkSemaphore*                              pSemaphore
+      ) const {
+        return vkCreateSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
+      }
+    } createSemaphore;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkFenceCreateInfo*                  pCreateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkFence*                                  pFence
+      ) const {
+        return vkCreateFence(device, pCreateInfo, pAllocator, pFence);
+      }
+    } createFence;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkMemoryAllocateInfo*               pAllocateInfo,
+          const VkAllocationCallbacks*              pAllocator,
+          VkDeviceMemory*                           pMemory
+      ) const {
+        return vkAllocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+      }
+    } allocateMemory;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkDescriptorSetAllocateInfo*        pAllocateInfo,
+          VkDescriptorSet*                          pDescriptorSets
+      ) const {
+        return vkAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+      }
+    } allocateDescriptorSets;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          const VkCommandBufferAllocateInfo*        pAllocateInfo,
+          VkCommandBuffer*                          pCommandBuffers
+      ) const {
+        return vkAllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+      }
+    } allocateCommandBuffers;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          VkBuffer                                  buffer,
+          VkDeviceMemory                            memory,
+          VkDeviceSize                              memoryOffset
+      ) const {
+        return vkBindBufferMemory(device, buffer, memory, memoryOffset);
+      }
+    } bindBufferMemory;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          VkImage                                   image,
+          VkDeviceMemory                            memory,
+          VkDeviceSize                              memoryOffset
+      ) const {
+        return vkBindImageMemory(device, image, memory, memoryOffset);
+      }
+    } bindImageMemory;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          VkDeviceMemory                            memory,
+          VkDeviceSize                              offset,
+          VkDeviceSize                              size,
+          VkMemoryMapFlags                          flags,
+          void**                                    ppData
+      ) const {
+        return vkMapMemory(device, memory, offset, size, flags, ppData);
+      }
+    } mapMemory;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkDeviceMemory                            memory
+      ) const {
+        vkUnmapMemory(device, memory);
+      }
+    } unmapMemory;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkDeviceMemory                            memory,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkFreeMemory(device, memory, pAllocator);
+      }
+    } freeMemory;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkCommandPool                             commandPool,
+          uint32_t                                  commandBufferCount,
+          const VkCommandBuffer*                    pCommandBuffers
+      ) const {
+        vkFreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+      }
+    } freeCommandBuffers;
+
+    struct {
+      VkResult operator()(
+          VkDevice                                  device,
+          VkDescriptorPool                          descriptorPool,
+          VkDescriptorPoolResetFlags                flags
+      ) const {
+        return vkResetDescriptorPool(device, descriptorPool, flags);
+      }
+    } resetDescriptorPool;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkFence                                   fence,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyFence(device, fence, pAllocator);
+      }
+    } destroyFence;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkSemaphore                               semaphore,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroySemaphore(device, semaphore, pAllocator);
+      }
+    } destroySemaphore;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkDescriptorPool                          descriptorPool,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyDescriptorPool(device, descriptorPool, pAllocator);
+      }
+    } destroyDescriptorPool;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkDescriptorUpdateTemplate                descriptorUpdateTemplate,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyDescriptorUpdateTemplate(device, descriptorUpdateTemplate, pAllocator);
+      }
+    } destroyDescriptorUpdateTemplate;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkSampler                                 sampler,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroySampler(device, sampler, pAllocator);
+      }
+    } destroySampler;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkFramebuffer                             framebuffer,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyFramebuffer(device, framebuffer, pAllocator);
+      }
+    } destroyFramebuffer;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkPipeline                                pipeline,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyPipeline(device, pipeline, pAllocator);
+      }
+    } destroyPipeline;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkPipelineLayout                          pipelineLayout,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyPipelineLayout(device, pipelineLayout, pAllocator);
+      }
+    } destroyPipelineLayout;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkShaderModule                            shaderModule,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyShaderModule(device, shaderModule, pAllocator);
+      }
+    } destroyShaderModule;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkDescriptorSetLayout                     descriptorSetLayout,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
+      }
+    } destroyDescriptorSetLayout;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkRenderPass                              renderPass,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyRenderPass(device, renderPass, pAllocator);
+      }
+    } destroyRenderPass;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkImageView                               imageView,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyImageView(device, imageView, pAllocator);
+      }
+    } destroyImageView;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkImage                                   image,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyImage(device, image, pAllocator);
+      }
+    } destroyImage;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkBuffer                                  buffer,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyBuffer(device, buffer, pAllocator);
+      }
+    } destroyBuffer;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkSwapchainKHR                            swapchain,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroySwapchainKHR(device, swapchain, pAllocator);
+      }
+    } destroySwapchainKHR;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          VkCommandPool                             commandPool,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyCommandPool(device, commandPool, pAllocator);
+      }
+    } destroyCommandPool;
+
+    struct {
+      void operator()(
+          VkDevice                                  device,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyDevice(device, pAllocator);
+      }
+    } destroyDevice;
+
+    struct {
+      void operator()(
+          VkInstance                                instance,
+          VkSurfaceKHR                              surface,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroySurfaceKHR(instance, surface, pAllocator);
+      }
+    } destroySurfaceKHR;
+
+    struct {
+      void operator()(
+          VkInstance                                instance,
+          const VkAllocationCallbacks*              pAllocator
+      ) const {
+        vkDestroyInstance(instance, pAllocator);
+      }
+    } destroyInstance;
+
+    struct {
+      void operator()(
+          VkCommandBuffer                           commandBuffer,
+          VkBuffer                                  srcBuffer,
+          VkBuffer                                  dstBuffer,
+          uint32_t                                  regionCount,
+          const VkBufferCopy*                       pRegions
+      ) const {
+        vkCmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+      }
+    } cmdCopyBuffer;
+
+    struct {
+      void operator()(
+          VkCommandBuffer                           commandBuffer,
+          VkBuffer                                  srcBuffer,
+          VkImage                                   dstImage,
+          VkImageLayout                             dstImageLayout,
+          uint32_t                                  regionCount,
+          const VkBufferImageCopy*                  pRegions
+      ) const {
+        vkCmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+      }
+    } cmdCopyBufferToImage;
+
+    struct {
+      void operator()(
+          VkCommandBuffer                           commandBuffer,
+          VkPipelineStageFlags                      srcStageMask,
+          VkPipelineStageFlags                      dstStageMask,
+          VkDependencyFlags                         dependencyFlags,
+          uint32_t                                  memoryBarrierCount,
+          const VkMemoryBarrier*                    pMemoryBarriers,
+          uint32_t                                  bufferMemoryBarrierCount,
+          const VkBufferMemoryBarrier*              pBufferMemoryBarriers,
+          uint32_t                                  imageMemoryBarrierCount,
+          const VkImageMemoryBarrier*               pImageMemoryBarriers
+      ) const {
+        vkCmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+      }
+    } cmdPipelineBarrier;
+
+    struct {
+      void operator()(
+          VkCommandBuffer                           commandBuffer,
+          VkPipelineBindPoint                       pipelineBindPoint,
+          VkPipeline                                pipeline
+      ) const {
+        vkCmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+      }
+    } cmdBindPipeline;
+
+    struct {
+      void operator()(
+          VkCommandBuffer                           commandBuffer,
+          uint32_t                                  groupCountX,
+          uint32_t                                  groupCountY,
+          uint32_t                                  groupCountZ
+      ) const {
+        vkCmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+      }
+    } cmdDispatch;
+
+    struct {
+      void operator()(
+          VkCommandBuffer                           commandBuffer,
+          VkBuffer                                  buffer,
+          VkDeviceSize                              offset
+      ) const {
+        vkCmdDispatchIndirect(commandBuffer, buffer, offset);
+      }
+    } cmdDispatchIndirect;
+
+    struct {
+      void operator()(
+          VkCommandBuffer                           commandBuffer,
+          VkPipelineBindPoint                       pipelineBindPoint,
+          VkPipelineLayout                          layout,
+          uint32_t                                  firstSet,
+          uint32_t                                  descriptorSetCount,
+          const VkDescriptorSet*                    pDescriptorSets,
+          uint32_t                                  dynamicOffsetCount,
+          const uint32_t*                           pDynamicOffsets
+      ) const {
+        vkCmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+      }
+    } cmdBindDescriptorSets;
+
+    struct {
+      void operator()(
+          VkCommandBuffer                           commandBuffer,
+          VkPipelineLayout                          layout,
+          VkShaderStageFlags                        stageFlags,
+          uint32_t                                  offset,
+          uint32_t                                  size,
+          const void*                               pValues
+      ) const {
+        vkCmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+      }
+    } cmdPushConstants;
+
+  };
+
+}
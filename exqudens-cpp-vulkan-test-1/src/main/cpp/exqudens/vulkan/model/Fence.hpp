@@ -6,7 +6,7 @@ namespace exqudens::vulkan {
 
   struct Fence {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     VkDevice device;
     VkFence value;
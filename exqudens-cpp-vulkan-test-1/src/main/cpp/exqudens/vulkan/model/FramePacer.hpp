@@ -0,0 +1,25 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+#include "exqudens/vulkan/model/PresentPolicy.hpp"
+
+namespace exqudens::vulkan {
+
+  struct FramePacer {
+
+    PresentPolicy policy;
+    std::size_t frameCount;
+    std::chrono::steady_clock::time_point frameBegin;
+    std::chrono::steady_clock::time_point workBegin;
+    std::chrono::steady_clock::time_point lastPresent;
+    std::chrono::nanoseconds sleepTime;
+    std::chrono::nanoseconds presentInterval;
+    std::chrono::nanoseconds frameTime;
+    std::chrono::nanoseconds latency;
+    std::chrono::nanoseconds averageLatency;
+
+  };
+
+}
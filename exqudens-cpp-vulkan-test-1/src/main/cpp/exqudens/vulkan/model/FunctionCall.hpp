@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstdint>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace exqudens::vulkan {
+
+  struct FunctionCall {
+
+    std::string name;
+    std::chrono::nanoseconds start;
+    std::chrono::nanoseconds duration;
+    std::vector<uint8_t> arguments;
+    std::vector<uint8_t> results;
+
+  };
+
+}
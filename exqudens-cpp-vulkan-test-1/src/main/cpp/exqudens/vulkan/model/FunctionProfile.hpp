@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace exqudens::vulkan {
+
+  struct FunctionProfile {
+
+    // bucket 0 counts calls under 1ns, bucket i calls in [2^(i-1), 2^i) ns, the last one everything longer
+    static constexpr std::size_t HISTOGRAM_SIZE = 34;
+
+    std::string name;
+    std::size_t count;
+    std::chrono::nanoseconds totalTime;
+    std::chrono::nanoseconds minTime;
+    std::chrono::nanoseconds maxTime;
+    std::vector<std::size_t> histogram;
+
+  };
+
+}
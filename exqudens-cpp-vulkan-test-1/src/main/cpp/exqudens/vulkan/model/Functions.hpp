@@ -50,6 +50,11 @@ namespace exqudens::vulkan {
         VkPhysicalDeviceFeatures*                   pFeatures
     )> getPhysicalDeviceFeatures;
 
+    std::function<void(
+        VkPhysicalDevice                            physicalDevice,
+        VkPhysicalDeviceFeatures2*                  pFeatures
+    )> getPhysicalDeviceFeatures2;
+
     std::function<void(
         VkPhysicalDevice                            physicalDevice,
         VkSurfaceKHR                                surface,
@@ -86,6 +91,11 @@ namespace exqudens::vulkan {
         const char*                                 pName
     )> getInstanceProcAddr;
 
+    std::function<PFN_vkVoidFunction(
+        VkDevice                                    device,
+        const char*                                 pName
+    )> getDeviceProcAddr;
+
     std::function<void(
         VkDevice                                    device,
         uint32_t                                    queueFamilyIndex,
@@ -120,6 +130,13 @@ namespace exqudens::vulkan {
         const VkCopyDescriptorSet*                  pDescriptorCopies
     )> updateDescriptorSets;
 
+    std::function<void(
+        VkDevice                                    device,
+        VkDescriptorSet                             descriptorSet,
+        VkDescriptorUpdateTemplate                  descriptorUpdateTemplate,
+        const void*                                 pData
+    )> updateDescriptorSetWithTemplate;
+
     std::function<VkResult(
         const VkInstanceCreateInfo*                 pCreateInfo,
         const VkAllocationCallbacks*                pAllocator,
@@ -209,6 +226,15 @@ namespace exqudens::vulkan {
         VkPipeline*                                 pPipelines
     )> createGraphicsPipelines;
 
+    std::function<VkResult(
+        VkDevice                                    device,
+        VkPipelineCache                             pipelineCache,
+        uint32_t                                    createInfoCount,
+        const VkComputePipelineCreateInfo*          pCreateInfos,
+        const VkAllocationCallbacks*                pAllocator,
+        VkPipeline*                                 pPipelines
+    )> createComputePipelines;
+
     std::function<VkResult(
         VkDevice                                    device,
         const VkFramebufferCreateInfo*              pCreateInfo,
@@ -230,6 +256,13 @@ namespace exqudens::vulkan {
         VkDescriptorPool*                           pDescriptorPool
     )> createDescriptorPool;
 
+    std::function<VkResult(
+        VkDevice                                    device,
+        const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo,
+        const VkAllocationCallbacks*                pAllocator,
+        VkDescriptorUpdateTemplate*                 pDescriptorUpdateTemplate
+    )> createDescriptorUpdateTemplate;
+
     std::function<VkResult(
         VkDevice                                    device,
         const VkSemaphoreCreateInfo*                pCreateInfo,
@@ -304,6 +337,12 @@ namespace exqudens::vulkan {
         const VkCommandBuffer*                      pCommandBuffers
     )> freeCommandBuffers;
 
+    std::function<VkResult(
+        VkDevice                                    device,
+        VkDescriptorPool                            descriptorPool,
+        VkDescriptorPoolResetFlags                  flags
+    )> resetDescriptorPool;
+
     std::function<void(
         VkDevice                                    device,
         VkFence                                     fence,
@@ -322,6 +361,12 @@ namespace exqudens::vulkan {
         const VkAllocationCallbacks*                pAllocator
     )> destroyDescriptorPool;
 
+    std::function<void(
+        VkDevice                                    device,
+        VkDescriptorUpdateTemplate                  descriptorUpdateTemplate,
+        const VkAllocationCallbacks*                pAllocator
+    )> destroyDescriptorUpdateTemplate;
+
     std::function<void(
         VkDevice                                    device,
         VkSampler                                   sampler,
@@ -340,6 +385,12 @@ namespace exqudens::vulkan {
         const VkAllocationCallbacks*                pAllocator
     )> destroyPipeline;
 
+    std::function<void(
+        VkDevice                                    device,
+        VkPipelineLayout                            pipelineLayout,
+        const VkAllocationCallbacks*                pAllocator
+    )> destroyPipelineLayout;
+
     std::function<void(
         VkDevice                                    device,
         VkShaderModule                              shaderModule,
@@ -434,6 +485,45 @@ namespace exqudens::vulkan {
         const VkImageMemoryBarrier*                 pImageMemoryBarriers
     )> cmdPipelineBarrier;
 
+    std::function<void(
+        VkCommandBuffer                             commandBuffer,
+        VkPipelineBindPoint                         pipelineBindPoint,
+        VkPipeline                                  pipeline
+    )> cmdBindPipeline;
+
+    std::function<void(
+        VkCommandBuffer                             commandBuffer,
+        uint32_t                                    groupCountX,
+        uint32_t                                    groupCountY,
+        uint32_t                                    groupCountZ
+    )> cmdDispatch;
+
+    std::function<void(
+        VkCommandBuffer                             commandBuffer,
+        VkBuffer                                    buffer,
+        VkDeviceSize                                offset
+    )> cmdDispatchIndirect;
+
+    std::function<void(
+        VkCommandBuffer                             commandBuffer,
+        VkPipelineBindPoint                         pipelineBindPoint,
+        VkPipelineLayout                            layout,
+        uint32_t                                    firstSet,
+        uint32_t                                    descriptorSetCount,
+        const VkDescriptorSet*                      pDescriptorSets,
+        uint32_t                                    dynamicOffsetCount,
+        const uint32_t*                             pDynamicOffsets
+    )> cmdBindDescriptorSets;
+
+    std::function<void(
+        VkCommandBuffer                             commandBuffer,
+        VkPipelineLayout                            layout,
+        VkShaderStageFlags                          stageFlags,
+        uint32_t                                    offset,
+        uint32_t                                    size,
+        const void*                                 pValues
+    )> cmdPushConstants;
+
   };
 
 }
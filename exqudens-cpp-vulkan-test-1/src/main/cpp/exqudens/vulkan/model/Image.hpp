@@ -8,7 +8,7 @@ namespace exqudens::vulkan {
 
   struct Image {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     VkDevice device;
     //VkImageTiling tiling = VkImageTiling::VK_IMAGE_TILING_OPTIMAL;
@@ -18,6 +18,7 @@ namespace exqudens::vulkan {
     VkFormat format; // VK_FORMAT_R8G8B8A8_SRGB || VK_FORMAT_R8G8B8A8_UNORM
     VkDeviceMemory memory;
     VkDeviceSize memorySize;
+    VkDeviceSize allocationSize;
     VkMemoryPropertyFlags memoryProperties; // VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
     VkImage value;
 
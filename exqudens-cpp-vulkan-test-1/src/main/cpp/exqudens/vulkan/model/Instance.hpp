@@ -2,13 +2,16 @@
 
 #include <vulkan/vulkan.h>
 
+#include "exqudens/vulkan/model/InstanceFunctions.hpp"
+
 namespace exqudens::vulkan {
 
   struct Instance {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     VkInstance value;
+    InstanceFunctions functions;
 
   };
 
@@ -11,7 +11,7 @@ namespace exqudens::vulkan {
 
   struct PhysicalDevice {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     QueueFamilyIndexInfo queueFamilyIndexInfo;
     std::optional<SwapChainSupportDetails> swapChainSupportDetails;
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+namespace exqudens::vulkan {
+
+  struct PipelineCacheStatistics {
+
+    std::size_t hits;
+    std::size_t misses;
+    std::size_t size;
+
+  };
+
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace exqudens::vulkan {
+
+  // the default is mailbox when available and fifo otherwise, with one image above the surface minimum
+  enum class PresentPolicyMode {
+    DEFAULT,
+    LOWEST_LATENCY,
+    SMOOTH,
+    POWER_SAVING
+  };
+
+  struct PresentPolicy {
+
+    PresentPolicyMode mode;
+    uint32_t minImageCount;
+    std::chrono::nanoseconds pacingInterval;
+
+  };
+
+}
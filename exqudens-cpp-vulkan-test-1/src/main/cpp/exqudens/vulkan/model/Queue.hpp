@@ -8,7 +8,7 @@ namespace exqudens::vulkan {
 
   struct Queue {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     uint32_t index;
     uint32_t familyIndex;
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+
+namespace exqudens::vulkan {
+
+  enum class ResourceType {
+    INSTANCE,
+    DEBUG_UTILS_MESSENGER,
+    PHYSICAL_DEVICE,
+    DEVICE,
+    BUFFER,
+    IMAGE,
+    IMAGE_VIEW,
+    SAMPLER,
+    RENDER_PASS,
+    DESCRIPTOR_SET_LAYOUT,
+    DESCRIPTOR_POOL,
+    DESCRIPTOR_SET,
+    DESCRIPTOR_ALLOCATOR,
+    DESCRIPTOR_UPDATE_TEMPLATE,
+    BINDLESS_TABLE,
+    PIPELINE,
+    FRAME_BUFFER,
+    SURFACE,
+    SWAP_CHAIN,
+    QUEUE,
+    COMMAND_POOL,
+    COMMAND_BUFFER,
+    SEMAPHORE,
+    FENCE
+  };
+
+  struct ResourceKey {
+
+    ResourceType type;
+    uint64_t id;
+
+    auto operator<=>(const ResourceKey&) const = default;
+
+  };
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+#include <vulkan/vulkan.h>
+
+#include "exqudens/vulkan/model/ResourceKey.hpp"
+
+namespace exqudens::vulkan {
+
+  struct ResourceStatistics {
+
+    ResourceType type;
+    std::string name;
+    std::size_t liveCount;
+    std::size_t peakCount;
+    std::size_t createdCount;
+    VkDeviceSize memorySize; // device memory bound to the live values, buffers and images only
+    VkDeviceSize peakMemorySize;
+    std::map<std::string, std::size_t> sites; // creation site to the number of live values created there
+
+  };
+
+}
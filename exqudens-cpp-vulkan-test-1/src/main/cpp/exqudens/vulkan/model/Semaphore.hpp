@@ -6,7 +6,7 @@ namespace exqudens::vulkan {
 
   struct Semaphore {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     VkDevice device;
     VkSemaphore value;
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <variant>
+
+namespace exqudens::vulkan {
+
+  struct SpecializationInfo {
+
+    std::map<uint32_t, std::variant<bool, int32_t, uint32_t, float, double>> constants;
+
+  };
+
+}
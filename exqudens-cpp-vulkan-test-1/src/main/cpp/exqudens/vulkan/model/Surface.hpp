@@ -6,7 +6,7 @@ namespace exqudens::vulkan {
 
   struct Surface {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     VkInstance instance;
     VkSurfaceKHR value;
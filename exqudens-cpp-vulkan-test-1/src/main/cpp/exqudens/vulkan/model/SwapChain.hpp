@@ -8,12 +8,13 @@ namespace exqudens::vulkan {
 
   struct SwapChain {
 
-    unsigned int id;
+    uint64_t id;
     bool destroyed;
     VkDevice device;
     VkFormat format;
     VkExtent2D extent;
     uint32_t imageCount;
+    VkPresentModeKHR presentMode;
     uint32_t width;
     uint32_t height;
     VkSwapchainKHR value;
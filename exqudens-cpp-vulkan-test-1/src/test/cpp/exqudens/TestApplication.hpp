@@ -7,13 +7,17 @@
 #include "exqudens/test/TestUtilsTests.hpp"
 #include "exqudens/test/OtherTests.hpp"
 #include "exqudens/test/ConfigurationTests.hpp"
+#include "exqudens/test/FunctionsTests.hpp"
+#include "exqudens/test/ContextTests.hpp"
 #include "exqudens/test/ShaderTests.hpp"
+#include "exqudens/test/DescriptorTests.hpp"
 #include "exqudens/test/FactoryTests.hpp"
+#include "exqudens/test/HeadlessTests.hpp"
 #include "exqudens/test/UiTestsA.hpp"
 #include "exqudens/test/UiTestsB.hpp"
-//#include "exqudens/test/UiTestsC.hpp"
+#include "exqudens/test/UiTestsC.hpp"
 //#include "exqudens/test/UiTestsD.hpp"
-//#include "exqudens/test/UiTestsE.hpp"
+#include "exqudens/test/UiTestsE.hpp"
 
 namespace exqudens::vulkan {
 
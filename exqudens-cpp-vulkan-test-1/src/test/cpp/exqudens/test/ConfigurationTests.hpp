@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <stdexcept>
 
 #include <gtest/gtest.h>
@@ -25,4 +27,109 @@ namespace exqudens::vulkan {
     }
   }
 
+  TEST_F(ConfigurationTests, test2) {
+    try {
+      Configuration configuration = createConfiguration();
+
+      ASSERT_EQ(PresentPolicyMode::DEFAULT, configuration.presentPolicy.mode);
+
+      std::vector<VkPresentModeKHR> presentModes = {VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_IMMEDIATE_KHR};
+      VkSurfaceCapabilitiesKHR capabilities = {};
+      capabilities.minImageCount = 2;
+      capabilities.maxImageCount = 3;
+
+      PresentPolicy presentPolicy = configuration.presentPolicy;
+      ASSERT_EQ(VK_PRESENT_MODE_FIFO_KHR, chooseSwapPresentMode(presentModes, presentPolicy));
+      ASSERT_EQ(3, chooseSwapImageCount(capabilities, presentPolicy, VK_PRESENT_MODE_FIFO_KHR));
+      ASSERT_EQ(VK_PRESENT_MODE_MAILBOX_KHR, chooseSwapPresentMode({VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_MAILBOX_KHR}, presentPolicy));
+
+      presentPolicy.mode = PresentPolicyMode::LOWEST_LATENCY;
+      ASSERT_EQ(VK_PRESENT_MODE_IMMEDIATE_KHR, chooseSwapPresentMode(presentModes, presentPolicy));
+      ASSERT_EQ(2, chooseSwapImageCount(capabilities, presentPolicy, VK_PRESENT_MODE_IMMEDIATE_KHR));
+      ASSERT_EQ(3, chooseSwapImageCount(capabilities, presentPolicy, VK_PRESENT_MODE_MAILBOX_KHR));
+
+      presentPolicy.mode = PresentPolicyMode::SMOOTH;
+      ASSERT_EQ(VK_PRESENT_MODE_FIFO_KHR, chooseSwapPresentMode(presentModes, presentPolicy));
+      ASSERT_EQ(3, chooseSwapImageCount(capabilities, presentPolicy, VK_PRESENT_MODE_FIFO_KHR));
+
+      presentPolicy.mode = PresentPolicyMode::POWER_SAVING;
+      presentModes.emplace_back(VK_PRESENT_MODE_FIFO_RELAXED_KHR);
+      ASSERT_EQ(VK_PRESENT_MODE_FIFO_RELAXED_KHR, chooseSwapPresentMode(presentModes, presentPolicy));
+      ASSERT_EQ(2, chooseSwapImageCount(capabilities, presentPolicy, VK_PRESENT_MODE_FIFO_RELAXED_KHR));
+
+      presentPolicy.minImageCount = 8;
+      ASSERT_EQ(3, chooseSwapImageCount(capabilities, presentPolicy, VK_PRESENT_MODE_FIFO_RELAXED_KHR));
+
+      FramePacer framePacer = createFramePacer(presentPolicy);
+      for (std::size_t i = 0; i < 3; i++) {
+        beginFrame(framePacer);
+        endFrame(framePacer);
+      }
+
+      ASSERT_EQ(3, framePacer.frameCount);
+      ASSERT_TRUE(framePacer.latency >= std::chrono::nanoseconds::zero());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ConfigurationTests, test3) {
+    try {
+      // time only moves when the pacer sleeps or the loop below advances it
+      class ClockedFactory: public FactoryBase {
+
+        public:
+
+          std::chrono::steady_clock::time_point time = {};
+          std::chrono::nanoseconds oversleep = std::chrono::milliseconds(1);
+
+        protected:
+
+          std::chrono::steady_clock::time_point currentTime() override {
+            return time;
+          }
+
+          void sleepUntil(const std::chrono::steady_clock::time_point& value) override {
+            time = std::max(time, value + oversleep);
+          }
+
+      };
+
+      const std::size_t FRAME_COUNT = 200;
+      const std::chrono::nanoseconds PACING_INTERVAL = std::chrono::milliseconds(16);
+      const std::chrono::nanoseconds GPU_TIME = std::chrono::milliseconds(8);
+      const std::chrono::nanoseconds CPU_TIME = std::chrono::milliseconds(2);
+
+      ClockedFactory factory;
+      FramePacer framePacer = factory.createFramePacer(PresentPolicy {
+          .mode = PresentPolicyMode::SMOOTH,
+          .minImageCount = 0,
+          .pacingInterval = PACING_INTERVAL
+      });
+
+      std::chrono::steady_clock::time_point lastPresent = factory.time;
+      std::chrono::nanoseconds lastInterval = std::chrono::nanoseconds::zero();
+
+      for (std::size_t i = 0; i < FRAME_COUNT; i++) {
+        factory.beginFrame(framePacer);
+        // the fence of the previous frame signals once the gpu is done with it
+        factory.time = std::max(factory.time, lastPresent + GPU_TIME);
+        factory.endFrameWait(framePacer);
+        factory.time += CPU_TIME;
+        factory.endFrame(framePacer);
+        lastInterval = factory.time - lastPresent;
+        lastPresent = factory.time;
+      }
+
+      // an oversleep delays one frame, it does not raise the interval the next ones are paced to
+      ASSERT_EQ(FRAME_COUNT, framePacer.frameCount);
+      ASSERT_EQ(CPU_TIME, framePacer.frameTime);
+      ASSERT_LT(framePacer.presentInterval, PACING_INTERVAL);
+      ASSERT_LE(lastInterval, PACING_INTERVAL + factory.oversleep);
+      ASSERT_GE(lastInterval, PACING_INTERVAL);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
 }
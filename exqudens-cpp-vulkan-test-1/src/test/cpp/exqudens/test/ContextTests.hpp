@@ -0,0 +1,597 @@
+#pragma once
+
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <source_location>
+#include <string>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "exqudens/TestUtils.hpp"
+#include "exqudens/vulkan/ContextBase.hpp"
+#include "exqudens/vulkan/SlotMap.hpp"
+
+namespace exqudens::vulkan {
+
+  class ContextTests : public testing::Test {
+
+    protected:
+
+      // buffers, images, views, frame buffers, command pools, semaphores and memory are fake handles counted by the table,
+      // command buffers are counted apart, no device is involved
+      class MockContext: public ContextBase {
+
+        public:
+
+          std::atomic<std::size_t> createdCount = 0;
+          std::atomic<std::size_t> destroyedCount = 0;
+          std::atomic<std::size_t> allocatedCommandBufferCount = 0;
+          std::atomic<std::size_t> freedCommandBufferCount = 0;
+
+          std::mutex destroyedNamesMutex;
+          std::vector<std::string> destroyedNames = {};
+
+        protected:
+
+          Functions createFunctions() override {
+            Functions value = ContextBase::createFunctions();
+            value.getPhysicalDeviceMemoryProperties = [](VkPhysicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties) {
+              *pMemoryProperties = {};
+              pMemoryProperties->memoryTypeCount = 1;
+              pMemoryProperties->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+                  | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT
+                  | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+            };
+            value.createBuffer = [this](VkDevice, const VkBufferCreateInfo*, const VkAllocationCallbacks*, VkBuffer* pBuffer) {
+              *pBuffer = reinterpret_cast<VkBuffer>(static_cast<uintptr_t>(++createdCount));
+              return VK_SUCCESS;
+            };
+            value.getBufferMemoryRequirements = [](VkDevice, VkBuffer, VkMemoryRequirements* pMemoryRequirements) {
+              *pMemoryRequirements = {.size = 256, .alignment = 256, .memoryTypeBits = 1};
+            };
+            value.allocateMemory = [](VkDevice, const VkMemoryAllocateInfo*, const VkAllocationCallbacks*, VkDeviceMemory* pMemory) {
+              *pMemory = reinterpret_cast<VkDeviceMemory>(static_cast<uintptr_t>(1));
+              return VK_SUCCESS;
+            };
+            value.bindBufferMemory = [](VkDevice, VkBuffer, VkDeviceMemory, VkDeviceSize) {
+              return VK_SUCCESS;
+            };
+            value.freeMemory = [](VkDevice, VkDeviceMemory, const VkAllocationCallbacks*) {};
+            value.destroyBuffer = [this](VkDevice, VkBuffer, const VkAllocationCallbacks*) {
+              destroyedCount++;
+            };
+            value.createSemaphore = [this](VkDevice, const VkSemaphoreCreateInfo*, const VkAllocationCallbacks*, VkSemaphore* pSemaphore) {
+              *pSemaphore = reinterpret_cast<VkSemaphore>(static_cast<uintptr_t>(++createdCount));
+              return VK_SUCCESS;
+            };
+            value.destroySemaphore = [this](VkDevice, VkSemaphore, const VkAllocationCallbacks*) {
+              destroyedCount++;
+            };
+            value.createImage = [this](VkDevice, const VkImageCreateInfo*, const VkAllocationCallbacks*, VkImage* pImage) {
+              *pImage = reinterpret_cast<VkImage>(static_cast<uintptr_t>(++createdCount));
+              return VK_SUCCESS;
+            };
+            value.getImageMemoryRequirements = [](VkDevice, VkImage, VkMemoryRequirements* pMemoryRequirements) {
+              *pMemoryRequirements = {.size = 256, .alignment = 256, .memoryTypeBits = 1};
+            };
+            value.bindImageMemory = [](VkDevice, VkImage, VkDeviceMemory, VkDeviceSize) {
+              return VK_SUCCESS;
+            };
+            value.destroyImage = [this](VkDevice, VkImage, const VkAllocationCallbacks*) {
+              addDestroyed("image");
+            };
+            value.createImageView = [this](VkDevice, const VkImageViewCreateInfo*, const VkAllocationCallbacks*, VkImageView* pView) {
+              *pView = reinterpret_cast<VkImageView>(static_cast<uintptr_t>(++createdCount));
+              return VK_SUCCESS;
+            };
+            value.destroyImageView = [this](VkDevice, VkImageView, const VkAllocationCallbacks*) {
+              addDestroyed("imageView");
+            };
+            value.createFramebuffer = [this](VkDevice, const VkFramebufferCreateInfo*, const VkAllocationCallbacks*, VkFramebuffer* pFramebuffer) {
+              *pFramebuffer = reinterpret_cast<VkFramebuffer>(static_cast<uintptr_t>(++createdCount));
+              return VK_SUCCESS;
+            };
+            value.destroyFramebuffer = [this](VkDevice, VkFramebuffer, const VkAllocationCallbacks*) {
+              addDestroyed("frameBuffer");
+            };
+            value.createCommandPool = [this](VkDevice, const VkCommandPoolCreateInfo*, const VkAllocationCallbacks*, VkCommandPool* pCommandPool) {
+              *pCommandPool = reinterpret_cast<VkCommandPool>(static_cast<uintptr_t>(++createdCount));
+              return VK_SUCCESS;
+            };
+            value.destroyCommandPool = [this](VkDevice, VkCommandPool, const VkAllocationCallbacks*) {
+              addDestroyed("commandPool");
+            };
+            value.allocateCommandBuffers = [this](VkDevice, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) {
+              for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++) {
+                pCommandBuffers[i] = reinterpret_cast<VkCommandBuffer>(static_cast<uintptr_t>(++allocatedCommandBufferCount));
+              }
+              return VK_SUCCESS;
+            };
+            value.freeCommandBuffers = [this](VkDevice, VkCommandPool, uint32_t commandBufferCount, const VkCommandBuffer*) {
+              freedCommandBufferCount += commandBufferCount;
+            };
+            return value;
+          }
+
+        private:
+
+          void addDestroyed(const std::string& name) {
+            destroyedCount++;
+            std::lock_guard<std::mutex> lock(destroyedNamesMutex);
+            destroyedNames.emplace_back(name);
+          }
+
+      };
+
+      VkPhysicalDevice physicalDevice = nullptr;
+      VkDevice device = reinterpret_cast<VkDevice>(static_cast<uintptr_t>(1));
+
+  };
+
+  TEST_F(ContextTests, test1) {
+    try {
+      SlotMap<std::string> values;
+
+      uint64_t a = values.insert("a");
+      uint64_t b = values.insert("b");
+      uint64_t c = values.insert("c");
+
+      ASSERT_EQ(3, values.size());
+      ASSERT_FALSE(values.contains(SlotMap<std::string>::NULL_HANDLE));
+      ASSERT_EQ("b", values.at(b));
+
+      ASSERT_TRUE(values.erase(b));
+      ASSERT_FALSE(values.erase(b));
+      ASSERT_FALSE(values.contains(b));
+      ASSERT_EQ(nullptr, values.find(b));
+      ASSERT_THROW(values.at(b), std::runtime_error);
+      ASSERT_EQ("a", values.at(a));
+      ASSERT_EQ("c", values.at(c));
+
+      // the freed slot is reused under a new generation
+      uint64_t d = values.insert("d");
+
+      ASSERT_NE(b, d);
+      ASSERT_EQ(static_cast<uint32_t>(b), static_cast<uint32_t>(d));
+      ASSERT_FALSE(values.contains(b));
+      ASSERT_EQ("d", values.at(d));
+
+      std::set<std::string> iterated;
+      for (std::size_t i = 0; i < values.size(); i++) {
+        iterated.insert(values.at(values.handle(i)));
+      }
+
+      ASSERT_EQ(std::set<std::string>({"a", "c", "d"}), iterated);
+
+      values.clear();
+
+      ASSERT_TRUE(values.empty());
+      ASSERT_FALSE(values.contains(a));
+      ASSERT_FALSE(values.contains(d));
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ContextTests, test2) {
+    try {
+      const std::size_t BUFFER_COUNT = 20000;
+
+      MockContext mockContext;
+      // the overrides in ContextBase hide the convenience overloads, calls go through the interface
+      Context& context = mockContext;
+
+      std::vector<Buffer> buffers;
+      buffers.reserve(BUFFER_COUNT);
+      for (std::size_t i = 0; i < BUFFER_COUNT; i++) {
+        buffers.emplace_back(context.createBuffer(physicalDevice, device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
+      }
+
+      std::set<uint64_t> ids;
+      for (const Buffer& buffer : buffers) {
+        ids.insert(buffer.id);
+      }
+
+      ASSERT_EQ(BUFFER_COUNT, ids.size());
+      ASSERT_EQ(BUFFER_COUNT, mockContext.createdCount.load());
+
+      for (std::size_t i = 0; i < BUFFER_COUNT; i += 2) {
+        context.destroyBuffer(buffers[i]);
+      }
+
+      ASSERT_EQ(BUFFER_COUNT / 2, mockContext.destroyedCount.load());
+
+      // a second destroy of the same value is caught before it reaches the driver
+      ASSERT_THROW(context.destroyBuffer(buffers[0]), std::runtime_error);
+      ASSERT_EQ(BUFFER_COUNT / 2, mockContext.destroyedCount.load());
+
+      context.destroy();
+
+      ASSERT_EQ(BUFFER_COUNT, mockContext.destroyedCount.load());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ContextTests, test3) {
+    try {
+      const std::size_t THREAD_COUNT = 8;
+      const std::size_t ITERATION_COUNT = 2000;
+
+      MockContext mockContext;
+      Context& context = mockContext;
+      // built up front, the way createInstance would on a real context
+      mockContext.functions();
+
+      std::mutex keptMutex;
+      std::vector<uint64_t> keptIds;
+      std::vector<std::string> errors;
+      std::vector<std::thread> threads;
+      for (std::size_t t = 0; t < THREAD_COUNT; t++) {
+        threads.emplace_back([this, &context, &keptMutex, &keptIds, &errors]() {
+          try {
+            std::vector<uint64_t> ids;
+            for (std::size_t i = 0; i < ITERATION_COUNT; i++) {
+              Buffer buffer = context.createBuffer(physicalDevice, device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+              Semaphore semaphore = context.createSemaphore(device, 0);
+              if (i % 2 == 0) {
+                context.destroyBuffer(buffer);
+                context.destroySemaphore(semaphore);
+              } else {
+                ids.emplace_back(buffer.id);
+              }
+            }
+            std::lock_guard<std::mutex> lock(keptMutex);
+            keptIds.insert(keptIds.end(), ids.begin(), ids.end());
+          } catch (const std::exception& e) {
+            std::lock_guard<std::mutex> lock(keptMutex);
+            errors.emplace_back(TestUtils::toString(e));
+          }
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+
+      ASSERT_TRUE(errors.empty()) << errors.front();
+      ASSERT_EQ(THREAD_COUNT * ITERATION_COUNT * 2, mockContext.createdCount.load());
+      ASSERT_EQ(THREAD_COUNT * ITERATION_COUNT, mockContext.destroyedCount.load());
+      ASSERT_EQ(THREAD_COUNT * ITERATION_COUNT / 2, std::set<uint64_t>(keptIds.begin(), keptIds.end()).size());
+
+      context.destroy();
+
+      ASSERT_EQ(mockContext.createdCount.load(), mockContext.destroyedCount.load());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ContextTests, test4) {
+    try {
+      const std::size_t BUFFER_COUNT = 1000;
+
+      MockContext mockContext;
+      Context& context = mockContext;
+
+      Image imageA = context.createImage(physicalDevice, device, 64, 64, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+      Image imageB = context.createImage(physicalDevice, device, 64, 64, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+      // one view per mip level so the view cache hands out distinct views
+      for (uint32_t mipLevel = 0; mipLevel < 3; mipLevel++) {
+        VkImageViewCreateInfo viewInfo = {};
+        viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+        viewInfo.image = imageA.value;
+        viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        viewInfo.format = VK_FORMAT_R8G8B8A8_UNORM;
+        viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        viewInfo.subresourceRange.baseMipLevel = mipLevel;
+        viewInfo.subresourceRange.levelCount = 1;
+        viewInfo.subresourceRange.baseArrayLayer = 0;
+        viewInfo.subresourceRange.layerCount = 1;
+        ImageView imageView = context.createImageView(device, viewInfo);
+        context.createFrameBuffer(device, FrameBufferCreateInfo {
+            .flags = 0,
+            .renderPass = VK_NULL_HANDLE,
+            .attachments = {imageView.value},
+            .width = 64,
+            .height = 64,
+            .layers = 1
+        });
+      }
+      context.createImageView(device, imageB.value, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_ASPECT_COLOR_BIT);
+
+      context.destroyWithDependents({.type = ResourceType::IMAGE, .id = imageA.id});
+
+      ASSERT_EQ(
+          std::vector<std::string>({"frameBuffer", "frameBuffer", "frameBuffer", "imageView", "imageView", "imageView", "image"}),
+          mockContext.destroyedNames
+      );
+      ASSERT_THROW(context.destroyImage(imageA), std::runtime_error);
+      ASSERT_THROW(context.destroyWithDependents({.type = ResourceType::IMAGE, .id = imageA.id}), std::runtime_error);
+
+      // enough independent buffers for the shutdown to spread over worker threads
+      for (std::size_t i = 0; i < BUFFER_COUNT; i++) {
+        context.createBuffer(physicalDevice, device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+      }
+
+      context.destroy();
+
+      ASSERT_EQ(mockContext.createdCount.load(), mockContext.destroyedCount.load());
+      ASSERT_EQ(9, mockContext.destroyedNames.size());
+      ASSERT_EQ("imageView", mockContext.destroyedNames[7]);
+      ASSERT_EQ("image", mockContext.destroyedNames[8]);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ContextTests, test5) {
+    try {
+      const std::size_t BUFFER_COUNT = 100;
+      const std::size_t COMMAND_BUFFER_COUNT = 10;
+
+      MockContext mockContext;
+      Context& context = mockContext;
+
+      uint64_t outerScope = context.beginScope();
+      Buffer outerBuffer = context.createBuffer(physicalDevice, device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+
+      uint64_t innerScope = context.beginScope();
+      for (std::size_t i = 0; i < BUFFER_COUNT; i++) {
+        context.createBuffer(physicalDevice, device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+      }
+      CommandPool commandPool = context.createCommandPool(device, 0, 0);
+      for (std::size_t i = 0; i < COMMAND_BUFFER_COUNT; i++) {
+        context.createCommandBuffer(device, commandPool.value);
+      }
+      Buffer innerBuffer = context.createBuffer(physicalDevice, device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+      context.destroyBuffer(innerBuffer);
+
+      ASSERT_THROW(context.endScope(outerScope), std::runtime_error);
+
+      std::size_t destroyedCount = mockContext.destroyedCount.load();
+      context.endScope(innerScope);
+
+      // the command buffers go with their pool instead of one free call each
+      ASSERT_EQ(destroyedCount + BUFFER_COUNT + 1, mockContext.destroyedCount.load());
+      ASSERT_EQ(COMMAND_BUFFER_COUNT, mockContext.allocatedCommandBufferCount.load());
+      ASSERT_EQ(0, mockContext.freedCommandBufferCount.load());
+      ASSERT_EQ(std::vector<std::string>({"commandPool"}), mockContext.destroyedNames);
+      ASSERT_THROW(context.destroyCommandPool(commandPool), std::runtime_error);
+
+      context.endScope(outerScope);
+
+      ASSERT_EQ(mockContext.createdCount.load(), mockContext.destroyedCount.load());
+      ASSERT_THROW(context.destroyBuffer(outerBuffer), std::runtime_error);
+      ASSERT_THROW(context.endScope(outerScope), std::runtime_error);
+
+      // scopes are per thread, the other thread neither fills nor ends this one
+      uint64_t mainScope = context.beginScope();
+      Buffer threadBuffer = {};
+      std::string threadError;
+      std::thread thread([this, &context, &threadBuffer, &threadError, mainScope]() {
+        try {
+          threadBuffer = context.createBuffer(physicalDevice, device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+          context.endScope(mainScope);
+        } catch (const std::exception& e) {
+          threadError = TestUtils::toString(e);
+        }
+      });
+      thread.join();
+      context.endScope(mainScope);
+
+      ASSERT_TRUE(threadBuffer.value != nullptr);
+      ASSERT_FALSE(threadError.empty());
+      ASSERT_NO_THROW(context.destroyBuffer(threadBuffer));
+      ASSERT_EQ(mockContext.createdCount.load(), mockContext.destroyedCount.load());
+
+      context.destroy();
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ContextTests, test6) {
+    try {
+      MockContext mockContext;
+      Context& context = mockContext;
+
+      auto findStatistics = [](const std::vector<ResourceStatistics>& values, ResourceType type) {
+        for (const ResourceStatistics& value : values) {
+          if (value.type == type) {
+            return value;
+          }
+        }
+        throw std::runtime_error(CALL_INFO() + ": failed to find statistics!");
+      };
+
+      // the table rounds every buffer up to 256 bytes, two of them come from the loop and one from below it
+      std::vector<Buffer> buffers;
+      std::string loopSite = "ContextTests.hpp:" + std::to_string(std::source_location::current().line() + 2) + ")";
+      for (std::size_t i = 0; i < 2; i++) {
+        buffers.emplace_back(context.createBuffer(physicalDevice, device, 200, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
+      }
+      buffers.emplace_back(context.createBuffer(physicalDevice, device, 200, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT));
+
+      // the statistics count the allocation, the buffer keeps its requested size
+      ASSERT_EQ(200, buffers[0].memorySize);
+      ASSERT_EQ(256, buffers[0].allocationSize);
+
+      context.createImage(physicalDevice, device, 64, 64, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+      context.createSemaphore(device, 0);
+      context.destroyBuffer(buffers[0]);
+
+      std::vector<ResourceStatistics> statistics = context.getResourceStatistics();
+      ResourceStatistics bufferStatistics = findStatistics(statistics, ResourceType::BUFFER);
+
+      ASSERT_EQ(3, statistics.size());
+      ASSERT_EQ("BUFFER", bufferStatistics.name);
+      ASSERT_EQ(2, bufferStatistics.liveCount);
+      ASSERT_EQ(3, bufferStatistics.peakCount);
+      ASSERT_EQ(3, bufferStatistics.createdCount);
+      ASSERT_EQ(512, bufferStatistics.memorySize);
+      ASSERT_EQ(768, bufferStatistics.peakMemorySize);
+      ASSERT_EQ(2, bufferStatistics.sites.size());
+      for (const auto& [site, count] : bufferStatistics.sites) {
+        ASSERT_NE(std::string::npos, site.find("ContextTests.hpp:"));
+        ASSERT_EQ(1, count);
+      }
+      ASSERT_EQ(1, std::count_if(bufferStatistics.sites.begin(), bufferStatistics.sites.end(), [&loopSite](const auto& site) {
+        return site.first.ends_with(loopSite);
+      }));
+      ASSERT_EQ(256, findStatistics(statistics, ResourceType::IMAGE).memorySize);
+      ASSERT_EQ(0, findStatistics(statistics, ResourceType::SEMAPHORE).memorySize);
+      ASSERT_TRUE(context.getResourceLeaks().empty());
+
+      std::ostringstream stream;
+      context.writeResourceStatistics(stream);
+
+      ASSERT_NE(std::string::npos, stream.str().find("\"name\": \"BUFFER\", \"liveCount\": 2, \"peakCount\": 3"));
+
+      context.destroy();
+
+      std::vector<ResourceStatistics> leaks = context.getResourceLeaks();
+
+      ASSERT_EQ(3, leaks.size());
+      ASSERT_EQ(2, findStatistics(leaks, ResourceType::BUFFER).liveCount);
+      ASSERT_EQ(1, findStatistics(leaks, ResourceType::IMAGE).liveCount);
+      ASSERT_EQ(1, findStatistics(leaks, ResourceType::SEMAPHORE).liveCount);
+
+      // counts drop to zero, peaks stay
+      for (const ResourceStatistics& value : context.getResourceStatistics()) {
+        ASSERT_EQ(0, value.liveCount);
+        ASSERT_EQ(0, value.memorySize);
+        ASSERT_TRUE(value.sites.empty());
+      }
+      ASSERT_EQ(3, findStatistics(context.getResourceStatistics(), ResourceType::BUFFER).peakCount);
+
+      // a run that cleans up after itself leaves nothing for destroy()
+      Semaphore semaphore = context.createSemaphore(device, 0);
+      context.destroySemaphore(semaphore);
+      context.destroy();
+
+      ASSERT_TRUE(context.getResourceLeaks().empty());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ContextTests, test7) {
+    try {
+      MockContext mockContext;
+      Context& context = mockContext;
+
+      Image image = context.createImage(physicalDevice, device, 64, 64, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+      // the second create is a cache hit, both references share one handle
+      ImageView imageViewA = context.createImageView(device, image.value, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_ASPECT_COLOR_BIT);
+      ImageView imageViewB = context.createImageView(device, image.value, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_ASPECT_COLOR_BIT);
+
+      ASSERT_EQ(imageViewA.value, imageViewB.value);
+      ASSERT_NE(imageViewA.id, imageViewB.id);
+
+      context.destroyImageView(imageViewB);
+
+      ASSERT_TRUE(mockContext.destroyedNames.empty());
+
+      // the handle is still held by the first reference, a new dependent links to it
+      context.createFrameBuffer(device, FrameBufferCreateInfo {
+          .flags = 0,
+          .renderPass = VK_NULL_HANDLE,
+          .attachments = {imageViewA.value},
+          .width = 64,
+          .height = 64,
+          .layers = 1
+      });
+
+      context.destroyWithDependents({.type = ResourceType::IMAGE_VIEW, .id = imageViewA.id});
+
+      ASSERT_EQ(std::vector<std::string>({"frameBuffer", "imageView"}), mockContext.destroyedNames);
+
+      context.destroy();
+
+      ASSERT_EQ(mockContext.createdCount.load(), mockContext.destroyedCount.load());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ContextTests, test8) {
+    try {
+      // calls that reach the entry point a device hands out, loader calls are counted by the mock table
+      static std::atomic<std::size_t> deviceCreateBufferCount = 0;
+      deviceCreateBufferCount = 0;
+
+      class MultiDeviceContext: public MockContext {
+
+        protected:
+
+          Functions createFunctions() override {
+            Functions value = MockContext::createFunctions();
+            value.createDevice = [this](VkPhysicalDevice, const VkDeviceCreateInfo*, const VkAllocationCallbacks*, VkDevice* pDevice) {
+              *pDevice = reinterpret_cast<VkDevice>(static_cast<uintptr_t>(++deviceCount));
+              return VK_SUCCESS;
+            };
+            value.destroyDevice = [](VkDevice, const VkAllocationCallbacks*) {};
+            value.getDeviceProcAddr = [](VkDevice, const char* pName) -> PFN_vkVoidFunction {
+              if (std::string(pName) != "vkCreateBuffer") {
+                return nullptr;
+              }
+              PFN_vkCreateBuffer function = [](VkDevice, const VkBufferCreateInfo*, const VkAllocationCallbacks*, VkBuffer* pBuffer) {
+                *pBuffer = reinterpret_cast<VkBuffer>(static_cast<uintptr_t>(0x1000 + ++deviceCreateBufferCount));
+                return VK_SUCCESS;
+              };
+              return reinterpret_cast<PFN_vkVoidFunction>(function);
+            };
+            return value;
+          }
+
+        private:
+
+          std::size_t deviceCount = 0;
+
+      };
+
+      MultiDeviceContext mockContext;
+      Context& context = mockContext;
+
+      Configuration configuration = context.createConfiguration();
+      configuration.validationLayersEnabled = false;
+      configuration.deviceExtensions = {};
+      QueueFamilyIndexInfo queueFamilyIndexInfo = {};
+
+      Device deviceA = context.createDevice(physicalDevice, configuration, queueFamilyIndexInfo);
+      context.createBuffer(physicalDevice, deviceA.value, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+
+      ASSERT_EQ(1, deviceCreateBufferCount.load());
+      ASSERT_EQ(0, mockContext.createdCount.load());
+
+      // with two devices alive the shared table cannot pick one, calls go through the loader
+      Device deviceB = context.createDevice(physicalDevice, configuration, queueFamilyIndexInfo);
+      context.createBuffer(physicalDevice, deviceB.value, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+      context.createBuffer(physicalDevice, deviceA.value, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+
+      ASSERT_NE(deviceA.value, deviceB.value);
+      ASSERT_EQ(1, deviceCreateBufferCount.load());
+      ASSERT_EQ(2, mockContext.createdCount.load());
+
+      context.destroyDevice(deviceB);
+      context.createBuffer(physicalDevice, deviceA.value, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+
+      ASSERT_EQ(2, deviceCreateBufferCount.load());
+      ASSERT_EQ(2, mockContext.createdCount.load());
+
+      context.destroy();
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
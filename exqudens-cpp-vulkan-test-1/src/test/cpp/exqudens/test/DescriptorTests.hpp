@@ -0,0 +1,347 @@
+#pragma once
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "exqudens/TestUtils.hpp"
+#include "exqudens/test/DeviceTestsBase.hpp"
+#include "exqudens/vulkan/RendererBase.hpp"
+
+namespace exqudens::vulkan {
+
+  class DescriptorTests : public DeviceTestsBase, protected RendererBase {
+  };
+
+  TEST_F(DescriptorTests, test1) {
+    try {
+      ASSERT_TRUE(setUpDevice());
+
+      DescriptorSetLayout descriptorSetLayout = createDescriptorSetLayout(
+          device.value,
+          DescriptorSetLayoutCreateInfo {
+              .flags = 0,
+              .bindings = {
+                  VkDescriptorSetLayoutBinding {
+                      .binding = 0,
+                      .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                      .descriptorCount = 1,
+                      .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+                      .pImmutableSamplers = nullptr
+                  }
+              }
+          }
+      );
+
+      DescriptorAllocator descriptorAllocator = createDescriptorAllocator(
+          device.value,
+          DescriptorPoolCreateInfo {
+              .flags = 0,
+              .maxSets = 2,
+              .poolSizes = {
+                  VkDescriptorPoolSize {
+                      .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                      .descriptorCount = 2
+                  }
+              }
+          }
+      );
+
+      for (std::size_t i = 0; i < 5; i++) {
+        std::vector<DescriptorSet> descriptorSets = allocateDescriptorSets(descriptorAllocator, {descriptorSetLayout.value}, {});
+        ASSERT_EQ(descriptorSets.size(), 1);
+        ASSERT_TRUE(descriptorSets[0].value != nullptr);
+      }
+
+      ASSERT_TRUE(descriptorAllocator.usedPools.size() > 1);
+      ASSERT_EQ(descriptorAllocator.allocatedSets, 5);
+      ASSERT_EQ(descriptorAllocator.peakSets, 5);
+
+      resetDescriptorAllocator(descriptorAllocator);
+
+      ASSERT_TRUE(descriptorAllocator.usedPools.empty());
+      ASSERT_TRUE(descriptorAllocator.freePools.empty());
+      ASSERT_EQ(descriptorAllocator.setsPerPool, 5);
+      ASSERT_EQ(descriptorAllocator.allocatedSets, 0);
+
+      std::vector<DescriptorSet> descriptorSets = allocateDescriptorSets(
+          descriptorAllocator,
+          std::vector<VkDescriptorSetLayout>(5, descriptorSetLayout.value),
+          {}
+      );
+
+      ASSERT_EQ(descriptorSets.size(), 5);
+      ASSERT_EQ(descriptorAllocator.usedPools.size(), 1);
+
+      resetDescriptorAllocator(descriptorAllocator);
+
+      ASSERT_TRUE(descriptorAllocator.usedPools.empty());
+      ASSERT_EQ(descriptorAllocator.freePools.size(), 1);
+
+      destroyDescriptorAllocator(descriptorAllocator);
+      destroyDescriptorSetLayout(descriptorSetLayout);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(DescriptorTests, test2) {
+    try {
+      ASSERT_TRUE(setUpDevice());
+
+      Buffer buffer = createBuffer(
+          physicalDevice.value,
+          device.value,
+          256,
+          VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+      );
+
+      DescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo = {
+          .flags = 0,
+          .bindings = {
+              VkDescriptorSetLayoutBinding {
+                  .binding = 1,
+                  .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                  .descriptorCount = 2,
+                  .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+                  .pImmutableSamplers = nullptr
+              },
+              VkDescriptorSetLayoutBinding {
+                  .binding = 0,
+                  .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                  .descriptorCount = 1,
+                  .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+                  .pImmutableSamplers = nullptr
+              }
+          }
+      };
+      DescriptorSetLayout descriptorSetLayout = createDescriptorSetLayout(device.value, descriptorSetLayoutCreateInfo);
+
+      DescriptorUpdateTemplate descriptorUpdateTemplate = createDescriptorUpdateTemplate(
+          device.value,
+          descriptorSetLayout.value,
+          descriptorSetLayoutCreateInfo
+      );
+
+      ASSERT_TRUE(descriptorUpdateTemplate.value != nullptr);
+      ASSERT_EQ(descriptorUpdateTemplate.entries.size(), 2);
+      ASSERT_EQ(descriptorUpdateTemplate.entries[0].dstBinding, 0);
+      ASSERT_EQ(descriptorUpdateTemplate.entries[0].offset, 0);
+      ASSERT_EQ(descriptorUpdateTemplate.entries[1].dstBinding, 1);
+      ASSERT_EQ(descriptorUpdateTemplate.entries[1].offset, sizeof(VkDescriptorBufferInfo));
+
+      struct {
+        VkDescriptorBufferInfo input;
+        VkDescriptorBufferInfo outputs[2];
+      } data = {
+          .input = {.buffer = buffer.value, .offset = 0, .range = 64},
+          .outputs = {
+              {.buffer = buffer.value, .offset = 64, .range = 64},
+              {.buffer = buffer.value, .offset = 128, .range = 64}
+          }
+      };
+
+      ASSERT_EQ(descriptorUpdateTemplate.dataSize, sizeof(data));
+
+      DescriptorAllocator descriptorAllocator = createDescriptorAllocator(
+          device.value,
+          DescriptorPoolCreateInfo {
+              .flags = 0,
+              .maxSets = 1,
+              .poolSizes = {
+                  VkDescriptorPoolSize {
+                      .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                      .descriptorCount = 3
+                  }
+              }
+          }
+      );
+      std::vector<DescriptorSet> descriptorSets = allocateDescriptorSets(descriptorAllocator, {descriptorSetLayout.value}, {});
+
+      updateDescriptorSetWithTemplate(descriptorUpdateTemplate, descriptorSets[0].value, &data);
+
+      destroyDescriptorAllocator(descriptorAllocator);
+      destroyDescriptorUpdateTemplate(descriptorUpdateTemplate);
+      destroyDescriptorSetLayout(descriptorSetLayout);
+      destroyBuffer(buffer);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(DescriptorTests, test3) {
+    try {
+      configuration.deviceExtensions = {
+          VK_KHR_MAINTENANCE3_EXTENSION_NAME,
+          VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME
+      };
+
+      ASSERT_TRUE(setUpDevice());
+
+      Image image = createImage(
+          physicalDevice.value,
+          device.value,
+          4,
+          4,
+          VK_FORMAT_R8G8B8A8_UNORM,
+          VK_IMAGE_TILING_OPTIMAL,
+          VK_IMAGE_USAGE_SAMPLED_BIT,
+          VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+      );
+      ImageView imageView = createImageView(device.value, image.value, VK_FORMAT_R8G8B8A8_UNORM);
+      Sampler sampler = createSampler(physicalDevice.value, device.value, false);
+
+      BindlessTable bindlessTable = createBindlessTable(device.value, 2);
+
+      ASSERT_TRUE(bindlessTable.layout != nullptr);
+      ASSERT_TRUE(bindlessTable.value != nullptr);
+
+      uint32_t slot0 = registerTexture(bindlessTable, imageView.value, sampler.value);
+      uint32_t slot1 = registerTexture(bindlessTable, imageView.value, sampler.value);
+
+      ASSERT_EQ(slot0, 0);
+      ASSERT_EQ(slot1, 1);
+      ASSERT_ANY_THROW(registerTexture(bindlessTable, imageView.value, sampler.value));
+
+      // the set is bound before the writes below, update after bind keeps the recorded command buffer valid
+      CommandPool commandPool = createCommandPool(device.value, physicalDevice.queueFamilyIndexInfo.graphicsFamily.value());
+      CommandBuffer commandBuffer = createCommandBuffer(device.value, commandPool.value);
+      Queue queue = createQueue(device.value, physicalDevice.queueFamilyIndexInfo.graphicsFamily.value(), 0);
+
+      VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+      pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+      pipelineLayoutInfo.setLayoutCount = 1;
+      pipelineLayoutInfo.pSetLayouts = &bindlessTable.layout;
+      VkPipelineLayout pipelineLayout = nullptr;
+
+      ASSERT_EQ(vkCreatePipelineLayout(device.value, &pipelineLayoutInfo, nullptr, &pipelineLayout), VK_SUCCESS);
+
+      VkCommandBufferBeginInfo beginInfo = {};
+      beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+      vkBeginCommandBuffer(commandBuffer.value, &beginInfo);
+      vkCmdBindDescriptorSets(commandBuffer.value, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &bindlessTable.value, 0, nullptr);
+      vkEndCommandBuffer(commandBuffer.value);
+
+      unregisterTexture(bindlessTable, slot0);
+
+      ASSERT_ANY_THROW(unregisterTexture(bindlessTable, slot0));
+      ASSERT_EQ(registerTexture(bindlessTable, imageView.value, sampler.value), slot0);
+
+      VkSubmitInfo submitInfo = {};
+      submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+      submitInfo.commandBufferCount = 1;
+      submitInfo.pCommandBuffers = &commandBuffer.value;
+
+      ASSERT_EQ(vkQueueSubmit(queue.value, 1, &submitInfo, VK_NULL_HANDLE), VK_SUCCESS);
+      ASSERT_EQ(vkQueueWaitIdle(queue.value), VK_SUCCESS);
+      ASSERT_EQ(stream.str().find("VUID-"), std::string::npos);
+
+      vkDestroyPipelineLayout(device.value, pipelineLayout, nullptr);
+      destroyQueue(queue);
+      destroyCommandBuffer(commandBuffer);
+      destroyCommandPool(commandPool);
+
+      destroyBindlessTable(bindlessTable);
+      destroySampler(sampler);
+      destroyImageView(imageView);
+      destroyImage(image);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(DescriptorTests, test4) {
+    try {
+      configuration.deviceExtensions = {VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME};
+
+      if (!setUpDevice()) {
+        GTEST_SKIP() << "'" << VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME << "' is not available";
+      }
+
+      DescriptorSetLayout descriptorSetLayout = createPushDescriptorSetLayout(
+          device.value,
+          DescriptorSetLayoutCreateInfo {
+              .flags = 0,
+              .bindings = {
+                  VkDescriptorSetLayoutBinding {
+                      .binding = 0,
+                      .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                      .descriptorCount = 1,
+                      .stageFlags = VK_SHADER_STAGE_VERTEX_BIT,
+                      .pImmutableSamplers = nullptr
+                  }
+              }
+          }
+      );
+
+      ASSERT_TRUE(descriptorSetLayout.value != nullptr);
+
+      Buffer buffer = createBuffer(
+          physicalDevice.value,
+          device.value,
+          64,
+          VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+      );
+      CommandPool commandPool = createCommandPool(device.value, physicalDevice.queueFamilyIndexInfo.graphicsFamily.value());
+      CommandBuffer commandBuffer = createCommandBuffer(device.value, commandPool.value);
+      Queue queue = createQueue(device.value, physicalDevice.queueFamilyIndexInfo.graphicsFamily.value(), 0);
+
+      VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+      pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+      pipelineLayoutInfo.setLayoutCount = 1;
+      pipelineLayoutInfo.pSetLayouts = &descriptorSetLayout.value;
+      VkPipelineLayout pipelineLayout = nullptr;
+
+      ASSERT_EQ(vkCreatePipelineLayout(device.value, &pipelineLayoutInfo, nullptr, &pipelineLayout), VK_SUCCESS);
+
+      std::vector<WriteDescriptorSet> writeDescriptorSets = {
+          WriteDescriptorSet {
+              .dstBinding = 0,
+              .dstArrayElement = 0,
+              .descriptorCount = 1,
+              .descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+              .bufferInfo = {
+                  VkDescriptorBufferInfo {
+                      .buffer = buffer.value,
+                      .offset = 0,
+                      .range = 64
+                  }
+              }
+          }
+      };
+
+      VkCommandBufferBeginInfo beginInfo = {};
+      beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+      vkBeginCommandBuffer(commandBuffer.value, &beginInfo);
+      cmdPushDescriptorSet(device, commandBuffer.value, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, writeDescriptorSets);
+      vkEndCommandBuffer(commandBuffer.value);
+
+      VkSubmitInfo submitInfo = {};
+      submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+      submitInfo.commandBufferCount = 1;
+      submitInfo.pCommandBuffers = &commandBuffer.value;
+
+      ASSERT_EQ(vkQueueSubmit(queue.value, 1, &submitInfo, VK_NULL_HANDLE), VK_SUCCESS);
+      ASSERT_EQ(vkQueueWaitIdle(queue.value), VK_SUCCESS);
+      ASSERT_EQ(stream.str().find("VUID-"), std::string::npos);
+
+      // a device created without the extension has no entry point to push with
+      Device deviceWithoutPush = device;
+      deviceWithoutPush.functions.cmdPushDescriptorSetKHR = nullptr;
+
+      ASSERT_ANY_THROW(cmdPushDescriptorSet(deviceWithoutPush, commandBuffer.value, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, writeDescriptorSets));
+
+      vkDestroyPipelineLayout(device.value, pipelineLayout, nullptr);
+      destroyQueue(queue);
+      destroyCommandBuffer(commandBuffer);
+      destroyCommandPool(commandPool);
+      destroyBuffer(buffer);
+      destroyDescriptorSetLayout(descriptorSetLayout);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "exqudens/TestUtils.hpp"
+#include "exqudens/vulkan/FactoryBase.hpp"
+
+namespace exqudens::vulkan {
+
+  // tests adjust 'configuration' and call 'setUpDevice', everything created here is destroyed in 'TearDown'
+  template<typename Factory>
+  class BasicDeviceTestsBase : public testing::Test, protected Factory {
+
+    protected:
+
+      Configuration configuration = {};
+      std::ostringstream stream;
+      Logger logger = {};
+      Instance instance = {};
+      DebugUtilsMessenger debugUtilsMessenger = {};
+      Surface surface = {};
+      PhysicalDevice physicalDevice = {};
+      Device device = {};
+
+      void SetUp() override {
+        try {
+          std::map<std::string, std::string> environmentVariables = this->createEnvironmentVariables(TestUtils::getExecutableDir());
+
+          for (auto const& [name, value] : environmentVariables) {
+            this->setEnvironmentVariable(name, value);
+          }
+
+          configuration = this->createConfiguration();
+          configuration.presentQueueFamilyRequired = false;
+          configuration.deviceExtensions = {};
+          logger = this->createLogger(stream);
+        } catch (const std::exception& e) {
+          FAIL() << TestUtils::toString(e);
+        }
+      }
+
+      // false when no physical device has all of 'configuration.deviceExtensions', the test skips then
+      bool setUpDevice() {
+        try {
+          instance = this->createInstance(configuration, logger);
+          debugUtilsMessenger = this->createDebugUtilsMessenger(instance.value, logger);
+
+          if (configuration.presentQueueFamilyRequired) {
+            surface = this->createSurface(instance.value);
+          }
+
+          uint32_t deviceCount = 0;
+          this->functions().enumeratePhysicalDevices(instance.value, &deviceCount, nullptr);
+          std::vector<VkPhysicalDevice> devices(deviceCount);
+          this->functions().enumeratePhysicalDevices(instance.value, &deviceCount, devices.data());
+
+          bool extensionsSupported = false;
+          for (VkPhysicalDevice& object : devices) {
+            extensionsSupported = extensionsSupported || this->checkDeviceExtensionSupport(object, configuration.deviceExtensions);
+          }
+
+          if (!extensionsSupported) {
+            return false;
+          }
+
+          physicalDevice = this->createPhysicalDevice(instance.value, configuration, surface.value);
+          device = this->createDevice(physicalDevice.value, configuration, physicalDevice.queueFamilyIndexInfo);
+
+          return true;
+        } catch (...) {
+          std::throw_with_nested(std::runtime_error(CALL_INFO()));
+        }
+      }
+
+      void TearDown() override {
+        try {
+          this->destroyDevice(device);
+          this->destroyPhysicalDevice(physicalDevice);
+          this->destroySurface(surface);
+          this->destroyDebugUtilsMessenger(debugUtilsMessenger);
+          this->destroyInstance(instance);
+        } catch (const std::exception& e) {
+          FAIL() << TestUtils::toString(e);
+        }
+      }
+
+  };
+
+  using DeviceTestsBase = BasicDeviceTestsBase<FactoryBase>;
+
+}
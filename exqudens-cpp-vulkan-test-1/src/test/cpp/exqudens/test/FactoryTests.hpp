@@ -154,6 +154,17 @@ namespace exqudens::vulkan {
 
       vkCmdBindPipeline(graphicsCommandBuffer.value, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline.value);
 
+      VkViewport viewport = {
+          .x = 0.0f,
+          .y = 0.0f,
+          .width = static_cast<float>(renderPassInfo.renderArea.extent.width),
+          .height = static_cast<float>(renderPassInfo.renderArea.extent.height),
+          .minDepth = 0.0f,
+          .maxDepth = 1.0f
+      };
+      vkCmdSetViewport(graphicsCommandBuffer.value, 0, 1, &viewport);
+      vkCmdSetScissor(graphicsCommandBuffer.value, 0, 1, &renderPassInfo.renderArea);
+
       vkCmdDraw(graphicsCommandBuffer.value, 3, 1, 0, 0);
 
       vkCmdEndRenderPass(graphicsCommandBuffer.value);
@@ -357,4 +368,56 @@ namespace exqudens::vulkan {
     }
   }
 
+  TEST_F(FactoryTests, test2) {
+    try {
+      std::map<std::string, std::string> environmentVariables = createEnvironmentVariables(TestUtils::getExecutableDir());
+
+      for (auto const& [name, value] : environmentVariables) {
+        setEnvironmentVariable(name, value);
+      }
+
+      Configuration configuration = createConfiguration();
+      configuration.presentQueueFamilyRequired = false;
+      configuration.deviceExtensions = {};
+      std::ostringstream stream;
+      Logger logger = createLogger(stream);
+
+      Instance instance = createInstance(configuration, logger);
+      DebugUtilsMessenger debugUtilsMessenger = createDebugUtilsMessenger(instance.value, logger);
+      PhysicalDevice physicalDevice = createPhysicalDevice(instance.value, configuration);
+      Device device = createDevice(physicalDevice.value, configuration, physicalDevice.queueFamilyIndexInfo);
+      Image image = createImage(physicalDevice.value, device.value, 4, 4, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_SAMPLED_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+      Sampler sampler1 = createSampler(physicalDevice.value, device.value, false);
+      Sampler sampler2 = createSampler(physicalDevice.value, device.value, false);
+      ImageView imageView1 = createImageView(device.value, image.value, image.format);
+      ImageView imageView2 = createImageView(device.value, image.value, image.format);
+
+      ASSERT_EQ(sampler1.value, sampler2.value);
+      ASSERT_EQ(imageView1.value, imageView2.value);
+
+      destroySampler(sampler1);
+      destroyImageView(imageView1);
+
+      Sampler sampler3 = createSampler(physicalDevice.value, device.value, false);
+      ImageView imageView3 = createImageView(device.value, image.value, image.format);
+
+      ASSERT_EQ(sampler2.value, sampler3.value);
+      ASSERT_EQ(imageView2.value, imageView3.value);
+
+      destroySampler(sampler3);
+      destroySampler(sampler2);
+      destroyImageView(imageView3);
+      destroyImageView(imageView2);
+      destroyImage(image);
+
+      destroyDevice(device);
+      destroyPhysicalDevice(physicalDevice);
+      destroyDebugUtilsMessenger(debugUtilsMessenger);
+      destroyInstance(instance);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
 }
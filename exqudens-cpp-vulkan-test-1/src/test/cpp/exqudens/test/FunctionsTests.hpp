@@ -0,0 +1,811 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "exqudens/TestUtils.hpp"
+#include "exqudens/test/DeviceTestsBase.hpp"
+#include "exqudens/vulkan/DirectDispatch.hpp"
+#include "exqudens/vulkan/FunctionsProfilerBase.hpp"
+#include "exqudens/vulkan/FunctionsRecorderBase.hpp"
+
+namespace exqudens::vulkan {
+
+  class FunctionsTests : public DeviceTestsBase {
+
+    protected:
+
+      std::atomic<std::size_t> createFunctionsCount = 0;
+      std::size_t dispatchCount = 0;
+
+      Functions createFunctions() override {
+        createFunctionsCount++;
+        Functions value = FactoryBase::createFunctions();
+        value.cmdDispatch = [this](VkCommandBuffer, uint32_t, uint32_t, uint32_t) {
+          dispatchCount++;
+        };
+        return value;
+      }
+
+  };
+
+  class DirectFunctionsTests : public BasicDeviceTestsBase<BasicFactoryBase<DirectDispatch>> {
+  };
+
+  TEST_F(FunctionsTests, test1) {
+    try {
+      const std::size_t CALL_COUNT = 1000;
+      const std::size_t THREAD_COUNT = 8;
+
+      // the first use comes from several threads at once
+      std::vector<std::thread> threads;
+      std::vector<const Functions*> tables(THREAD_COUNT, nullptr);
+      for (std::size_t i = 0; i < THREAD_COUNT; i++) {
+        threads.emplace_back([this, &tables, i]() {
+          tables[i] = &functions();
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+
+      ASSERT_EQ(1, createFunctionsCount.load());
+      for (const Functions* table : tables) {
+        ASSERT_EQ(&functions(), table);
+      }
+
+      for (std::size_t i = 0; i < CALL_COUNT; i++) {
+        functions().cmdDispatch(nullptr, 1, 1, 1);
+      }
+
+      ASSERT_EQ(CALL_COUNT, dispatchCount);
+      ASSERT_EQ(1, createFunctionsCount.load());
+
+      // a reset table is built once more on the next call
+      resetFunctions();
+      functions();
+
+      ASSERT_EQ(2, createFunctionsCount.load());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  // per call cost of the table built by value, as functions() did before it returned a reference, against the cached one,
+  // timing dependent so it only runs with '--gtest_also_run_disabled_tests'
+  TEST_F(FunctionsTests, DISABLED_test1) {
+    try {
+      const std::size_t CALL_COUNT = 100000;
+
+      functions();
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      for (std::size_t i = 0; i < CALL_COUNT; i++) {
+        createFunctions().cmdDispatch(nullptr, 1, 1, 1);
+      }
+      std::chrono::nanoseconds byValue = std::chrono::steady_clock::now() - start;
+
+      start = std::chrono::steady_clock::now();
+      for (std::size_t i = 0; i < CALL_COUNT; i++) {
+        functions().cmdDispatch(nullptr, 1, 1, 1);
+      }
+      std::chrono::nanoseconds byReference = std::chrono::steady_clock::now() - start;
+
+      RecordProperty("FunctionsTests.DISABLED_test1.byValue", std::to_string(byValue.count() / CALL_COUNT) + "ns");
+      RecordProperty("FunctionsTests.DISABLED_test1.byReference", std::to_string(byReference.count() / CALL_COUNT) + "ns");
+      std::cout << "functions() per call by value: " << byValue.count() / CALL_COUNT << "ns";
+      std::cout << " by reference: " << byReference.count() / CALL_COUNT << "ns" << std::endl;
+
+      ASSERT_EQ(CALL_COUNT * 2, dispatchCount);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(FunctionsTests, test2) {
+    try {
+      ASSERT_TRUE(setUpDevice());
+
+      ASSERT_NE(nullptr, instance.functions.enumeratePhysicalDevices);
+      ASSERT_NE(nullptr, instance.functions.createDevice);
+      ASSERT_NE(nullptr, device.functions.createBuffer);
+      ASSERT_NE(nullptr, device.functions.cmdCopyBuffer);
+      ASSERT_NE(nullptr, device.functions.cmdDispatch);
+      ASSERT_NE(nullptr, device.functions.destroyDevice);
+
+      // no swap chain extension requested, so the device does not expose its entry points
+      ASSERT_EQ(nullptr, device.functions.createSwapchainKHR);
+
+      uint32_t familyIndex = physicalDevice.queueFamilyIndexInfo.graphicsFamily.value();
+      VkQueue loaderQueue = nullptr;
+      VkQueue deviceQueue = nullptr;
+      functions().getDeviceQueue(device.value, familyIndex, 0, &loaderQueue);
+      device.functions.getDeviceQueue(device.value, familyIndex, 0, &deviceQueue);
+
+      ASSERT_NE(nullptr, deviceQueue);
+      ASSERT_EQ(loaderQueue, deviceQueue);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(DirectFunctionsTests, test1) {
+    try {
+      ASSERT_TRUE(setUpDevice());
+
+      Buffer buffer = createBuffer(
+          physicalDevice.value,
+          device.value,
+          256,
+          VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+      );
+
+      ASSERT_NE(nullptr, buffer.value);
+      ASSERT_NE(nullptr, buffer.memory);
+
+      destroyBuffer(buffer);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(FunctionsTests, test4) {
+    try {
+      class ProfiledFactory: public FactoryBase, public FunctionsProfilerBase {
+
+        protected:
+
+          Functions createFunctions() override {
+            Functions value = FactoryBase::createFunctions();
+            value.cmdDispatch = [](VkCommandBuffer, uint32_t, uint32_t, uint32_t) {
+              std::this_thread::sleep_for(std::chrono::microseconds(10));
+            };
+            return value;
+          }
+
+      };
+
+      const std::size_t CALL_COUNT = 100;
+
+      const std::size_t THREAD_COUNT = 4;
+
+      ProfiledFactory factory;
+
+      // counters are shared by every thread that calls through the table
+      std::vector<std::thread> threads;
+      for (std::size_t i = 0; i < THREAD_COUNT; i++) {
+        threads.emplace_back([&factory]() {
+          for (std::size_t j = 0; j < CALL_COUNT / THREAD_COUNT; j++) {
+            factory.functions().cmdDispatch(nullptr, 1, 1, 1);
+          }
+        });
+      }
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+
+      std::vector<FunctionProfile> profiles = factory.getFunctionProfiles();
+
+      ASSERT_EQ(1, profiles.size());
+      ASSERT_EQ("vkCmdDispatch", profiles.front().name);
+      ASSERT_EQ(CALL_COUNT, profiles.front().count);
+      ASSERT_GE(profiles.front().totalTime, std::chrono::microseconds(10) * CALL_COUNT);
+      ASSERT_GE(profiles.front().minTime, std::chrono::microseconds(10));
+      ASSERT_GE(profiles.front().maxTime, profiles.front().minTime);
+      ASSERT_EQ(CALL_COUNT, std::accumulate(profiles.front().histogram.begin(), profiles.front().histogram.end(), std::size_t(0)));
+
+      const FunctionProfile& profile = profiles.front();
+      std::ostringstream stream;
+      factory.writeFunctionProfiles(stream);
+      std::string json = stream.str();
+
+      ASSERT_EQ(0, json.find("{\n  \"functions\": [\n    {\"name\": \"vkCmdDispatch\", \"count\": " + std::to_string(CALL_COUNT) + ", "));
+      ASSERT_NE(std::string::npos, json.find("\"totalTimeNs\": " + std::to_string(profile.totalTime.count()) + ", "));
+      ASSERT_NE(std::string::npos, json.find("\"minTimeNs\": " + std::to_string(profile.minTime.count()) + ", "));
+      ASSERT_NE(std::string::npos, json.find("\"maxTimeNs\": " + std::to_string(profile.maxTime.count()) + ", "));
+      // only the filled buckets are written, the last one has no upper bound
+      std::size_t bucketCount = 0;
+      for (std::size_t i = 0; i < profile.histogram.size(); i++) {
+        if (profile.histogram[i] == 0) {
+          continue;
+        }
+        std::string upperBound = i + 1 < profile.histogram.size() ? std::to_string(1ull << i) : "null";
+        ASSERT_NE(std::string::npos, json.find("{\"upperBoundNs\": " + upperBound + ", \"count\": " + std::to_string(profile.histogram[i]) + "}"));
+        bucketCount++;
+      }
+      ASSERT_GT(bucketCount, 0);
+      ASSERT_EQ(bucketCount, static_cast<std::size_t>(std::count(json.begin(), json.end(), '{')) - 2);
+      ASSERT_TRUE(json.ends_with("}]}\n  ]\n}\n"));
+
+      factory.resetFunctionProfiles();
+
+      ASSERT_TRUE(factory.getFunctionProfiles().empty());
+
+      stream.str("");
+      factory.writeFunctionProfiles(stream);
+
+      ASSERT_EQ("{\n  \"functions\": []\n}\n", stream.str());
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(FunctionsTests, test5) {
+    try {
+      class RecordedFactory: public FactoryBase, public FunctionsRecorderBase {
+
+        protected:
+
+          Functions createFunctions() override {
+            Functions value = FactoryBase::createFunctions();
+            value.createBuffer = [this](VkDevice, const VkBufferCreateInfo*, const VkAllocationCallbacks*, VkBuffer* pBuffer) {
+              *pBuffer = reinterpret_cast<VkBuffer>(static_cast<uintptr_t>(0x100 + createdCount++));
+              return VK_SUCCESS;
+            };
+            value.cmdCopyBuffer = [](VkCommandBuffer, VkBuffer, VkBuffer, uint32_t, const VkBufferCopy*) {};
+            return value;
+          }
+
+        private:
+
+          std::size_t createdCount = 0;
+
+      };
+
+      RecordedFactory factory;
+
+      VkDevice device = reinterpret_cast<VkDevice>(static_cast<uintptr_t>(0x1));
+      VkCommandBuffer commandBuffer = reinterpret_cast<VkCommandBuffer>(static_cast<uintptr_t>(0x2));
+      VkBufferCreateInfo createInfo = {};
+      createInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+      createInfo.size = 64;
+      std::vector<VkBufferCopy> regions = {{.srcOffset = 0, .dstOffset = 0, .size = 16}, {.srcOffset = 16, .dstOffset = 32, .size = 8}};
+
+      factory.functions().cmdCopyBuffer(commandBuffer, nullptr, nullptr, 0, nullptr);
+
+      factory.startRecording();
+      VkBuffer source = nullptr;
+      VkBuffer destination = nullptr;
+      factory.functions().createBuffer(device, &createInfo, nullptr, &source);
+      factory.functions().createBuffer(device, &createInfo, nullptr, &destination);
+      factory.functions().cmdCopyBuffer(commandBuffer, source, destination, static_cast<uint32_t>(regions.size()), regions.data());
+      std::vector<FunctionCall> calls = factory.stopRecording();
+
+      ASSERT_EQ(3, calls.size());
+      ASSERT_EQ("vkCreateBuffer", calls.at(0).name);
+      ASSERT_EQ("vkCmdCopyBuffer", calls.at(2).name);
+
+      std::stringstream stream;
+      factory.writeFunctionCalls(stream, calls);
+      std::vector<FunctionCall> readCalls = factory.readFunctionCalls(stream);
+
+      ASSERT_EQ(calls.size(), readCalls.size());
+      for (std::size_t i = 0; i < calls.size(); i++) {
+        ASSERT_EQ(calls.at(i).name, readCalls.at(i).name);
+        ASSERT_EQ(calls.at(i).start, readCalls.at(i).start);
+        ASSERT_EQ(calls.at(i).arguments, readCalls.at(i).arguments);
+        ASSERT_EQ(calls.at(i).results, readCalls.at(i).results);
+      }
+
+      std::vector<std::string> replayedNames;
+      std::vector<VkBuffer> replayedBuffers;
+      std::vector<VkBufferCopy> replayedRegions;
+      Functions mock = {};
+      mock.createBuffer = [&](VkDevice, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkBuffer* pBuffer) {
+        replayedNames.emplace_back("vkCreateBuffer:" + std::to_string(pCreateInfo->size));
+        *pBuffer = reinterpret_cast<VkBuffer>(static_cast<uintptr_t>(0x900 + replayedBuffers.size()));
+        replayedBuffers.emplace_back(*pBuffer);
+        return VK_SUCCESS;
+      };
+      mock.cmdCopyBuffer = [&](VkCommandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy* pRegions) {
+        replayedNames.emplace_back("vkCmdCopyBuffer");
+        replayedBuffers.emplace_back(srcBuffer);
+        replayedBuffers.emplace_back(dstBuffer);
+        replayedRegions.assign(pRegions, pRegions + regionCount);
+      };
+
+      std::vector<FunctionCall> replayedCalls = factory.replayFunctionCalls(readCalls, mock);
+
+      ASSERT_EQ(calls.size(), replayedCalls.size());
+      ASSERT_EQ(std::vector<std::string>({"vkCreateBuffer:64", "vkCreateBuffer:64", "vkCmdCopyBuffer"}), replayedNames);
+      ASSERT_EQ(4, replayedBuffers.size());
+      ASSERT_EQ(replayedBuffers.at(0), replayedBuffers.at(2));
+      ASSERT_EQ(replayedBuffers.at(1), replayedBuffers.at(3));
+      ASSERT_EQ(regions.size(), replayedRegions.size());
+      ASSERT_EQ(32, replayedRegions.at(1).dstOffset);
+      ASSERT_EQ(8, replayedRegions.at(1).size);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(FunctionsTests, test6) {
+    try {
+      // create infos, descriptor writes and template data carry handles that the replay has to remap
+      class RecordedFactory: public FactoryBase, public FunctionsRecorderBase {
+
+        protected:
+
+          Functions createFunctions() override {
+            Functions value = FactoryBase::createFunctions();
+            value.createImage = [](VkDevice, const VkImageCreateInfo*, const VkAllocationCallbacks*, VkImage* pImage) {
+              *pImage = reinterpret_cast<VkImage>(static_cast<uintptr_t>(0x100));
+              return VK_SUCCESS;
+            };
+            value.createImageView = [](VkDevice, const VkImageViewCreateInfo*, const VkAllocationCallbacks*, VkImageView* pView) {
+              *pView = reinterpret_cast<VkImageView>(static_cast<uintptr_t>(0x200));
+              return VK_SUCCESS;
+            };
+            value.createDescriptorUpdateTemplate = [](VkDevice, const VkDescriptorUpdateTemplateCreateInfo*, const VkAllocationCallbacks*, VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
+              *pDescriptorUpdateTemplate = reinterpret_cast<VkDescriptorUpdateTemplate>(static_cast<uintptr_t>(0x300));
+              return VK_SUCCESS;
+            };
+            value.updateDescriptorSets = [](VkDevice, uint32_t, const VkWriteDescriptorSet*, uint32_t, const VkCopyDescriptorSet*) {};
+            value.updateDescriptorSetWithTemplate = [](VkDevice, VkDescriptorSet, VkDescriptorUpdateTemplate, const void*) {};
+            value.createBuffer = [](VkDevice, const VkBufferCreateInfo*, const VkAllocationCallbacks*, VkBuffer* pBuffer) {
+              *pBuffer = reinterpret_cast<VkBuffer>(static_cast<uintptr_t>(0x400));
+              return VK_SUCCESS;
+            };
+            return value;
+          }
+
+      };
+
+      RecordedFactory factory;
+
+      VkDevice device = reinterpret_cast<VkDevice>(static_cast<uintptr_t>(0x1));
+      VkDescriptorSet descriptorSet = reinterpret_cast<VkDescriptorSet>(static_cast<uintptr_t>(0x2));
+      VkSampler sampler = reinterpret_cast<VkSampler>(static_cast<uintptr_t>(0x3));
+      std::vector<uint32_t> queueFamilyIndices = {0, 1};
+
+      VkImageCreateInfo imageCreateInfo = {};
+      imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+      imageCreateInfo.sharingMode = VK_SHARING_MODE_CONCURRENT;
+      imageCreateInfo.queueFamilyIndexCount = static_cast<uint32_t>(queueFamilyIndices.size());
+      imageCreateInfo.pQueueFamilyIndices = queueFamilyIndices.data();
+      VkDescriptorUpdateTemplateEntry entry = {};
+      entry.descriptorCount = 1;
+      entry.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+      entry.offset = 0;
+      entry.stride = sizeof(VkDescriptorImageInfo);
+      VkDescriptorUpdateTemplateCreateInfo templateCreateInfo = {};
+      templateCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+      templateCreateInfo.descriptorUpdateEntryCount = 1;
+      templateCreateInfo.pDescriptorUpdateEntries = &entry;
+
+      factory.startRecording();
+      VkImage image = nullptr;
+      factory.functions().createImage(device, &imageCreateInfo, nullptr, &image);
+      VkImageViewCreateInfo viewCreateInfo = {};
+      viewCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+      viewCreateInfo.image = image;
+      VkImageView imageView = nullptr;
+      factory.functions().createImageView(device, &viewCreateInfo, nullptr, &imageView);
+      VkDescriptorUpdateTemplate descriptorUpdateTemplate = nullptr;
+      factory.functions().createDescriptorUpdateTemplate(device, &templateCreateInfo, nullptr, &descriptorUpdateTemplate);
+      VkDescriptorImageInfo imageInfo = {.sampler = sampler, .imageView = imageView, .imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+      VkWriteDescriptorSet write = {};
+      write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+      write.dstSet = descriptorSet;
+      write.descriptorCount = 1;
+      write.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+      write.pImageInfo = &imageInfo;
+      factory.functions().updateDescriptorSets(device, 1, &write, 0, nullptr);
+      factory.functions().updateDescriptorSetWithTemplate(device, descriptorSet, descriptorUpdateTemplate, &imageInfo);
+      std::vector<FunctionCall> calls = factory.stopRecording();
+
+      ASSERT_EQ(5, calls.size());
+
+      std::stringstream stream;
+      factory.writeFunctionCalls(stream, calls);
+      std::vector<FunctionCall> readCalls = factory.readFunctionCalls(stream);
+
+      std::vector<uint32_t> replayedQueueFamilyIndices;
+      VkImage replayedImage = nullptr;
+      VkImage replayedViewImage = nullptr;
+      std::vector<VkDescriptorImageInfo> replayedImageInfos;
+      VkDescriptorUpdateTemplate replayedTemplate = nullptr;
+      Functions mock = {};
+      mock.createImage = [&](VkDevice, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkImage* pImage) {
+        replayedQueueFamilyIndices.assign(pCreateInfo->pQueueFamilyIndices, pCreateInfo->pQueueFamilyIndices + pCreateInfo->queueFamilyIndexCount);
+        replayedImage = *pImage = reinterpret_cast<VkImage>(static_cast<uintptr_t>(0x900));
+        return VK_SUCCESS;
+      };
+      mock.createImageView = [&](VkDevice, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkImageView* pView) {
+        replayedViewImage = pCreateInfo->image;
+        *pView = reinterpret_cast<VkImageView>(static_cast<uintptr_t>(0xA00));
+        return VK_SUCCESS;
+      };
+      mock.createDescriptorUpdateTemplate = [&](VkDevice, const VkDescriptorUpdateTemplateCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
+        replayedTemplate = *pDescriptorUpdateTemplate = reinterpret_cast<VkDescriptorUpdateTemplate>(static_cast<uintptr_t>(0xB00 + pCreateInfo->pDescriptorUpdateEntries[0].stride));
+        return VK_SUCCESS;
+      };
+      mock.updateDescriptorSets = [&](VkDevice, uint32_t descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, uint32_t, const VkCopyDescriptorSet*) {
+        for (uint32_t i = 0; i < descriptorWriteCount; i++) {
+          replayedImageInfos.emplace_back(pDescriptorWrites[i].pImageInfo[0]);
+        }
+      };
+      mock.updateDescriptorSetWithTemplate = [&](VkDevice, VkDescriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void* pData) {
+        ASSERT_EQ(replayedTemplate, descriptorUpdateTemplate);
+        replayedImageInfos.emplace_back(*static_cast<const VkDescriptorImageInfo*>(pData));
+      };
+
+      std::vector<FunctionCall> replayedCalls = factory.replayFunctionCalls(readCalls, mock);
+
+      ASSERT_EQ(calls.size(), replayedCalls.size());
+      ASSERT_EQ(queueFamilyIndices, replayedQueueFamilyIndices);
+      ASSERT_EQ(replayedImage, replayedViewImage);
+      ASSERT_EQ(reinterpret_cast<VkDescriptorUpdateTemplate>(static_cast<uintptr_t>(0xB00 + sizeof(VkDescriptorImageInfo))), replayedTemplate);
+      ASSERT_EQ(2, replayedImageInfos.size());
+      for (const VkDescriptorImageInfo& replayedImageInfo : replayedImageInfos) {
+        ASSERT_EQ(sampler, replayedImageInfo.sampler);
+        ASSERT_EQ(reinterpret_cast<VkImageView>(static_cast<uintptr_t>(0xA00)), replayedImageInfo.imageView);
+        ASSERT_EQ(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, replayedImageInfo.imageLayout);
+      }
+
+      // chain entries of types that are not captured are refused by the replay instead of dropped
+      VkExternalMemoryBufferCreateInfo externalCreateInfo = {};
+      externalCreateInfo.sType = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+      VkBufferCreateInfo bufferCreateInfo = {};
+      bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+      bufferCreateInfo.pNext = &externalCreateInfo;
+      bufferCreateInfo.size = 64;
+      factory.startRecording();
+      VkBuffer buffer = nullptr;
+      factory.functions().createBuffer(device, &bufferCreateInfo, nullptr, &buffer);
+      calls = factory.stopRecording();
+      mock.createBuffer = [](VkDevice, const VkBufferCreateInfo*, const VkAllocationCallbacks*, VkBuffer*) {
+        return VK_SUCCESS;
+      };
+
+      ASSERT_EQ(1, calls.size());
+      ASSERT_THROW(factory.replayFunctionCalls(calls, mock), std::runtime_error);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+
+  TEST_F(FunctionsTests, test7) {
+    try {
+      // every entry logs its arguments with the handles counted from 'base', the handle a call returns is its log position,
+      // a replay logs the same lines only when each handle in the create infos and their chains was remapped
+      auto createMockFunctions = [](std::vector<std::string>& log, uintptr_t base) {
+        auto id = [base](auto handle) {
+          return handle == nullptr ? std::string("null") : std::to_string(reinterpret_cast<uintptr_t>(handle) - base);
+        };
+        Functions value = Functions{};
+        value.enumerateInstanceLayerProperties = [&log](uint32_t* pPropertyCount, VkLayerProperties* pProperties) {
+          log.emplace_back("vkEnumerateInstanceLayerProperties");
+          if (pProperties != nullptr) {
+            pProperties[0] = {};
+            std::string("VK_LAYER_KHRONOS_validation").copy(pProperties[0].layerName, VK_MAX_EXTENSION_NAME_SIZE - 1);
+          }
+          *pPropertyCount = 1;
+        };
+        value.createInstance = [&log, base](const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkInstance* pInstance) {
+          std::string entry = "vkCreateInstance:" + std::string(pCreateInfo->pApplicationInfo->pApplicationName) + ":" + pCreateInfo->pApplicationInfo->pEngineName;
+          for (uint32_t i = 0; i < pCreateInfo->enabledLayerCount; i++) {
+            entry += ":" + std::string(pCreateInfo->ppEnabledLayerNames[i]);
+          }
+          for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; i++) {
+            entry += ":" + std::string(pCreateInfo->ppEnabledExtensionNames[i]);
+          }
+          log.emplace_back(entry);
+          *pInstance = reinterpret_cast<VkInstance>(static_cast<uintptr_t>(base + log.size()));
+          return VK_SUCCESS;
+        };
+        value.getInstanceProcAddr = [&log, id](VkInstance instance, const char* pName) -> PFN_vkVoidFunction {
+          log.emplace_back("vkGetInstanceProcAddr:" + id(instance) + ":" + pName);
+          return nullptr;
+        };
+        value.createSurfaceKHR = [&log, base, id](VkInstance instance) {
+          log.emplace_back("vkCreateSurfaceKHR:" + id(instance));
+          return reinterpret_cast<VkSurfaceKHR>(static_cast<uintptr_t>(base + log.size()));
+        };
+        value.enumeratePhysicalDevices = [&log, base, id](VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) {
+          log.emplace_back("vkEnumeratePhysicalDevices:" + id(instance));
+          if (pPhysicalDevices != nullptr) {
+            pPhysicalDevices[0] = reinterpret_cast<VkPhysicalDevice>(static_cast<uintptr_t>(base + log.size()));
+          }
+          *pPhysicalDeviceCount = 1;
+        };
+        value.getPhysicalDeviceQueueFamilyProperties = [&log, id](VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) {
+          log.emplace_back("vkGetPhysicalDeviceQueueFamilyProperties:" + id(physicalDevice));
+          if (pQueueFamilyProperties != nullptr) {
+            pQueueFamilyProperties[0] = {};
+            pQueueFamilyProperties[0].queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+            pQueueFamilyProperties[0].queueCount = 1;
+          }
+          *pQueueFamilyPropertyCount = 1;
+        };
+        value.getPhysicalDeviceSurfaceSupportKHR = [&log, id](VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported) {
+          log.emplace_back("vkGetPhysicalDeviceSurfaceSupportKHR:" + id(physicalDevice) + ":" + std::to_string(queueFamilyIndex) + ":" + id(surface));
+          *pSupported = VK_TRUE;
+        };
+        value.enumerateDeviceExtensionProperties = [&log, id](VkPhysicalDevice physicalDevice, const char*, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) {
+          std::vector<std::string> names = {VK_KHR_SWAPCHAIN_EXTENSION_NAME, VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME};
+          log.emplace_back("vkEnumerateDeviceExtensionProperties:" + id(physicalDevice));
+          if (pProperties != nullptr) {
+            for (std::size_t i = 0; i < names.size(); i++) {
+              pProperties[i] = {};
+              names[i].copy(pProperties[i].extensionName, VK_MAX_EXTENSION_NAME_SIZE - 1);
+            }
+          }
+          *pPropertyCount = static_cast<uint32_t>(names.size());
+        };
+        value.getPhysicalDeviceSurfaceCapabilitiesKHR = [&log, id](VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) {
+          log.emplace_back("vkGetPhysicalDeviceSurfaceCapabilitiesKHR:" + id(physicalDevice) + ":" + id(surface));
+          *pSurfaceCapabilities = {};
+          pSurfaceCapabilities->minImageCount = 2;
+          pSurfaceCapabilities->maxImageCount = 3;
+          // the extent follows the size the swap chain is created with
+          pSurfaceCapabilities->currentExtent = {UINT32_MAX, UINT32_MAX};
+          pSurfaceCapabilities->minImageExtent = {1, 1};
+          pSurfaceCapabilities->maxImageExtent = {4096, 4096};
+          pSurfaceCapabilities->maxImageArrayLayers = 1;
+          pSurfaceCapabilities->currentTransform = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+        };
+        value.getPhysicalDeviceSurfaceFormatsKHR = [&log, id](VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats) {
+          log.emplace_back("vkGetPhysicalDeviceSurfaceFormatsKHR:" + id(physicalDevice) + ":" + id(surface));
+          if (pSurfaceFormats != nullptr) {
+            pSurfaceFormats[0] = {.format = VK_FORMAT_B8G8R8A8_SRGB, .colorSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR};
+          }
+          *pSurfaceFormatCount = 1;
+        };
+        value.getPhysicalDeviceSurfacePresentModesKHR = [&log, id](VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes) {
+          log.emplace_back("vkGetPhysicalDeviceSurfacePresentModesKHR:" + id(physicalDevice) + ":" + id(surface));
+          if (pPresentModes != nullptr) {
+            pPresentModes[0] = VK_PRESENT_MODE_FIFO_KHR;
+          }
+          *pPresentModeCount = 1;
+        };
+        value.getPhysicalDeviceFeatures = [&log, id](VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures) {
+          log.emplace_back("vkGetPhysicalDeviceFeatures:" + id(physicalDevice));
+          *pFeatures = {};
+          pFeatures->samplerAnisotropy = VK_TRUE;
+        };
+        value.getPhysicalDeviceFeatures2 = [&log, id](VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2* pFeatures) {
+          std::string entry = "vkGetPhysicalDeviceFeatures2:" + id(physicalDevice);
+          for (VkBaseOutStructure* next = static_cast<VkBaseOutStructure*>(pFeatures->pNext); next != nullptr; next = next->pNext) {
+            entry += ":" + std::to_string(next->sType);
+            if (next->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES) {
+              VkPhysicalDeviceDescriptorIndexingFeatures* features = reinterpret_cast<VkPhysicalDeviceDescriptorIndexingFeatures*>(next);
+              features->shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+              features->descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+              features->descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+              features->descriptorBindingPartiallyBound = VK_TRUE;
+              features->runtimeDescriptorArray = VK_TRUE;
+            }
+          }
+          log.emplace_back(entry);
+        };
+        value.createDevice = [&log, base, id](VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkDevice* pDevice) {
+          std::string entry = "vkCreateDevice:" + id(physicalDevice);
+          for (uint32_t i = 0; i < pCreateInfo->queueCreateInfoCount; i++) {
+            entry += ":" + std::to_string(pCreateInfo->pQueueCreateInfos[i].queueFamilyIndex) + "=" + std::to_string(pCreateInfo->pQueueCreateInfos[i].pQueuePriorities[0]);
+          }
+          for (uint32_t i = 0; i < pCreateInfo->enabledExtensionCount; i++) {
+            entry += ":" + std::string(pCreateInfo->ppEnabledExtensionNames[i]);
+          }
+          entry += ":" + std::to_string(pCreateInfo->pEnabledFeatures->samplerAnisotropy);
+          for (const VkBaseInStructure* next = static_cast<const VkBaseInStructure*>(pCreateInfo->pNext); next != nullptr; next = next->pNext) {
+            entry += ":" + std::to_string(next->sType);
+            if (next->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES) {
+              entry += "=" + std::to_string(reinterpret_cast<const VkPhysicalDeviceDescriptorIndexingFeatures*>(next)->runtimeDescriptorArray);
+            }
+          }
+          log.emplace_back(entry);
+          *pDevice = reinterpret_cast<VkDevice>(static_cast<uintptr_t>(base + log.size()));
+          return VK_SUCCESS;
+        };
+        value.getDeviceProcAddr = [&log, id](VkDevice device, const char* pName) -> PFN_vkVoidFunction {
+          log.emplace_back("vkGetDeviceProcAddr:" + id(device) + ":" + pName);
+          return nullptr;
+        };
+        value.createSwapchainKHR = [&log, base, id](VkDevice device, const VkSwapchainCreateInfoKHR* pCreateInfo, const VkAllocationCallbacks*, VkSwapchainKHR* pSwapchain) {
+          log.emplace_back(
+              "vkCreateSwapchainKHR:" + id(device) + ":" + id(pCreateInfo->surface) + ":" + std::to_string(pCreateInfo->minImageCount)
+              + ":" + std::to_string(pCreateInfo->imageExtent.width) + "x" + std::to_string(pCreateInfo->imageExtent.height)
+              + ":" + id(pCreateInfo->oldSwapchain)
+          );
+          *pSwapchain = reinterpret_cast<VkSwapchainKHR>(static_cast<uintptr_t>(base + log.size()));
+          return VK_SUCCESS;
+        };
+        value.getSwapchainImagesKHR = [&log, base, id](VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) {
+          log.emplace_back("vkGetSwapchainImagesKHR:" + id(device) + ":" + id(swapchain));
+          if (pSwapchainImages != nullptr) {
+            for (uint32_t i = 0; i < *pSwapchainImageCount; i++) {
+              pSwapchainImages[i] = reinterpret_cast<VkImage>(static_cast<uintptr_t>(base + 0x1000 + log.size() * 8 + i));
+            }
+          }
+          *pSwapchainImageCount = 3;
+          return VK_SUCCESS;
+        };
+        value.createRenderPass = [&log, base, id](VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkRenderPass* pRenderPass) {
+          log.emplace_back(
+              "vkCreateRenderPass:" + id(device) + ":" + std::to_string(pCreateInfo->pAttachments[0].format)
+              + ":" + std::to_string(pCreateInfo->pSubpasses[0].colorAttachmentCount) + "=" + std::to_string(pCreateInfo->pSubpasses[0].pColorAttachments[0].layout)
+              + ":" + std::to_string(pCreateInfo->pDependencies[0].dstAccessMask)
+          );
+          *pRenderPass = reinterpret_cast<VkRenderPass>(static_cast<uintptr_t>(base + log.size()));
+          return VK_SUCCESS;
+        };
+        value.createShaderModule = [&log, base, id](VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkShaderModule* pShaderModule) {
+          log.emplace_back("vkCreateShaderModule:" + id(device) + ":" + std::to_string(pCreateInfo->codeSize) + ":" + std::to_string(pCreateInfo->pCode[1]));
+          *pShaderModule = reinterpret_cast<VkShaderModule>(static_cast<uintptr_t>(base + log.size()));
+          return VK_SUCCESS;
+        };
+        value.createPipelineLayout = [&log, base, id](VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks*, VkPipelineLayout* pPipelineLayout) {
+          log.emplace_back("vkCreatePipelineLayout:" + id(device) + ":" + std::to_string(pCreateInfo->setLayoutCount));
+          *pPipelineLayout = reinterpret_cast<VkPipelineLayout>(static_cast<uintptr_t>(base + log.size()));
+          return VK_SUCCESS;
+        };
+        value.createGraphicsPipelines = [&log, base, id](VkDevice device, VkPipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks*, VkPipeline* pPipelines) {
+          for (uint32_t i = 0; i < createInfoCount; i++) {
+            const VkGraphicsPipelineCreateInfo& createInfo = pCreateInfos[i];
+            std::string entry = "vkCreateGraphicsPipelines:" + id(device) + ":" + std::to_string(createInfo.flags) + ":" + id(createInfo.layout) + ":" + id(createInfo.renderPass);
+            for (uint32_t j = 0; j < createInfo.stageCount; j++) {
+              entry += ":" + std::to_string(createInfo.pStages[j].stage) + "=" + id(createInfo.pStages[j].module) + "/" + createInfo.pStages[j].pName;
+            }
+            if (createInfo.pViewportState != nullptr && createInfo.pViewportState->pViewports != nullptr) {
+              entry += ":" + std::to_string(createInfo.pViewportState->pViewports[0].width) + "x" + std::to_string(createInfo.pViewportState->pViewports[0].height);
+            }
+            if (createInfo.pDynamicState != nullptr) {
+              entry += ":" + std::to_string(createInfo.pDynamicState->dynamicStateCount);
+            }
+            for (const VkBaseInStructure* next = static_cast<const VkBaseInStructure*>(createInfo.pNext); next != nullptr; next = next->pNext) {
+              if (next->sType == VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT) {
+                entry += ":part=" + std::to_string(reinterpret_cast<const VkGraphicsPipelineLibraryCreateInfoEXT*>(next)->flags);
+              } else if (next->sType == VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR) {
+                const VkPipelineLibraryCreateInfoKHR* libraryCreateInfo = reinterpret_cast<const VkPipelineLibraryCreateInfoKHR*>(next);
+                for (uint32_t j = 0; j < libraryCreateInfo->libraryCount; j++) {
+                  entry += ":library=" + id(libraryCreateInfo->pLibraries[j]);
+                }
+              }
+            }
+            log.emplace_back(entry);
+            pPipelines[i] = reinterpret_cast<VkPipeline>(static_cast<uintptr_t>(base + log.size()));
+          }
+          return VK_SUCCESS;
+        };
+        value.destroyShaderModule = [&log, id](VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks*) {
+          log.emplace_back("vkDestroyShaderModule:" + id(device) + ":" + id(shaderModule));
+        };
+        value.destroyPipeline = [&log, id](VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks*) {
+          log.emplace_back("vkDestroyPipeline:" + id(device) + ":" + id(pipeline));
+        };
+        value.destroyPipelineLayout = [&log, id](VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks*) {
+          log.emplace_back("vkDestroyPipelineLayout:" + id(device) + ":" + id(pipelineLayout));
+        };
+        value.destroyRenderPass = [&log, id](VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks*) {
+          log.emplace_back("vkDestroyRenderPass:" + id(device) + ":" + id(renderPass));
+        };
+        value.destroySwapchainKHR = [&log, id](VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks*) {
+          log.emplace_back("vkDestroySwapchainKHR:" + id(device) + ":" + id(swapchain));
+        };
+        value.destroyDevice = [&log, id](VkDevice device, const VkAllocationCallbacks*) {
+          log.emplace_back("vkDestroyDevice:" + id(device));
+        };
+        value.destroySurfaceKHR = [&log, id](VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks*) {
+          log.emplace_back("vkDestroySurfaceKHR:" + id(instance) + ":" + id(surface));
+        };
+        value.destroyInstance = [&log, id](VkInstance instance, const VkAllocationCallbacks*) {
+          log.emplace_back("vkDestroyInstance:" + id(instance));
+        };
+        return value;
+      };
+
+      class RecordedFactory: public FactoryBase, public FunctionsRecorderBase {
+
+        public:
+
+          Functions mockFunctions = {};
+
+        protected:
+
+          Functions createFunctions() override {
+            return mockFunctions;
+          }
+
+      };
+
+      std::vector<std::string> recordedLog;
+      RecordedFactory factory;
+      factory.mockFunctions = createMockFunctions(recordedLog, 0x10000);
+
+      // validation chains the debug messenger into the instance create info, the trace leaves it out
+      Configuration mockConfiguration = configuration;
+      mockConfiguration.validationLayersEnabled = true;
+      mockConfiguration.validationLayers = {"VK_LAYER_KHRONOS_validation"};
+      mockConfiguration.extensions = {VK_KHR_SURFACE_EXTENSION_NAME, VK_EXT_DEBUG_UTILS_EXTENSION_NAME};
+      mockConfiguration.deviceExtensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME, VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME};
+      mockConfiguration.presentQueueFamilyRequired = true;
+      std::vector<uint32_t> vertexShader = {0x07230203, 1};
+      std::vector<uint32_t> fragmentShader = {0x07230203, 2};
+      factory.setEmbeddedShaders({{"shader.vert.spv", vertexShader}, {"shader.frag.spv", fragmentShader}});
+      factory.setGraphicsPipelineLibraryEnabled(true, false);
+
+      factory.startRecording();
+      Instance mockInstance = factory.createInstance(mockConfiguration, logger);
+      Surface mockSurface = {
+          .instance = mockInstance.value,
+          .value = factory.functions().createSurfaceKHR(mockInstance.value)
+      };
+      PhysicalDevice mockPhysicalDevice = factory.createPhysicalDevice(mockInstance.value, mockConfiguration, mockSurface.value);
+      Device mockDevice = factory.createDevice(mockPhysicalDevice.value, mockConfiguration, mockPhysicalDevice.queueFamilyIndexInfo);
+      SwapChainSupportDetails swapChainSupport = mockPhysicalDevice.swapChainSupportDetails.value();
+      SwapChain swapChain = factory.createSwapChain(swapChainSupport, mockPhysicalDevice.queueFamilyIndexInfo, mockSurface.value, mockDevice.value, 800, 600);
+      std::vector<Image> swapChainImages = factory.createSwapChainImages(swapChain.device, swapChain.value);
+      RenderPass renderPass = factory.createRenderPass(mockDevice.value, swapChain.format);
+      Pipeline pipeline = factory.createGraphicsPipeline(mockDevice.value, swapChain.extent, {"shader.vert.spv", "shader.frag.spv"}, renderPass.value);
+      swapChainSupport = factory.querySwapChainSupport(mockPhysicalDevice.value, mockSurface.value);
+      swapChain = factory.recreateSwapChain(swapChain, swapChainSupport, mockPhysicalDevice.queueFamilyIndexInfo, mockSurface.value, 1024, 768);
+      swapChainImages = factory.createSwapChainImages(swapChain.device, swapChain.value);
+      factory.destroyPipeline(pipeline);
+      factory.destroyPipelineLibraries();
+      factory.destroyRenderPass(renderPass);
+      factory.destroyRetiredSwapChains();
+      factory.destroySwapChain(swapChain);
+      factory.destroyDevice(mockDevice);
+      factory.destroySurface(mockSurface);
+      factory.destroyInstance(mockInstance);
+      std::vector<FunctionCall> calls = factory.stopRecording();
+
+      ASSERT_EQ(3, swapChainImages.size());
+
+      std::stringstream stream;
+      factory.writeFunctionCalls(stream, calls);
+      std::vector<FunctionCall> readCalls = factory.readFunctionCalls(stream);
+
+      std::vector<std::string> replayedLog;
+      std::vector<FunctionCall> replayedCalls = factory.replayFunctionCalls(readCalls, createMockFunctions(replayedLog, 0x20000));
+
+      ASSERT_EQ(calls.size(), replayedCalls.size());
+      ASSERT_EQ(recordedLog, replayedLog);
+
+      auto startsWith = [](const std::string& prefix) {
+        return [prefix](const std::string& entry) { return entry.starts_with(prefix); };
+      };
+
+      auto createDevice = std::find_if(replayedLog.begin(), replayedLog.end(), startsWith("vkCreateDevice:"));
+      ASSERT_NE(replayedLog.end(), createDevice);
+      ASSERT_TRUE(createDevice->ends_with(
+          ":" + std::to_string(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT)
+          + ":" + std::to_string(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES) + "=1"
+      ));
+
+      // the resize passes the first chain as the old one
+      auto firstSwapChain = std::find_if(replayedLog.begin(), replayedLog.end(), startsWith("vkCreateSwapchainKHR:"));
+      ASSERT_NE(replayedLog.end(), firstSwapChain);
+      auto secondSwapChain = std::find_if(std::next(firstSwapChain), replayedLog.end(), startsWith("vkCreateSwapchainKHR:"));
+      ASSERT_NE(replayedLog.end(), secondSwapChain);
+      ASSERT_TRUE(firstSwapChain->ends_with(":800x600:null"));
+      ASSERT_TRUE(secondSwapChain->ends_with(":1024x768:" + std::to_string(firstSwapChain - replayedLog.begin() + 1)));
+
+      // four library parts and the link
+      ASSERT_EQ(5, std::count_if(replayedLog.begin(), replayedLog.end(), startsWith("vkCreateGraphicsPipelines:")));
+      auto link = std::find_if(replayedLog.rbegin(), replayedLog.rend(), startsWith("vkCreateGraphicsPipelines:"));
+      std::size_t libraries = 0;
+      for (std::size_t i = link->find(":library="); i != std::string::npos; i = link->find(":library=", i + 1)) {
+        libraries++;
+      }
+      ASSERT_EQ(4, libraries);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
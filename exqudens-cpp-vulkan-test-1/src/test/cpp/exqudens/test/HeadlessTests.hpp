@@ -0,0 +1,196 @@
+#pragma once
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "exqudens/TestUtils.hpp"
+#include "exqudens/test/DeviceTestsBase.hpp"
+
+namespace exqudens::vulkan {
+
+  class HeadlessTests : public DeviceTestsBase {
+  };
+
+  TEST_F(HeadlessTests, test1) {
+    try {
+      const std::size_t MAX_FRAMES_IN_FLIGHT = 2;
+      const std::size_t FRAME_COUNT = 64;
+
+      configuration.extensions.emplace_back(VK_KHR_SURFACE_EXTENSION_NAME);
+      configuration.extensions.emplace_back(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME);
+      configuration.deviceExtensions = {VK_KHR_SWAPCHAIN_EXTENSION_NAME};
+      configuration.presentQueueFamilyRequired = true;
+      configuration.anisotropyRequired = false;
+
+      ASSERT_TRUE(setUpDevice());
+
+      Queue graphicsQueue = createQueue(device.value, physicalDevice.queueFamilyIndexInfo.graphicsFamily.value(), 0);
+      Queue presentQueue = createQueue(device.value, physicalDevice.queueFamilyIndexInfo.presentFamily.value(), 0);
+
+      SwapChain swapChain = createSwapChain(
+          physicalDevice.swapChainSupportDetails.value(),
+          physicalDevice.queueFamilyIndexInfo,
+          surface.value,
+          device.value,
+          320,
+          240
+      );
+      std::vector<Image> swapChainImages = createSwapChainImages(device.value, swapChain.value);
+      std::vector<ImageView> swapChainImageViews = createImageViews(device.value, swapChainImages, swapChain.format);
+
+      RenderPass renderPass = createRenderPass(
+          device.value,
+          RenderPassCreateInfo {
+              .attachments = {
+                  VkAttachmentDescription {
+                      .format = swapChain.format,
+                      .samples = VK_SAMPLE_COUNT_1_BIT,
+                      .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+                      .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+                      .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+                      .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                      .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                      .finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+                  }
+              },
+              .subPasses = {
+                  SubPassDescription {
+                      .pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS,
+                      .colorAttachments = {
+                          VkAttachmentReference {
+                              .attachment = 0,
+                              .layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+                          }
+                      }
+                  }
+              },
+              .dependencies = {
+                  VkSubpassDependency {
+                      .srcSubpass = VK_SUBPASS_EXTERNAL,
+                      .dstSubpass = 0,
+                      .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                      .dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                      .srcAccessMask = 0,
+                      .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
+                  }
+              }
+          }
+      );
+
+      std::vector<FrameBufferCreateInfo> frameBufferCreateInfoVector;
+      frameBufferCreateInfoVector.resize(swapChainImageViews.size());
+      for (std::size_t i = 0; i < frameBufferCreateInfoVector.size(); i++) {
+        frameBufferCreateInfoVector[i] = FrameBufferCreateInfo {
+            .flags = 0,
+            .renderPass = renderPass.value,
+            .attachments = {swapChainImageViews[i].value},
+            .width = swapChain.extent.width,
+            .height = swapChain.extent.height,
+            .layers = 1
+        };
+      }
+      std::vector<FrameBuffer> frameBuffers = createFrameBuffers(device.value, frameBufferCreateInfoVector);
+
+      CommandPool commandPool = createCommandPool(device.value, graphicsQueue.familyIndex, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+      std::vector<CommandBuffer> commandBuffers = createCommandBuffers(device.value, commandPool.value, MAX_FRAMES_IN_FLIGHT);
+      std::vector<Semaphore> imageAvailableSemaphores = createSemaphores(device.value, MAX_FRAMES_IN_FLIGHT);
+      std::vector<Semaphore> renderFinishedSemaphores = createSemaphores(device.value, MAX_FRAMES_IN_FLIGHT);
+      std::vector<Fence> inFlightFences = createFences(device.value, VK_FENCE_CREATE_SIGNALED_BIT, MAX_FRAMES_IN_FLIGHT);
+
+      FramePacer framePacer = createFramePacer(configuration.presentPolicy);
+
+      // a failed frame stops the loop, results are checked once everything is torn down
+      VkResult result = VK_SUCCESS;
+      for (std::size_t frame = 0; frame < FRAME_COUNT; frame++) {
+        std::size_t currentFrame = frame % MAX_FRAMES_IN_FLIGHT;
+
+        beginFrame(framePacer);
+
+        vkWaitForFences(device.value, 1, &inFlightFences[currentFrame].value, VK_TRUE, UINT64_MAX);
+        endFrameWait(framePacer);
+
+        uint32_t imageIndex = 0;
+        result = vkAcquireNextImageKHR(device.value, swapChain.value, UINT64_MAX, imageAvailableSemaphores[currentFrame].value, nullptr, &imageIndex);
+        if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
+          break;
+        }
+
+        vkResetFences(device.value, 1, &inFlightFences[currentFrame].value);
+        vkResetCommandBuffer(commandBuffers[currentFrame].value, 0);
+
+        VkCommandBufferBeginInfo beginInfo = { .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        if ((result = vkBeginCommandBuffer(commandBuffers[currentFrame].value, &beginInfo)) != VK_SUCCESS) {
+          break;
+        }
+
+        VkClearValue clearValue = {.color = {0.0f, 0.0f, 0.0f, 1.0f}};
+        VkRenderPassBeginInfo renderPassInfo = {};
+        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+        renderPassInfo.renderPass = renderPass.value;
+        renderPassInfo.framebuffer = frameBuffers[imageIndex].value;
+        renderPassInfo.renderArea.offset = {0, 0};
+        renderPassInfo.renderArea.extent = swapChain.extent;
+        renderPassInfo.clearValueCount = 1;
+        renderPassInfo.pClearValues = &clearValue;
+
+        vkCmdBeginRenderPass(commandBuffers[currentFrame].value, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+        vkCmdEndRenderPass(commandBuffers[currentFrame].value);
+
+        if ((result = vkEndCommandBuffer(commandBuffers[currentFrame].value)) != VK_SUCCESS) {
+          break;
+        }
+
+        VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        VkSubmitInfo submitInfo = {};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.waitSemaphoreCount = 1;
+        submitInfo.pWaitSemaphores = &imageAvailableSemaphores[currentFrame].value;
+        submitInfo.pWaitDstStageMask = &waitStage;
+        submitInfo.commandBufferCount = 1;
+        submitInfo.pCommandBuffers = &commandBuffers[currentFrame].value;
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = &renderFinishedSemaphores[currentFrame].value;
+
+        if ((result = vkQueueSubmit(graphicsQueue.value, 1, &submitInfo, inFlightFences[currentFrame].value)) != VK_SUCCESS) {
+          break;
+        }
+
+        VkPresentInfoKHR presentInfo = {};
+        presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+        presentInfo.waitSemaphoreCount = 1;
+        presentInfo.pWaitSemaphores = &renderFinishedSemaphores[currentFrame].value;
+        presentInfo.swapchainCount = 1;
+        presentInfo.pSwapchains = &swapChain.value;
+        presentInfo.pImageIndices = &imageIndex;
+
+        result = vkQueuePresentKHR(presentQueue.value, &presentInfo);
+        if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
+          break;
+        }
+
+        endFrame(framePacer);
+      }
+
+      vkDeviceWaitIdle(device.value);
+
+      destroyFences(inFlightFences);
+      destroySemaphores(renderFinishedSemaphores);
+      destroySemaphores(imageAvailableSemaphores);
+      destroyCommandBuffers(commandBuffers);
+      destroyCommandPool(commandPool);
+      destroyFrameBuffers(frameBuffers);
+      destroyRenderPass(renderPass);
+      destroyImageViews(swapChainImageViews);
+      destroySwapChain(swapChain);
+      destroyQueue(presentQueue);
+      destroyQueue(graphicsQueue);
+
+      ASSERT_TRUE(result == VK_SUCCESS || result == VK_SUBOPTIMAL_KHR) << "frame " << framePacer.frameCount << " failed with " << result;
+      ASSERT_EQ(FRAME_COUNT, framePacer.frameCount);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+}
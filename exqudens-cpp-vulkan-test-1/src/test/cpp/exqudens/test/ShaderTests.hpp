@@ -1,10 +1,17 @@
 #pragma once
 
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <string>
+#include <vector>
 #include <stdexcept>
 
 #include <gtest/gtest.h>
 
 #include "exqudens/TestUtils.hpp"
+#include "exqudens/test/Shaders.hpp"
 #include "exqudens/vulkan/FactoryBase.hpp"
 
 namespace exqudens::vulkan {
@@ -53,6 +60,108 @@ namespace exqudens::vulkan {
       ASSERT_TRUE(vertexShader2.shaderModule != nullptr);
       ASSERT_TRUE(fragmentShader2.shaderModule != nullptr);
 
+      Shader computeShader = createShader(device.value, "resources/shader/shader-5.comp.spv");
+
+      ASSERT_TRUE(computeShader.shaderModule != nullptr);
+      ASSERT_EQ(computeShader.pipelineShaderStageCreateInfo.stage, VkShaderStageFlagBits::VK_SHADER_STAGE_COMPUTE_BIT);
+
+      destroyShader(computeShader);
+
+      DescriptorSetLayout computeDescriptorSetLayout = createDescriptorSetLayout(
+          device.value,
+          DescriptorSetLayoutCreateInfo {
+              .flags = 0,
+              .bindings = {
+                  VkDescriptorSetLayoutBinding {
+                      .binding = 0,
+                      .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+                      .descriptorCount = 1,
+                      .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+                      .pImmutableSamplers = nullptr
+                  }
+              }
+          }
+      );
+      Pipeline computePipeline = createComputePipeline(
+          device.value,
+          "resources/shader/shader-5.comp.spv",
+          std::vector<VkDescriptorSetLayout> {computeDescriptorSetLayout.value}
+      );
+
+      ASSERT_TRUE(computePipeline.layout != nullptr);
+      ASSERT_TRUE(computePipeline.value != nullptr);
+
+      Pipeline specializedComputePipeline = createComputePipeline(
+          device.value,
+          "resources/shader/shader-5.comp.spv",
+          SpecializationInfo {
+              .constants = {
+                  {0, 128u}
+              }
+          },
+          PipelineLayoutCreateInfo {
+              .flags = 0,
+              .setLayouts = {computeDescriptorSetLayout.value},
+              .pushConstantRanges = {}
+          }
+      );
+
+      ASSERT_TRUE(specializedComputePipeline.value != nullptr);
+      ASSERT_TRUE(specializedComputePipeline.value != computePipeline.value);
+
+      destroyPipeline(specializedComputePipeline);
+      destroyPipeline(computePipeline);
+      destroyDescriptorSetLayout(computeDescriptorSetLayout);
+
+      destroyDevice(device);
+      destroyPhysicalDevice(physicalDevice);
+      destroyDebugUtilsMessenger(debugUtilsMessenger);
+      destroyInstance(instance);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ShaderTests, test2) {
+    try {
+      std::map<std::string, std::string> environmentVariables = createEnvironmentVariables(TestUtils::getExecutableDir());
+
+      for (auto const& [name, value] : environmentVariables) {
+        setEnvironmentVariable(name, value);
+      }
+
+      Configuration configuration = createConfiguration();
+      configuration.presentQueueFamilyRequired = false;
+      configuration.deviceExtensions = {};
+      std::ostringstream stream;
+      Logger logger = createLogger(stream);
+
+      Instance instance = createInstance(configuration, logger);
+      DebugUtilsMessenger debugUtilsMessenger = createDebugUtilsMessenger(instance.value, logger);
+      PhysicalDevice physicalDevice = createPhysicalDevice(instance.value, configuration);
+      Device device = createDevice(physicalDevice.value, configuration, physicalDevice.queueFamilyIndexInfo);
+
+      ASSERT_FALSE(shaders::SHADERS.empty());
+
+      Shader vertexShader1 = createShader(device.value, "shader-1.vert.spv", shaders::SHADERS.at("resources/shader/shader-1.vert.spv"));
+
+      ASSERT_TRUE(vertexShader1.shaderModule != nullptr);
+      ASSERT_EQ(vertexShader1.pipelineShaderStageCreateInfo.stage, VkShaderStageFlagBits::VK_SHADER_STAGE_VERTEX_BIT);
+
+      setEmbeddedShaders({
+          {"embedded/shader-1.frag.spv", shaders::SHADERS.at("resources/shader/shader-1.frag.spv")}
+      });
+
+      Shader fragmentShader1 = createShader(device.value, "embedded/shader-1.frag.spv");
+
+      ASSERT_TRUE(fragmentShader1.shaderModule != nullptr);
+      ASSERT_EQ(fragmentShader1.pipelineShaderStageCreateInfo.stage, VkShaderStageFlagBits::VK_SHADER_STAGE_FRAGMENT_BIT);
+
+      setEmbeddedShaders({});
+
+      destroyShader(vertexShader1);
+      destroyShader(fragmentShader1);
+
       destroyDevice(device);
       destroyPhysicalDevice(physicalDevice);
       destroyDebugUtilsMessenger(debugUtilsMessenger);
@@ -62,4 +171,380 @@ namespace exqudens::vulkan {
     }
   }
 
+  TEST_F(ShaderTests, test3) {
+    try {
+      // shader modules, layouts and pipelines are fake handles, no device is involved
+      class CachedFactory: public FactoryBase {
+
+        public:
+
+          std::size_t readCount = 0;
+          std::size_t pipelineCount = 0;
+          std::size_t destroyedPipelineCount = 0;
+
+          std::vector<char> readFile(const std::string& path) override {
+            readCount++;
+            return FactoryBase::readFile(path);
+          }
+
+        protected:
+
+          Functions createFunctions() override {
+            Functions value = FactoryBase::createFunctions();
+            value.createShaderModule = [](VkDevice, const VkShaderModuleCreateInfo*, const VkAllocationCallbacks*, VkShaderModule* pShaderModule) {
+              *pShaderModule = reinterpret_cast<VkShaderModule>(static_cast<uintptr_t>(1));
+              return VK_SUCCESS;
+            };
+            value.destroyShaderModule = [](VkDevice, VkShaderModule, const VkAllocationCallbacks*) {};
+            value.createPipelineLayout = [](VkDevice, const VkPipelineLayoutCreateInfo*, const VkAllocationCallbacks*, VkPipelineLayout* pPipelineLayout) {
+              *pPipelineLayout = reinterpret_cast<VkPipelineLayout>(static_cast<uintptr_t>(1));
+              return VK_SUCCESS;
+            };
+            value.destroyPipelineLayout = [](VkDevice, VkPipelineLayout, const VkAllocationCallbacks*) {};
+            value.createGraphicsPipelines = [this](VkDevice, VkPipelineCache, uint32_t, const VkGraphicsPipelineCreateInfo*, const VkAllocationCallbacks*, VkPipeline* pPipelines) {
+              pPipelines[0] = reinterpret_cast<VkPipeline>(static_cast<uintptr_t>(++pipelineCount));
+              return VK_SUCCESS;
+            };
+            value.destroyPipeline = [this](VkDevice, VkPipeline, const VkAllocationCallbacks*) {
+              destroyedPipelineCount++;
+            };
+            return value;
+          }
+
+      };
+
+      CachedFactory factory;
+      VkDevice device = reinterpret_cast<VkDevice>(static_cast<uintptr_t>(1));
+      std::vector<std::string> shaderPaths = {"resources/shader/shader-1.vert.spv", "resources/shader/shader-1.frag.spv"};
+      GraphicsPipelineCreateInfo createInfo = {
+          .rasterizationState = PipelineRasterizationStateCreateInfo {
+              .polygonMode = VK_POLYGON_MODE_FILL,
+              .cullMode = VK_CULL_MODE_BACK_BIT,
+              .frontFace = VK_FRONT_FACE_CLOCKWISE,
+              .lineWidth = 1.0f
+          }
+      };
+
+      Pipeline pipeline1 = factory.createPipeline(device, shaderPaths, {}, {}, {}, createInfo);
+
+      ASSERT_EQ(2, factory.readCount);
+      ASSERT_EQ(1, factory.pipelineCount);
+      ASSERT_EQ(0, factory.getPipelineCacheStatistics().hits);
+      ASSERT_EQ(1, factory.getPipelineCacheStatistics().misses);
+
+      // a hit reads the shaders for the key, but creates nothing
+      Pipeline pipeline2 = factory.createPipeline(device, shaderPaths, {}, {}, {}, createInfo);
+
+      ASSERT_EQ(pipeline1.value, pipeline2.value);
+      ASSERT_EQ(4, factory.readCount);
+      ASSERT_EQ(1, factory.pipelineCount);
+      ASSERT_EQ(1, factory.getPipelineCacheStatistics().hits);
+      ASSERT_EQ(1, factory.getPipelineCacheStatistics().size);
+
+      createInfo.rasterizationState.value().cullMode = VK_CULL_MODE_NONE;
+      Pipeline pipeline3 = factory.createPipeline(device, shaderPaths, {}, {}, {}, createInfo);
+
+      ASSERT_NE(pipeline1.value, pipeline3.value);
+      ASSERT_EQ(6, factory.readCount);
+      ASSERT_EQ(2, factory.pipelineCount);
+      ASSERT_EQ(2, factory.getPipelineCacheStatistics().misses);
+      ASSERT_EQ(2, factory.getPipelineCacheStatistics().size);
+
+      factory.destroyPipeline(pipeline1);
+
+      ASSERT_EQ(0, factory.destroyedPipelineCount);
+
+      factory.destroyPipeline(pipeline2);
+      factory.destroyPipeline(pipeline3);
+
+      ASSERT_EQ(2, factory.destroyedPipelineCount);
+      ASSERT_EQ(0, factory.getPipelineCacheStatistics().size);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ShaderTests, test4) {
+    try {
+      // libraries and links are told apart by their create info, no device is involved
+      class LibraryFactory: public FactoryBase {
+
+        public:
+
+          std::atomic<std::size_t> handleCount = 0;
+          std::atomic<std::size_t> libraryCount = 0;
+          std::atomic<std::size_t> linkCount = 0;
+          std::atomic<std::size_t> optimizedLinkCount = 0;
+          std::atomic<std::size_t> monolithicCount = 0;
+          std::atomic<std::size_t> destroyedPipelineCount = 0;
+
+        protected:
+
+          Functions createFunctions() override {
+            Functions value = FactoryBase::createFunctions();
+            value.createShaderModule = [](VkDevice, const VkShaderModuleCreateInfo*, const VkAllocationCallbacks*, VkShaderModule* pShaderModule) {
+              *pShaderModule = reinterpret_cast<VkShaderModule>(static_cast<uintptr_t>(1));
+              return VK_SUCCESS;
+            };
+            value.destroyShaderModule = [](VkDevice, VkShaderModule, const VkAllocationCallbacks*) {};
+            value.createPipelineLayout = [](VkDevice, const VkPipelineLayoutCreateInfo*, const VkAllocationCallbacks*, VkPipelineLayout* pPipelineLayout) {
+              *pPipelineLayout = reinterpret_cast<VkPipelineLayout>(static_cast<uintptr_t>(1));
+              return VK_SUCCESS;
+            };
+            value.destroyPipelineLayout = [](VkDevice, VkPipelineLayout, const VkAllocationCallbacks*) {};
+            value.createGraphicsPipelines = [this](VkDevice, VkPipelineCache, uint32_t, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks*, VkPipeline* pPipelines) {
+              const VkBaseInStructure* next = static_cast<const VkBaseInStructure*>(pCreateInfos[0].pNext);
+              if (pCreateInfos[0].flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR) {
+                libraryCount++;
+              } else if (next != nullptr && next->sType == VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR) {
+                if (pCreateInfos[0].flags & VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT) {
+                  optimizedLinkCount++;
+                } else {
+                  linkCount++;
+                }
+              } else {
+                monolithicCount++;
+              }
+              pPipelines[0] = reinterpret_cast<VkPipeline>(static_cast<uintptr_t>(++handleCount));
+              return VK_SUCCESS;
+            };
+            value.destroyPipeline = [this](VkDevice, VkPipeline, const VkAllocationCallbacks*) {
+              destroyedPipelineCount++;
+            };
+            return value;
+          }
+
+      };
+
+      LibraryFactory factory;
+      VkDevice device = reinterpret_cast<VkDevice>(static_cast<uintptr_t>(1));
+      std::vector<std::string> shaderPaths = {"resources/shader/shader-1.vert.spv", "resources/shader/shader-1.frag.spv"};
+      GraphicsPipelineCreateInfo createInfo = {
+          .rasterizationState = PipelineRasterizationStateCreateInfo {
+              .polygonMode = VK_POLYGON_MODE_FILL,
+              .cullMode = VK_CULL_MODE_BACK_BIT,
+              .frontFace = VK_FRONT_FACE_CLOCKWISE,
+              .lineWidth = 1.0f
+          }
+      };
+
+      factory.setGraphicsPipelineLibraryEnabled(true, false);
+
+      Pipeline pipeline1 = factory.createPipeline(device, shaderPaths, {}, {}, {}, createInfo);
+
+      ASSERT_TRUE(pipeline1.value != nullptr);
+      ASSERT_EQ(4, factory.libraryCount);
+      ASSERT_EQ(1, factory.linkCount);
+      ASSERT_EQ(0, factory.monolithicCount);
+
+      // only the pre-rasterization part depends on the cull mode, the other three are linked from the cache
+      createInfo.rasterizationState.value().cullMode = VK_CULL_MODE_NONE;
+      Pipeline pipeline2 = factory.createPipeline(device, shaderPaths, {}, {}, {}, createInfo);
+
+      ASSERT_NE(pipeline1.value, pipeline2.value);
+      ASSERT_EQ(5, factory.libraryCount);
+      ASSERT_EQ(2, factory.linkCount);
+      ASSERT_EQ(2, factory.getPipelineCacheStatistics().size);
+
+      factory.destroyPipeline(pipeline1);
+      factory.destroyPipeline(pipeline2);
+
+      ASSERT_EQ(2, factory.destroyedPipelineCount);
+
+      factory.destroyPipelineLibraries();
+
+      ASSERT_EQ(7, factory.destroyedPipelineCount);
+
+      // without the library path the pipeline is created whole
+      factory.setGraphicsPipelineLibraryEnabled(false, false);
+      Pipeline pipeline3 = factory.createPipeline(device, shaderPaths, {}, {}, {}, createInfo);
+
+      ASSERT_EQ(5, factory.libraryCount);
+      ASSERT_EQ(1, factory.monolithicCount);
+
+      factory.destroyPipeline(pipeline3);
+
+      ASSERT_EQ(8, factory.destroyedPipelineCount);
+
+      // the optimized link replaces the fast one on a hit once the background link is done
+      factory.setGraphicsPipelineLibraryEnabled(true, true);
+      Pipeline pipeline4 = factory.createPipeline(device, shaderPaths, {}, {}, {}, createInfo);
+
+      ASSERT_EQ(9, factory.libraryCount);
+      ASSERT_EQ(3, factory.linkCount);
+
+      Pipeline pipeline5 = {};
+      for (std::size_t i = 0; i < 1000 && (pipeline5.value == nullptr || pipeline5.value == pipeline4.value); i++) {
+        if (pipeline5.value != nullptr) {
+          factory.destroyPipeline(pipeline5);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        pipeline5 = factory.createPipeline(device, shaderPaths, {}, {}, {}, createInfo);
+      }
+
+      ASSERT_NE(pipeline4.value, pipeline5.value);
+      ASSERT_EQ(1, factory.optimizedLinkCount);
+      ASSERT_EQ(3, factory.linkCount);
+
+      // the fast link handed out before the swap lives until the last reference is gone
+      factory.destroyPipeline(pipeline4);
+
+      ASSERT_EQ(8, factory.destroyedPipelineCount);
+
+      factory.destroyPipeline(pipeline5);
+
+      ASSERT_EQ(10, factory.destroyedPipelineCount);
+
+      factory.destroyPipelineLibraries();
+
+      ASSERT_EQ(14, factory.destroyedPipelineCount);
+      ASSERT_EQ(0, factory.getPipelineCacheStatistics().size);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
+  TEST_F(ShaderTests, test5) {
+    try {
+      // render passes, layouts and pipelines are fake handles, no device is involved
+      class KeyFactory: public FactoryBase {
+
+        public:
+
+          bool pipelineFails = false;
+          std::size_t renderPassCount = 0;
+          std::size_t pipelineCount = 0;
+          std::size_t shaderModuleCount = 0;
+          std::size_t pipelineLayoutCount = 0;
+
+        protected:
+
+          Functions createFunctions() override {
+            Functions value = FactoryBase::createFunctions();
+            value.createRenderPass = [this](VkDevice, const VkRenderPassCreateInfo*, const VkAllocationCallbacks*, VkRenderPass* pRenderPass) {
+              *pRenderPass = reinterpret_cast<VkRenderPass>(static_cast<uintptr_t>(++renderPassCount));
+              return VK_SUCCESS;
+            };
+            value.destroyRenderPass = [](VkDevice, VkRenderPass, const VkAllocationCallbacks*) {};
+            value.createShaderModule = [this](VkDevice, const VkShaderModuleCreateInfo*, const VkAllocationCallbacks*, VkShaderModule* pShaderModule) {
+              *pShaderModule = reinterpret_cast<VkShaderModule>(static_cast<uintptr_t>(++shaderModuleCount));
+              return VK_SUCCESS;
+            };
+            value.destroyShaderModule = [this](VkDevice, VkShaderModule, const VkAllocationCallbacks*) {
+              shaderModuleCount--;
+            };
+            value.createPipelineLayout = [this](VkDevice, const VkPipelineLayoutCreateInfo*, const VkAllocationCallbacks*, VkPipelineLayout* pPipelineLayout) {
+              *pPipelineLayout = reinterpret_cast<VkPipelineLayout>(static_cast<uintptr_t>(++pipelineLayoutCount));
+              return VK_SUCCESS;
+            };
+            value.destroyPipelineLayout = [this](VkDevice, VkPipelineLayout, const VkAllocationCallbacks*) {
+              pipelineLayoutCount--;
+            };
+            value.createGraphicsPipelines = [this](VkDevice, VkPipelineCache, uint32_t, const VkGraphicsPipelineCreateInfo*, const VkAllocationCallbacks*, VkPipeline* pPipelines) {
+              if (pipelineFails) {
+                return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+              }
+              pPipelines[0] = reinterpret_cast<VkPipeline>(static_cast<uintptr_t>(++pipelineCount));
+              return VK_SUCCESS;
+            };
+            value.destroyPipeline = [](VkDevice, VkPipeline, const VkAllocationCallbacks*) {};
+            return value;
+          }
+
+      };
+
+      KeyFactory factory;
+      VkDevice device = reinterpret_cast<VkDevice>(static_cast<uintptr_t>(1));
+
+      RenderPassCreateInfo renderPassCreateInfo = {
+          .attachments = {
+              VkAttachmentDescription {
+                  .format = VK_FORMAT_B8G8R8A8_SRGB,
+                  .samples = VK_SAMPLE_COUNT_1_BIT,
+                  .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+                  .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+                  .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                  .finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+              }
+          },
+          .subPasses = {
+              SubPassDescription {
+                  .pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS,
+                  .colorAttachments = {
+                      VkAttachmentReference {
+                          .attachment = 0,
+                          .layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+                      }
+                  }
+              }
+          }
+      };
+      RenderPass renderPass1 = factory.createRenderPass(device, renderPassCreateInfo);
+
+      // load ops and layouts do not break compatibility
+      renderPassCreateInfo.attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+      renderPassCreateInfo.attachments[0].initialLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+      RenderPass renderPass2 = factory.createRenderPass(device, renderPassCreateInfo);
+
+      renderPassCreateInfo.attachments[0].samples = VK_SAMPLE_COUNT_4_BIT;
+      RenderPass renderPass3 = factory.createRenderPass(device, renderPassCreateInfo);
+
+      ASSERT_NE(renderPass1.value, renderPass2.value);
+
+      // the same code under another path is the same shader
+      factory.setEmbeddedShaders({
+          {"a/shader-1.vert.spv", shaders::SHADERS.at("resources/shader/shader-1.vert.spv")},
+          {"a/shader-1.frag.spv", shaders::SHADERS.at("resources/shader/shader-1.frag.spv")},
+          {"b/shader-1.vert.spv", shaders::SHADERS.at("resources/shader/shader-1.vert.spv")},
+          {"b/shader-1.frag.spv", shaders::SHADERS.at("resources/shader/shader-1.frag.spv")}
+      });
+
+      GraphicsPipelineCreateInfo createInfo = {
+          .renderPass = renderPass1.value,
+          .subpass = 0
+      };
+      Pipeline pipeline1 = factory.createPipeline(device, {"a/shader-1.vert.spv", "a/shader-1.frag.spv"}, {}, {}, {}, createInfo);
+
+      createInfo.renderPass = renderPass2.value;
+      Pipeline pipeline2 = factory.createPipeline(device, {"b/shader-1.vert.spv", "b/shader-1.frag.spv"}, {}, {}, {}, createInfo);
+
+      ASSERT_EQ(pipeline1.value, pipeline2.value);
+      ASSERT_EQ(1, factory.pipelineCount);
+      ASSERT_EQ(1, factory.getPipelineCacheStatistics().hits);
+
+      createInfo.renderPass = renderPass3.value;
+      Pipeline pipeline3 = factory.createPipeline(device, {"a/shader-1.vert.spv", "a/shader-1.frag.spv"}, {}, {}, {}, createInfo);
+
+      ASSERT_NE(pipeline1.value, pipeline3.value);
+      ASSERT_EQ(2, factory.pipelineCount);
+
+      // a failed create leaves no layout and no shader module behind
+      ASSERT_EQ(0, factory.shaderModuleCount);
+      ASSERT_EQ(2, factory.pipelineLayoutCount);
+
+      factory.pipelineFails = true;
+      createInfo.subpass = 1;
+      ASSERT_THROW(
+          factory.createPipeline(device, {"a/shader-1.vert.spv", "a/shader-1.frag.spv"}, {}, {}, {}, createInfo),
+          std::runtime_error
+      );
+
+      ASSERT_EQ(0, factory.shaderModuleCount);
+      ASSERT_EQ(2, factory.pipelineLayoutCount);
+      ASSERT_EQ(2, factory.getPipelineCacheStatistics().size);
+
+      factory.destroyPipeline(pipeline1);
+      factory.destroyPipeline(pipeline2);
+      factory.destroyPipeline(pipeline3);
+      factory.destroyRenderPass(renderPass1);
+      factory.destroyRenderPass(renderPass2);
+      factory.destroyRenderPass(renderPass3);
+      factory.setEmbeddedShaders({});
+
+      ASSERT_EQ(0, factory.pipelineLayoutCount);
+    } catch (const std::exception& e) {
+      FAIL() << TestUtils::toString(e);
+    }
+  }
+
 }
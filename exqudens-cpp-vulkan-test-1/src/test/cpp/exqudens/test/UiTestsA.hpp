@@ -10,6 +10,7 @@
 #include <gtest/gtest.h>
 
 #include "exqudens/TestUtils.hpp"
+#include "exqudens/test/Shaders.hpp"
 #include "exqudens/vulkan/ContextBase.hpp"
 #include "exqudens/vulkan/RendererBase.hpp"
 #include "exqudens/test/model/Vertex.hpp"
@@ -31,6 +32,13 @@ namespace exqudens::vulkan {
 
         private:
 
+          struct RetiredSwapChainResources {
+            std::vector<FrameBuffer> frameBuffers;
+            std::vector<ImageView> imageViews;
+            ImageView depthImageView;
+            Image depthImage;
+          };
+
           const int MAX_FRAMES_IN_FLIGHT = 2;
 
           GLFWwindow* window = nullptr;
@@ -78,6 +86,7 @@ namespace exqudens::vulkan {
           std::vector<Image> swapChainImages = {};
           std::vector<ImageView> swapChainImageViews = {};
           std::vector<FrameBuffer> swapChainFrameBuffers = {};
+          std::map<VkSwapchainKHR, RetiredSwapChainResources> retiredSwapChainResources = {};
 
           Queue transferQueue = {};
           CommandPool transferCommandPool = {};
@@ -95,6 +104,8 @@ namespace exqudens::vulkan {
 
           std::size_t currentFrame = 0;
 
+          FramePacer framePacer = {};
+
         public:
 
           void create(const std::vector<std::string>& arguments, GLFWwindow* window) {
@@ -119,6 +130,7 @@ namespace exqudens::vulkan {
               };
 
               context = new ContextBase;
+              context->setEmbeddedShaders(shaders::SHADERS);
 
               environmentVariables = context->createEnvironmentVariables(arguments.front());
               for (auto const& [name, value] : environmentVariables) {
@@ -147,6 +159,8 @@ namespace exqudens::vulkan {
               int width = 0;
               int height = 0;
               glfwGetFramebufferSize(window, &width, &height);
+              context->setPresentPolicy(configuration.presentPolicy);
+              framePacer = context->createFramePacer(configuration.presentPolicy);
               swapChain = context->createSwapChain(
                   physicalDevice.swapChainSupportDetails.value(),
                   physicalDevice.queueFamilyIndexInfo,
@@ -163,7 +177,7 @@ namespace exqudens::vulkan {
                   VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
               );
-              copyToMemory(device.value, vertexStagingBuffer.memory, 0, vertexStagingBuffer.memorySize, vertices.data());
+              copyToMemory(device.value, vertexStagingBuffer.memory, 0, sizeof(vertices[0]) * vertices.size(), vertices.data());
               vertexBuffer = context->createBuffer(
                   physicalDevice.value,
                   device.value,
@@ -179,7 +193,7 @@ namespace exqudens::vulkan {
                   VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
               );
-              copyToMemory(device.value, indexStagingBuffer.memory, 0, indexStagingBuffer.memorySize, indices.data());
+              copyToMemory(device.value, indexStagingBuffer.memory, 0, sizeof(indices[0]) * indices.size(), indices.data());
               indexBuffer = context->createBuffer(
                   physicalDevice.value,
                   device.value,
@@ -213,7 +227,7 @@ namespace exqudens::vulkan {
                   VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
                   VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
               );
-              copyToMemory(device.value, samplerImageStaging.memory, 0, samplerImageStaging.memorySize, imageData.data());
+              copyToMemory(device.value, samplerImageStaging.memory, 0, imageData.size(), imageData.data());
               samplerImage = context->createImage(
                   physicalDevice.value,
                   device.value,
@@ -282,13 +296,12 @@ namespace exqudens::vulkan {
                       }
                   }
               );
-              descriptorSets.resize(MAX_FRAMES_IN_FLIGHT);
-              for (std::size_t i = 0; i < descriptorSets.size(); i++) {
-                descriptorSets[i] = context->createDescriptorSet(
-                    device.value,
-                    descriptorPool.value,
-                    descriptorSetLayout.value,
-                    {
+              std::vector<VkDescriptorSetLayout> frameDescriptorSetLayouts;
+              std::vector<std::vector<WriteDescriptorSet>> frameWriteDescriptorSets;
+              for (std::size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+                frameDescriptorSetLayouts.emplace_back(descriptorSetLayout.value);
+                frameWriteDescriptorSets.emplace_back(
+                    std::vector<WriteDescriptorSet> {
                         WriteDescriptorSet {
                             .dstBinding = 0,
                             .dstArrayElement = 0,
@@ -322,6 +335,12 @@ namespace exqudens::vulkan {
                     }
                 );
               }
+              descriptorSets = context->createDescriptorSets(
+                  device.value,
+                  descriptorPool.value,
+                  frameDescriptorSetLayouts,
+                  frameWriteDescriptorSets
+              );
 
               RenderPassCreateInfo renderPassCreateInfo = {
                   .attachments = {
@@ -443,14 +462,14 @@ namespace exqudens::vulkan {
                   transferCommandBuffer.value,
                   vertexStagingBuffer.value,
                   vertexBuffer.value,
-                  vertexStagingBuffer.memorySize
+                  sizeof(vertices[0]) * vertices.size()
               );
 
               cmdCopyBuffer(
                   transferCommandBuffer.value,
                   indexStagingBuffer.value,
                   indexBuffer.value,
-                  indexStagingBuffer.memorySize
+                  sizeof(indices[0]) * indices.size()
               );
 
               cmdPipelineBarrier(
@@ -501,7 +520,10 @@ namespace exqudens::vulkan {
 
           void drawFrame(int width, int height) {
             try {
+              context->beginFrame(framePacer);
+
               vkWaitForFences(device.value, 1, &inFlightFences[currentFrame].value, VK_TRUE, UINT64_MAX);
+              context->endFrameWait(framePacer);
 
               uint32_t imageIndex;
               VkResult result = vkAcquireNextImageKHR(device.value, swapChain.value, UINT64_MAX, imageAvailableSemaphores[currentFrame].value, VK_NULL_HANDLE, &imageIndex);
@@ -513,6 +535,15 @@ namespace exqudens::vulkan {
                 throw std::runtime_error("failed to acquire swap chain image!");
               }
 
+              for (VkSwapchainKHR& released : context->releaseRetiredSwapChains()) {
+                RetiredSwapChainResources& resources = retiredSwapChainResources[released];
+                context->destroyFrameBuffers(resources.frameBuffers);
+                context->destroyImageView(resources.depthImageView);
+                context->destroyImage(resources.depthImage);
+                context->destroyImageViews(resources.imageViews);
+                retiredSwapChainResources.erase(released);
+              }
+
               updateUniformBuffer(currentFrame);
 
               vkResetFences(device.value, 1, &inFlightFences[currentFrame].value);
@@ -573,6 +604,8 @@ namespace exqudens::vulkan {
                 throw std::runtime_error("failed to present swap chain image!");
               }
 
+              context->endFrame(framePacer);
+
               currentFrame = (currentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
             } catch (...) {
               std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -617,23 +650,23 @@ namespace exqudens::vulkan {
             try {
               std::cout << __FUNCTION__ << " width: " << width << " height: " << height << std::endl;
 
-              vkDeviceWaitIdle(device.value);
+              VkFormat swapChainFormat = swapChain.format;
 
-              context->destroyFrameBuffers(swapChainFrameBuffers);
-              context->destroyPipeline(graphicsPipeline);
-              context->destroyRenderPass(renderPass);
-              context->destroyImageView(depthImageView);
-              context->destroyImage(depthImage);
-              context->destroyImageViews(swapChainImageViews);
-              context->destroySwapChain(swapChain);
+              // frames in flight still use the old chain, its resources go with it once it is released
+              retiredSwapChainResources[swapChain.value] = RetiredSwapChainResources {
+                  .frameBuffers = swapChainFrameBuffers,
+                  .imageViews = swapChainImageViews,
+                  .depthImageView = depthImageView,
+                  .depthImage = depthImage
+              };
 
               physicalDevice.swapChainSupportDetails = context->querySwapChainSupport(physicalDevice.value, surface.value);
 
-              swapChain = context->createSwapChain(
+              swapChain = context->recreateSwapChain(
+                  swapChain,
                   physicalDevice.swapChainSupportDetails.value(),
                   physicalDevice.queueFamilyIndexInfo,
                   surface.value,
-                  device.value,
                   (uint32_t) width,
                   (uint32_t) height
               );
@@ -652,68 +685,76 @@ namespace exqudens::vulkan {
               );
               depthImageView = context->createImageView(device.value, depthImage.value, depthImage.format, VK_IMAGE_ASPECT_DEPTH_BIT);
 
-              renderPass = context->createRenderPass(
-                  device.value,
-                  RenderPassCreateInfo {
-                      .attachments = {
-                          VkAttachmentDescription {
-                              .format = swapChain.format,
-                              .samples = VK_SAMPLE_COUNT_1_BIT,
-                              .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
-                              .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
-                              .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
-                              .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
-                              .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-                              .finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
-                          },
-                          VkAttachmentDescription {
-                              .format = depthImage.format,
-                              .samples = VK_SAMPLE_COUNT_1_BIT,
-                              .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
-                              .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
-                              .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
-                              .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
-                              .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-                              .finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
-                          }
-                      },
-                      .subPasses = {
-                          SubPassDescription {
-                              .pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS,
-                              .colorAttachments = {
-                                  VkAttachmentReference {
-                                      .attachment = 0,
-                                      .layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
-                                  }
-                              },
-                              .depthStencilAttachment = VkAttachmentReference {
-                                  .attachment = 1,
-                                  .layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
-                              }
-                          }
-                      },
-                      .dependencies = {
-                          VkSubpassDependency {
-                              .srcSubpass = VK_SUBPASS_EXTERNAL,
-                              .dstSubpass = 0,
-                              .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
-                              .dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
-                              .srcAccessMask = 0,
-                              .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
-                          }
-                      }
-                  }
-              );
-              graphicsPipeline = context->createGraphicsPipeline(
-                  device.value,
-                  swapChain.extent,
-                  {"resources/shader/shader-4.vert.spv", "resources/shader/shader-4.frag.spv"},
-                  renderPass.value,
-                  VK_FRONT_FACE_COUNTER_CLOCKWISE,
-                  {descriptorSetLayout.value},
-                  {Vertex::getBindingDescription()},
-                  Vertex::getAttributeDescriptions()
-              );
+              // viewport and scissor are dynamic, so the render pass and the pipeline
+              // only have to be rebuilt when the surface format changes
+              if (swapChain.format != swapChainFormat) {
+                vkDeviceWaitIdle(device.value);
+                context->destroyPipeline(graphicsPipeline);
+                context->destroyRenderPass(renderPass);
+
+                renderPass = context->createRenderPass(
+                    device.value,
+                    RenderPassCreateInfo {
+                        .attachments = {
+                            VkAttachmentDescription {
+                                .format = swapChain.format,
+                                .samples = VK_SAMPLE_COUNT_1_BIT,
+                                .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+                                .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+                                .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+                                .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                                .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                                .finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+                            },
+                            VkAttachmentDescription {
+                                .format = depthImage.format,
+                                .samples = VK_SAMPLE_COUNT_1_BIT,
+                                .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+                                .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+                                .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+                                .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                                .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                                .finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+                            }
+                        },
+                        .subPasses = {
+                            SubPassDescription {
+                                .pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS,
+                                .colorAttachments = {
+                                    VkAttachmentReference {
+                                        .attachment = 0,
+                                        .layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+                                    }
+                                },
+                                .depthStencilAttachment = VkAttachmentReference {
+                                    .attachment = 1,
+                                    .layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+                                }
+                            }
+                        },
+                        .dependencies = {
+                            VkSubpassDependency {
+                                .srcSubpass = VK_SUBPASS_EXTERNAL,
+                                .dstSubpass = 0,
+                                .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+                                .dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+                                .srcAccessMask = 0,
+                                .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+                            }
+                        }
+                    }
+                );
+                graphicsPipeline = context->createGraphicsPipeline(
+                    device.value,
+                    swapChain.extent,
+                    {"resources/shader/shader-4.vert.spv", "resources/shader/shader-4.frag.spv"},
+                    renderPass.value,
+                    VK_FRONT_FACE_COUNTER_CLOCKWISE,
+                    {descriptorSetLayout.value},
+                    {Vertex::getBindingDescription()},
+                    Vertex::getAttributeDescriptions()
+                );
+              }
 
               std::vector<FrameBufferCreateInfo> frameBufferCreateInfoVector;
               frameBufferCreateInfoVector.resize(swapChainImageViews.size());
@@ -779,7 +820,7 @@ namespace exqudens::vulkan {
                   device.value,
                   uniformBuffers[currentImage].memory,
                   0,
-                  uniformBuffers[currentImage].memorySize,
+                  sizeof(ubo),
                   &ubo
               );
             } catch (...) {
@@ -830,6 +871,17 @@ namespace exqudens::vulkan {
 
               vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
 
+              VkViewport viewport = {
+                  .x = 0.0f,
+                  .y = 0.0f,
+                  .width = static_cast<float>(renderPassInfo.renderArea.extent.width),
+                  .height = static_cast<float>(renderPassInfo.renderArea.extent.height),
+                  .minDepth = 0.0f,
+                  .maxDepth = 1.0f
+              };
+              vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+              vkCmdSetScissor(commandBuffer, 0, 1, &renderPassInfo.renderArea);
+
               VkBuffer vertexBuffers[] = {vertexBuffer};
               VkDeviceSize offsets[] = {0};
               vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
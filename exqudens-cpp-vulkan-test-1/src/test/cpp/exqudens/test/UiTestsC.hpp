@@ -1,9 +1,13 @@
 #pragma once
 
 #include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
 #include <string>
 #include <vector>
 #include <chrono>
+#include <source_location>
 #include <stdexcept>
 
 #define GLFW_INCLUDE_VULKAN
@@ -19,7 +23,7 @@
 #include "exqudens/TestMacros.hpp"
 #include "exqudens/TestConfiguration.hpp"
 #include "exqudens/TestUtils.hpp"
-#include "exqudens/vulkan/Factory.hpp"
+#include "exqudens/vulkan/FactoryBase.hpp"
 #include "exqudens/test/model/Vertex.hpp"
 #include "exqudens/test/model/UniformBufferObject.hpp"
 
@@ -29,54 +33,72 @@ namespace exqudens::vulkan {
 
     protected:
 
-      class Environment : public Factory {
+      class Environment : public FactoryBase {
 
         public:
 
+          GLFWwindow* window = nullptr;
+
           std::vector<Vertex> vertices = {};
           std::vector<uint16_t> indices = {};
 
           std::map<std::string, std::string> environmentVariables = {};
           Configuration configuration = {};
           Logger logger = {};
-          VkInstance instance = nullptr;
-          VkDebugUtilsMessengerEXT debugUtilsMessenger = nullptr;
-          VkSurfaceKHR surface = nullptr;
+          Instance instance = {};
+          DebugUtilsMessenger debugUtilsMessenger = {};
+          Surface surface = {};
           PhysicalDevice physicalDevice = {};
-          VkDevice device = nullptr;
+          Device device = {};
           Queue transferQueue = {};
           Queue graphicsQueue = {};
           Queue presentQueue = {};
           SwapChain swapChain = {};
-          std::vector<VkImage> swapChainImages = {};
-          std::vector<VkImageView> swapChainImageViews = {};
-          VkRenderPass renderPass = nullptr;
-          VkDescriptorSetLayout descriptorSetLayout = nullptr;
+          std::vector<Image> swapChainImages = {};
+          std::vector<ImageView> swapChainImageViews = {};
+          RenderPass renderPass = {};
+          DescriptorSetLayout descriptorSetLayout = {};
           Pipeline graphicsPipeline = {};
-          std::vector<VkFramebuffer> swapChainFrameBuffers = {};
-          VkCommandPool transferCommandPool = nullptr;
-          VkCommandPool graphicsCommandPool = nullptr;
+          std::vector<FrameBuffer> swapChainFrameBuffers = {};
+          CommandPool transferCommandPool = {};
+          CommandPool graphicsCommandPool = {};
           Buffer vertexStagingBuffer = {};
           Buffer vertexBuffer = {};
           Buffer indexStagingBuffer = {};
           Buffer indexBuffer = {};
           std::vector<Buffer> uniformBuffers = {};
-          VkDescriptorPool descriptorPool = nullptr;
-          std::vector<VkDescriptorSet> descriptorSets = {};
-          VkCommandBuffer transferCommandBuffer = nullptr;
-          std::vector<VkCommandBuffer> graphicsCommandBuffers = {};
+          DescriptorPool descriptorPool = {};
+          std::vector<DescriptorSet> descriptorSets = {};
+          CommandBuffer transferCommandBuffer = {};
+          std::vector<CommandBuffer> graphicsCommandBuffers = {};
 
-          std::vector<VkSemaphore> imageAvailableSemaphores = {};
-          std::vector<VkSemaphore> renderFinishedSemaphores = {};
-          std::vector<VkFence> inFlightFences = {};
+          std::vector<Semaphore> imageAvailableSemaphores = {};
+          std::vector<Semaphore> renderFinishedSemaphores = {};
+          std::vector<Fence> inFlightFences = {};
 
           std::size_t currentFrame = 0;
           int MAX_FRAMES_IN_FLIGHT = 2;
 
           bool resized = false;
 
-          void create(GLFWwindow*& window) {
+          Surface createSurface(
+              VkInstance& instance,
+              std::source_location location = std::source_location::current()
+          ) override {
+            VkSurfaceKHR result;
+            if (glfwCreateWindowSurface(instance, window, nullptr, &result) != VK_SUCCESS) {
+              throw std::runtime_error(CALL_INFO() + ": failed to create window surface!");
+            }
+            return {
+              .instance = instance,
+              .value = result
+            };
+          }
+
+          void create(GLFWwindow* window) {
             try {
+              this->window = window;
+
               vertices = {
                   {{-0.5f, -0.5f, 0.0f}, {1.0f, 0.0f, 0.0f}},
                   {{0.5f, -0.5f, 0.0f}, {0.0f, 1.0f, 0.0f}},
@@ -110,31 +132,22 @@ namespace exqudens::vulkan {
               configuration.anisotropyRequired = false;
               logger = createLogger();
 
-              functions = createFunctions();
-              functions.createSurfaceKHR = [&window](VkInstance i) -> VkSurfaceKHR {
-                VkSurfaceKHR result;
-                if (glfwCreateWindowSurface(i, window, nullptr, &result) != VK_SUCCESS) {
-                  throw std::runtime_error(CALL_INFO() + ": failed to create window surface!");
-                }
-                return result;
-              };
-
               instance = createInstance(configuration, logger);
-              debugUtilsMessenger = createDebugUtilsMessenger(instance, logger);
-              surface = createSurface(instance);
-              physicalDevice = createPhysicalDevice(instance, configuration, surface);
+              debugUtilsMessenger = createDebugUtilsMessenger(instance.value, logger);
+              surface = createSurface(instance.value);
+              physicalDevice = createPhysicalDevice(instance.value, configuration, surface.value);
               device = createDevice(physicalDevice.value, configuration, physicalDevice.queueFamilyIndexInfo);
-              transferQueue = createQueue(device, physicalDevice.queueFamilyIndexInfo.transferFamily.value(), 0);
-              graphicsQueue = createQueue(device, physicalDevice.queueFamilyIndexInfo.graphicsFamily.value(), 0);
-              presentQueue = createQueue(device, physicalDevice.queueFamilyIndexInfo.presentFamily.value(), 0);
-              transferCommandPool = createCommandPool(device, transferQueue.familyIndex, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
-              graphicsCommandPool = createCommandPool(device, graphicsQueue.familyIndex, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
-              swapChain = createSwapChain(physicalDevice.swapChainSupportDetails.value(), physicalDevice.queueFamilyIndexInfo, surface, device, 800, 600);
-              swapChainImages = createSwapChainImages(device, swapChain.value);
-              swapChainImageViews = createImageViews(device, swapChainImages, swapChain.format);
-              renderPass = createRenderPass(device, swapChain.format);
+              transferQueue = createQueue(device.value, physicalDevice.queueFamilyIndexInfo.transferFamily.value(), 0);
+              graphicsQueue = createQueue(device.value, physicalDevice.queueFamilyIndexInfo.graphicsFamily.value(), 0);
+              presentQueue = createQueue(device.value, physicalDevice.queueFamilyIndexInfo.presentFamily.value(), 0);
+              transferCommandPool = createCommandPool(device.value, transferQueue.familyIndex, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+              graphicsCommandPool = createCommandPool(device.value, graphicsQueue.familyIndex, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+              swapChain = createSwapChain(physicalDevice.swapChainSupportDetails.value(), physicalDevice.queueFamilyIndexInfo, surface.value, device.value, 800, 600);
+              swapChainImages = createSwapChainImages(device.value, swapChain.value);
+              swapChainImageViews = createImageViews(device.value, swapChainImages, swapChain.format);
+              renderPass = createRenderPass(device.value, swapChain.format);
               descriptorSetLayout = createDescriptorSetLayout(
-                  device,
+                  device.value,
                   DescriptorSetLayoutCreateInfo {
                     .flags = 0,
                     .bindings = {
@@ -149,12 +162,12 @@ namespace exqudens::vulkan {
                   }
               );
               graphicsPipeline = createGraphicsPipeline(
-                  device,
+                  device.value,
                   swapChain.extent,
                   {"resources/shader/shader-3.vert.spv", "resources/shader/shader-3.frag.spv"},
-                  renderPass,
+                  renderPass.value,
                   VK_FRONT_FACE_COUNTER_CLOCKWISE,
-                  {descriptorSetLayout},
+                  {descriptorSetLayout.value},
                   {Vertex::getBindingDescription()},
                   Vertex::getAttributeDescriptions()
               );
@@ -163,35 +176,35 @@ namespace exqudens::vulkan {
               for (std::size_t i = 0; i < frameBufferCreateInfoVector.size(); i++) {
                 frameBufferCreateInfoVector[i] = FrameBufferCreateInfo {
                     .flags = 0,
-                    .renderPass = renderPass,
+                    .renderPass = renderPass.value,
                     .attachments = {
-                        swapChainImageViews[i]
+                        swapChainImageViews[i].value
                     },
                     .width = swapChain.extent.width,
                     .height = swapChain.extent.height,
                     .layers = 1
                 };
               }
-              swapChainFrameBuffers = createFrameBuffers(device, frameBufferCreateInfoVector);
-              vertexStagingBuffer = createBuffer(physicalDevice.value, device, sizeof(vertices[0]) * vertices.size(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+              swapChainFrameBuffers = createFrameBuffers(device.value, frameBufferCreateInfoVector);
+              vertexStagingBuffer = createBuffer(physicalDevice.value, device.value, sizeof(vertices[0]) * vertices.size(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
               void* vertexData;
-              vkMapMemory(device, vertexStagingBuffer.memory, 0, vertexStagingBuffer.memorySize, 0, &vertexData);
-              std::memcpy(vertexData, vertices.data(), (size_t) vertexStagingBuffer.memorySize);
-              vkUnmapMemory(device, vertexStagingBuffer.memory);
+              vkMapMemory(device.value, vertexStagingBuffer.memory, 0, vertexStagingBuffer.memorySize, 0, &vertexData);
+              std::memcpy(vertexData, vertices.data(), sizeof(vertices[0]) * vertices.size());
+              vkUnmapMemory(device.value, vertexStagingBuffer.memory);
 
-              vertexBuffer = createBuffer(physicalDevice.value, device, sizeof(vertices[0]) * vertices.size(), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-              indexStagingBuffer = createBuffer(physicalDevice.value, device, sizeof(indices[0]) * indices.size(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+              vertexBuffer = createBuffer(physicalDevice.value, device.value, sizeof(vertices[0]) * vertices.size(), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+              indexStagingBuffer = createBuffer(physicalDevice.value, device.value, sizeof(indices[0]) * indices.size(), VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
 
               void* indexData;
-              vkMapMemory(device, indexStagingBuffer.memory, 0, indexStagingBuffer.memorySize, 0, &indexData);
-              std::memcpy(indexData, indices.data(), (size_t) indexStagingBuffer.memorySize);
-              vkUnmapMemory(device, indexStagingBuffer.memory);
+              vkMapMemory(device.value, indexStagingBuffer.memory, 0, indexStagingBuffer.memorySize, 0, &indexData);
+              std::memcpy(indexData, indices.data(), sizeof(indices[0]) * indices.size());
+              vkUnmapMemory(device.value, indexStagingBuffer.memory);
 
-              indexBuffer = createBuffer(physicalDevice.value, device, sizeof(vertices[0]) * vertices.size(), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
-              uniformBuffers = createBuffers(physicalDevice.value, device, sizeof(UniformBufferObject), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, MAX_FRAMES_IN_FLIGHT);
+              indexBuffer = createBuffer(physicalDevice.value, device.value, sizeof(vertices[0]) * vertices.size(), VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+              uniformBuffers = createBuffers(physicalDevice.value, device.value, sizeof(UniformBufferObject), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, MAX_FRAMES_IN_FLIGHT);
               descriptorPool = createDescriptorPool(
-                  device,
+                  device.value,
                   DescriptorPoolCreateInfo {
                       .maxSets = static_cast<uint32_t>(MAX_FRAMES_IN_FLIGHT),
                       .poolSizes = {
@@ -205,9 +218,9 @@ namespace exqudens::vulkan {
               descriptorSets.resize(MAX_FRAMES_IN_FLIGHT);
               for (std::size_t i = 0; i < descriptorSets.size(); i++) {
                 descriptorSets[i] = createDescriptorSet(
-                    device,
-                    descriptorPool,
-                    descriptorSetLayout,
+                    device.value,
+                    descriptorPool.value,
+                    descriptorSetLayout.value,
                     {
                         WriteDescriptorSet {
                             .dstBinding = 0,
@@ -227,28 +240,28 @@ namespace exqudens::vulkan {
                     }
                 );
               }
-              transferCommandBuffer = createCommandBuffer(device, transferCommandPool);
-              graphicsCommandBuffers = createCommandBuffers(device, graphicsCommandPool, MAX_FRAMES_IN_FLIGHT);
+              transferCommandBuffer = createCommandBuffer(device.value, transferCommandPool.value);
+              graphicsCommandBuffers = createCommandBuffers(device.value, graphicsCommandPool.value, MAX_FRAMES_IN_FLIGHT);
 
               copyBuffer(
-                  transferCommandPool,
-                  vertexStagingBuffer.memorySize,
+                  transferCommandPool.value,
+                  sizeof(vertices[0]) * vertices.size(),
                   vertexStagingBuffer.value,
                   vertexBuffer.value,
                   transferQueue.value
               );
 
               copyBuffer(
-                  transferCommandPool,
-                  indexStagingBuffer.memorySize,
+                  transferCommandPool.value,
+                  sizeof(indices[0]) * indices.size(),
                   indexStagingBuffer.value,
                   indexBuffer.value,
                   transferQueue.value
               );
 
-              imageAvailableSemaphores = createSemaphores(device, MAX_FRAMES_IN_FLIGHT);
-              renderFinishedSemaphores = createSemaphores(device, MAX_FRAMES_IN_FLIGHT);
-              inFlightFences = createFences(device, MAX_FRAMES_IN_FLIGHT);
+              imageAvailableSemaphores = createSemaphores(device.value, MAX_FRAMES_IN_FLIGHT);
+              renderFinishedSemaphores = createSemaphores(device.value, MAX_FRAMES_IN_FLIGHT);
+              inFlightFences = createFences(device.value, MAX_FRAMES_IN_FLIGHT);
             } catch (...) {
               std::throw_with_nested(std::runtime_error(CALL_INFO()));
             }
@@ -256,10 +269,10 @@ namespace exqudens::vulkan {
 
           void drawFrame(int width, int height) {
             try {
-              vkWaitForFences(device, 1, &inFlightFences[currentFrame], VK_TRUE, UINT64_MAX);
+              vkWaitForFences(device.value, 1, &inFlightFences[currentFrame].value, VK_TRUE, UINT64_MAX);
 
               uint32_t imageIndex;
-              VkResult result = vkAcquireNextImageKHR(device, swapChain.value, UINT64_MAX, imageAvailableSemaphores[currentFrame], VK_NULL_HANDLE, &imageIndex);
+              VkResult result = vkAcquireNextImageKHR(device.value, swapChain.value, UINT64_MAX, imageAvailableSemaphores[currentFrame].value, VK_NULL_HANDLE, &imageIndex);
 
               if (result == VK_ERROR_OUT_OF_DATE_KHR) {
                 reCreateSwapChain(width, height);
@@ -270,13 +283,13 @@ namespace exqudens::vulkan {
 
               updateUniformBuffer(currentFrame);
 
-              vkResetFences(device, 1, &inFlightFences[currentFrame]);
+              vkResetFences(device.value, 1, &inFlightFences[currentFrame].value);
 
-              vkResetCommandBuffer(graphicsCommandBuffers[currentFrame], /*VkCommandBufferResetFlagBits*/ 0);
+              vkResetCommandBuffer(graphicsCommandBuffers[currentFrame].value, /*VkCommandBufferResetFlagBits*/ 0);
               recordCommandBuffer(
-                  graphicsCommandBuffers[currentFrame],
+                  graphicsCommandBuffers[currentFrame].value,
                   imageIndex,
-                  renderPass,
+                  renderPass.value,
                   swapChainFrameBuffers,
                   swapChain.extent,
                   graphicsPipeline.value,
@@ -290,20 +303,20 @@ namespace exqudens::vulkan {
               VkSubmitInfo submitInfo{};
               submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
-              VkSemaphore waitSemaphores[] = {imageAvailableSemaphores[currentFrame]};
+              VkSemaphore waitSemaphores[] = {imageAvailableSemaphores[currentFrame].value};
               VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
               submitInfo.waitSemaphoreCount = 1;
               submitInfo.pWaitSemaphores = waitSemaphores;
               submitInfo.pWaitDstStageMask = waitStages;
 
               submitInfo.commandBufferCount = 1;
-              submitInfo.pCommandBuffers = &graphicsCommandBuffers[currentFrame];
+              submitInfo.pCommandBuffers = &graphicsCommandBuffers[currentFrame].value;
 
-              VkSemaphore signalSemaphores[] = {renderFinishedSemaphores[currentFrame]};
+              VkSemaphore signalSemaphores[] = {renderFinishedSemaphores[currentFrame].value};
               submitInfo.signalSemaphoreCount = 1;
               submitInfo.pSignalSemaphores = signalSemaphores;
 
-              if (vkQueueSubmit(graphicsQueue.value, 1, &submitInfo, inFlightFences[currentFrame]) != VK_SUCCESS) {
+              if (vkQueueSubmit(graphicsQueue.value, 1, &submitInfo, inFlightFences[currentFrame].value) != VK_SUCCESS) {
                 throw std::runtime_error("failed to submit draw command buffer!");
               }
 
@@ -336,7 +349,7 @@ namespace exqudens::vulkan {
 
           void waitIdle() {
             try {
-              vkDeviceWaitIdle(device);
+              vkDeviceWaitIdle(device.value);
             } catch (...) {
               std::throw_with_nested(std::runtime_error(CALL_INFO()));
             }
@@ -344,34 +357,34 @@ namespace exqudens::vulkan {
 
           void destroy() {
             try {
-              destroySemaphores(renderFinishedSemaphores, device);
-              destroySemaphores(imageAvailableSemaphores, device);
-              destroyFences(inFlightFences, device);
+              destroySemaphores(renderFinishedSemaphores);
+              destroySemaphores(imageAvailableSemaphores);
+              destroyFences(inFlightFences);
 
-              destroyCommandBuffers(graphicsCommandBuffers, graphicsCommandPool, device);
-              destroyCommandBuffer(transferCommandBuffer, transferCommandPool, device);
+              destroyCommandBuffers(graphicsCommandBuffers);
+              destroyCommandBuffer(transferCommandBuffer);
               destroyDescriptorSets(descriptorSets);
-              destroyDescriptorPool(descriptorPool, device);
-              destroyBuffers(uniformBuffers, device);
-              destroyBuffer(indexBuffer, device);
-              destroyBuffer(indexStagingBuffer, device);
-              destroyBuffer(vertexBuffer, device);
-              destroyBuffer(vertexStagingBuffer, device);
-              destroyFrameBuffers(swapChainFrameBuffers, device);
-              destroyPipeline(graphicsPipeline, device);
-              destroyDescriptorSetLayout(descriptorSetLayout, device);
-              destroyRenderPass(renderPass, device);
-              destroyImageViews(swapChainImageViews, device);
-              destroySwapChain(swapChain, device);
-              destroyCommandPool(graphicsCommandPool, device);
-              destroyCommandPool(transferCommandPool, device);
+              destroyDescriptorPool(descriptorPool);
+              destroyBuffers(uniformBuffers);
+              destroyBuffer(indexBuffer);
+              destroyBuffer(indexStagingBuffer);
+              destroyBuffer(vertexBuffer);
+              destroyBuffer(vertexStagingBuffer);
+              destroyFrameBuffers(swapChainFrameBuffers);
+              destroyPipeline(graphicsPipeline);
+              destroyDescriptorSetLayout(descriptorSetLayout);
+              destroyRenderPass(renderPass);
+              destroyImageViews(swapChainImageViews);
+              destroySwapChain(swapChain);
+              destroyCommandPool(graphicsCommandPool);
+              destroyCommandPool(transferCommandPool);
               destroyQueue(presentQueue);
               destroyQueue(graphicsQueue);
               destroyQueue(transferQueue);
               destroyDevice(device);
               destroyPhysicalDevice(physicalDevice);
-              destroySurface(surface, instance);
-              destroyDebugUtilsMessenger(debugUtilsMessenger, instance);
+              destroySurface(surface);
+              destroyDebugUtilsMessenger(debugUtilsMessenger);
               destroyInstance(instance);
             } catch (...) {
               std::throw_with_nested(std::runtime_error(CALL_INFO()));
@@ -394,7 +407,7 @@ namespace exqudens::vulkan {
             allocInfo.commandBufferCount = 1;
 
             VkCommandBuffer commandBuffer;
-            vkAllocateCommandBuffers(device, &allocInfo, &commandBuffer);
+            vkAllocateCommandBuffers(device.value, &allocInfo, &commandBuffer);
 
             VkCommandBufferBeginInfo beginInfo{};
             beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -416,20 +429,20 @@ namespace exqudens::vulkan {
             vkQueueSubmit(queue, 1, &submitInfo, VK_NULL_HANDLE);
             vkQueueWaitIdle(queue);
 
-            vkFreeCommandBuffers(device, commandPool, 1, &commandBuffer);
+            vkFreeCommandBuffers(device.value, commandPool, 1, &commandBuffer);
           }
 
           void recordCommandBuffer(
               VkCommandBuffer& commandBuffer,
               uint32_t imageIndex,
               VkRenderPass& renderPass,
-              std::vector<VkFramebuffer>& swapChainFramebuffers,
+              std::vector<FrameBuffer>& swapChainFramebuffers,
               VkExtent2D& swapChainExtent,
               VkPipeline& graphicsPipeline,
               VkBuffer& vertexBuffer,
               VkBuffer& indexBuffer,
               VkPipelineLayout& pipelineLayout,
-              std::vector<VkDescriptorSet>& descriptorSets,
+              std::vector<DescriptorSet>& descriptorSets,
               std::size_t currentFrame
           ) {
             VkCommandBufferBeginInfo beginInfo{};
@@ -442,7 +455,7 @@ namespace exqudens::vulkan {
             VkRenderPassBeginInfo renderPassInfo{};
             renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
             renderPassInfo.renderPass = renderPass;
-            renderPassInfo.framebuffer = swapChainFramebuffers[imageIndex];
+            renderPassInfo.framebuffer = swapChainFramebuffers[imageIndex].value;
             renderPassInfo.renderArea.offset = {0, 0};
             renderPassInfo.renderArea.extent = swapChainExtent;
 
@@ -454,13 +467,24 @@ namespace exqudens::vulkan {
 
             vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
 
+            VkViewport viewport = {
+                .x = 0.0f,
+                .y = 0.0f,
+                .width = static_cast<float>(renderPassInfo.renderArea.extent.width),
+                .height = static_cast<float>(renderPassInfo.renderArea.extent.height),
+                .minDepth = 0.0f,
+                .maxDepth = 1.0f
+            };
+            vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+            vkCmdSetScissor(commandBuffer, 0, 1, &renderPassInfo.renderArea);
+
             VkBuffer vertexBuffers[] = {vertexBuffer};
             VkDeviceSize offsets[] = {0};
             vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
 
             vkCmdBindIndexBuffer(commandBuffer, indexBuffer, 0, VK_INDEX_TYPE_UINT16);
 
-            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &descriptorSets[currentFrame], 0, nullptr);
+            vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0, 1, &descriptorSets[currentFrame].value, 0, nullptr);
 
             vkCmdDrawIndexed(commandBuffer, static_cast<uint32_t>(indices.size()), 1, 0, 0, 0);
 
@@ -474,45 +498,54 @@ namespace exqudens::vulkan {
           void reCreateSwapChain(int width, int height) {
             std::cout << __FUNCTION__ << " width: " << width << " height: " << height << std::endl;
 
-            vkDeviceWaitIdle(device);
-
-            destroyFrameBuffers(swapChainFrameBuffers, device);
-            destroyPipeline(graphicsPipeline, device);
-            destroyRenderPass(renderPass, device);
-            destroyImageViews(swapChainImageViews, device);
-            destroySwapChain(swapChain, device);
-
-            physicalDevice.swapChainSupportDetails = querySwapChainSupport(physicalDevice.value, surface);
-
-            swapChain = createSwapChain(physicalDevice.swapChainSupportDetails.value(), physicalDevice.queueFamilyIndexInfo, surface, device, width, height);
-            swapChainImages = createSwapChainImages(device, swapChain.value);
-            swapChainImageViews = createImageViews(device, swapChainImages, swapChain.format);
-            renderPass = createRenderPass(device, swapChain.format);
-            graphicsPipeline = createGraphicsPipeline(
-                device,
-                swapChain.extent,
-                {"resources/shader/shader-3.vert.spv", "resources/shader/shader-3.frag.spv"},
-                renderPass,
-                VK_FRONT_FACE_COUNTER_CLOCKWISE,
-                {descriptorSetLayout},
-                {Vertex::getBindingDescription()},
-                Vertex::getAttributeDescriptions()
-            );
+            vkDeviceWaitIdle(device.value);
+
+            VkFormat swapChainFormat = swapChain.format;
+
+            destroyFrameBuffers(swapChainFrameBuffers);
+            destroyImageViews(swapChainImageViews);
+            destroySwapChain(swapChain);
+
+            physicalDevice.swapChainSupportDetails = querySwapChainSupport(physicalDevice.value, surface.value);
+
+            swapChain = createSwapChain(physicalDevice.swapChainSupportDetails.value(), physicalDevice.queueFamilyIndexInfo, surface.value, device.value, width, height);
+            swapChainImages = createSwapChainImages(device.value, swapChain.value);
+            swapChainImageViews = createImageViews(device.value, swapChainImages, swapChain.format);
+
+            // viewport and scissor are dynamic, so the render pass and the pipeline
+            // only have to be rebuilt when the surface format changes
+            if (swapChain.format != swapChainFormat) {
+              destroyPipeline(graphicsPipeline);
+              destroyRenderPass(renderPass);
+
+              renderPass = createRenderPass(device.value, swapChain.format);
+              graphicsPipeline = createGraphicsPipeline(
+                  device.value,
+                  swapChain.extent,
+                  {"resources/shader/shader-3.vert.spv", "resources/shader/shader-3.frag.spv"},
+                  renderPass.value,
+                  VK_FRONT_FACE_COUNTER_CLOCKWISE,
+                  {descriptorSetLayout.value},
+                  {Vertex::getBindingDescription()},
+                  Vertex::getAttributeDescriptions()
+              );
+            }
+
             std::vector<FrameBufferCreateInfo> frameBufferCreateInfoVector;
             frameBufferCreateInfoVector.resize(swapChainImageViews.size());
             for (std::size_t i = 0; i < frameBufferCreateInfoVector.size(); i++) {
               frameBufferCreateInfoVector[i] = FrameBufferCreateInfo {
                   .flags = 0,
-                  .renderPass = renderPass,
+                  .renderPass = renderPass.value,
                   .attachments = {
-                      swapChainImageViews[i]
+                      swapChainImageViews[i].value
                   },
                   .width = swapChain.extent.width,
                   .height = swapChain.extent.height,
                   .layers = 1
               };
             }
-            swapChainFrameBuffers = createFrameBuffers(device, frameBufferCreateInfoVector);
+            swapChainFrameBuffers = createFrameBuffers(device.value, frameBufferCreateInfoVector);
           }
 
           void updateUniformBuffer(uint32_t currentImage) {
@@ -528,9 +561,9 @@ namespace exqudens::vulkan {
             ubo.proj[1][1] *= -1;
 
             void* data;
-            vkMapMemory(device, uniformBuffers[currentImage].memory, 0, sizeof(ubo), 0, &data);
+            vkMapMemory(device.value, uniformBuffers[currentImage].memory, 0, sizeof(ubo), 0, &data);
             std::memcpy(data, &ubo, sizeof(ubo));
-            vkUnmapMemory(device, uniformBuffers[currentImage].memory);
+            vkUnmapMemory(device.value, uniformBuffers[currentImage].memory);
           }
 
       };
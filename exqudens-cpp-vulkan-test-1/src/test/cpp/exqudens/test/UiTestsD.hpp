@@ -5,6 +5,7 @@
 #include <vector>
 #include <chrono>
 #include <filesystem>
+#include <source_location>
 #include <stdexcept>
 
 #define GLFW_INCLUDE_VULKAN
@@ -85,7 +86,10 @@ namespace exqudens::vulkan {
 
           bool resized = false;
 
-          Surface createSurface(VkInstance& instance) override {
+          Surface createSurface(
+              VkInstance& instance,
+              std::source_location location = std::source_location::current()
+          ) override {
             VkSurfaceKHR result;
             if (glfwCreateWindowSurface(instance, window, nullptr, &result) != VK_SUCCESS) {
               throw std::runtime_error(CALL_INFO() + ": failed to create window surface!");
@@ -316,7 +320,7 @@ namespace exqudens::vulkan {
 
               void* imageData;
               vkMapMemory(device.value, imageStaging.memory, 0, imageStaging.memorySize, 0, &imageData);
-              std::memcpy(imageData, pixels.data(), static_cast<size_t>(imageStaging.memorySize));
+              std::memcpy(imageData, pixels.data(), pixels.size());
               vkUnmapMemory(device.value, imageStaging.memory);
 
               std::vector<FrameBufferCreateInfo> frameBufferCreateInfoVector;
@@ -357,7 +361,7 @@ namespace exqudens::vulkan {
 
               void* vertexData;
               vkMapMemory(device.value, vertexStagingBuffer.memory, 0, vertexStagingBuffer.memorySize, 0, &vertexData);
-              std::memcpy(vertexData, vertices.data(), (size_t) vertexStagingBuffer.memorySize);
+              std::memcpy(vertexData, vertices.data(), sizeof(vertices[0]) * vertices.size());
               vkUnmapMemory(device.value, vertexStagingBuffer.memory);
 
               vertexBuffer = createBuffer(
@@ -377,7 +381,7 @@ namespace exqudens::vulkan {
 
               void* indexData;
               vkMapMemory(device.value, indexStagingBuffer.memory, 0, indexStagingBuffer.memorySize, 0, &indexData);
-              std::memcpy(indexData, indices.data(), (size_t) indexStagingBuffer.memorySize);
+              std::memcpy(indexData, indices.data(), sizeof(indices[0]) * indices.size());
               vkUnmapMemory(device.value, indexStagingBuffer.memory);
 
               indexBuffer = createBuffer(
@@ -487,7 +491,7 @@ namespace exqudens::vulkan {
                   device.value,
                   transferQueue.value,
                   transferCommandPool.value,
-                  vertexStagingBuffer.memorySize,
+                  sizeof(vertices[0]) * vertices.size(),
                   vertexStagingBuffer.value,
                   vertexBuffer.value
               );
@@ -496,7 +500,7 @@ namespace exqudens::vulkan {
                   device.value,
                   transferQueue.value,
                   transferCommandPool.value,
-                  indexStagingBuffer.memorySize,
+                  sizeof(indices[0]) * indices.size(),
                   indexStagingBuffer.value,
                   indexBuffer.value
               );
@@ -831,6 +835,17 @@ namespace exqudens::vulkan {
 
             vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
 
+            VkViewport viewport = {
+                .x = 0.0f,
+                .y = 0.0f,
+                .width = static_cast<float>(renderPassInfo.renderArea.extent.width),
+                .height = static_cast<float>(renderPassInfo.renderArea.extent.height),
+                .minDepth = 0.0f,
+                .maxDepth = 1.0f
+            };
+            vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+            vkCmdSetScissor(commandBuffer, 0, 1, &renderPassInfo.renderArea);
+
             VkBuffer vertexBuffers[] = {vertexBuffer};
             VkDeviceSize offsets[] = {0};
             vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
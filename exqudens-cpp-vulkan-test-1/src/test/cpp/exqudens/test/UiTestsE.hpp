@@ -1,10 +1,14 @@
 #pragma once
 
 #include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <map>
 #include <string>
 #include <vector>
 #include <chrono>
 #include <filesystem>
+#include <source_location>
 #include <stdexcept>
 
 #define GLFW_INCLUDE_VULKAN
@@ -85,7 +89,10 @@ namespace exqudens::vulkan {
 
           bool resized = false;
 
-          Surface createSurface(VkInstance& instance) override {
+          Surface createSurface(
+              VkInstance& instance,
+              std::source_location location = std::source_location::current()
+          ) override {
             VkSurfaceKHR result;
             if (glfwCreateWindowSurface(instance, window, nullptr, &result) != VK_SUCCESS) {
               throw std::runtime_error(CALL_INFO() + ": failed to create window surface!");
@@ -283,7 +290,7 @@ namespace exqudens::vulkan {
 
               void* imageData;
               vkMapMemory(device.value, imageStaging.memory, 0, imageStaging.memorySize, 0, &imageData);
-              std::memcpy(imageData, pixels.data(), static_cast<size_t>(imageStaging.memorySize));
+              std::memcpy(imageData, pixels.data(), pixels.size());
               vkUnmapMemory(device.value, imageStaging.memory);
 
               std::vector<FrameBufferCreateInfo> frameBufferCreateInfoVector;
@@ -324,7 +331,7 @@ namespace exqudens::vulkan {
 
               void* vertexData;
               vkMapMemory(device.value, vertexStagingBuffer.memory, 0, vertexStagingBuffer.memorySize, 0, &vertexData);
-              std::memcpy(vertexData, vertices.data(), (size_t) vertexStagingBuffer.memorySize);
+              std::memcpy(vertexData, vertices.data(), sizeof(vertices[0]) * vertices.size());
               vkUnmapMemory(device.value, vertexStagingBuffer.memory);
 
               vertexBuffer = createBuffer(
@@ -344,7 +351,7 @@ namespace exqudens::vulkan {
 
               void* indexData;
               vkMapMemory(device.value, indexStagingBuffer.memory, 0, indexStagingBuffer.memorySize, 0, &indexData);
-              std::memcpy(indexData, indices.data(), (size_t) indexStagingBuffer.memorySize);
+              std::memcpy(indexData, indices.data(), sizeof(indices[0]) * indices.size());
               vkUnmapMemory(device.value, indexStagingBuffer.memory);
 
               indexBuffer = createBuffer(
@@ -430,7 +437,7 @@ namespace exqudens::vulkan {
                   device.value,
                   transferQueue.value,
                   transferCommandPool.value,
-                  vertexStagingBuffer.memorySize,
+                  sizeof(vertices[0]) * vertices.size(),
                   vertexStagingBuffer.value,
                   vertexBuffer.value
               );
@@ -439,7 +446,7 @@ namespace exqudens::vulkan {
                   device.value,
                   transferQueue.value,
                   transferCommandPool.value,
-                  indexStagingBuffer.memorySize,
+                  sizeof(indices[0]) * indices.size(),
                   indexStagingBuffer.value,
                   indexBuffer.value
               );
@@ -767,6 +774,17 @@ namespace exqudens::vulkan {
 
             vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
 
+            VkViewport viewport = {
+                .x = 0.0f,
+                .y = 0.0f,
+                .width = static_cast<float>(renderPassInfo.renderArea.extent.width),
+                .height = static_cast<float>(renderPassInfo.renderArea.extent.height),
+                .minDepth = 0.0f,
+                .maxDepth = 1.0f
+            };
+            vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+            vkCmdSetScissor(commandBuffer, 0, 1, &renderPassInfo.renderArea);
+
             VkBuffer vertexBuffers[] = {vertexBuffer};
             VkDeviceSize offsets[] = {0};
             vkCmdBindVertexBuffers(commandBuffer, 0, 1, vertexBuffers, offsets);
@@ -789,9 +807,9 @@ namespace exqudens::vulkan {
 
             vkDeviceWaitIdle(device.value);
 
+            VkFormat swapChainFormat = swapChain.format;
+
             destroyFrameBuffers(swapChainFrameBuffers);
-            destroyPipeline(graphicsPipeline);
-            destroyRenderPass(renderPass);
             destroyImageView(depthImageView);
             destroyImage(depthImage);
             destroyImageViews(swapChainImageViews);
@@ -816,68 +834,75 @@ namespace exqudens::vulkan {
             depthImageView = createImageView(device.value, depthImage.value, depthImage.format, VK_IMAGE_ASPECT_DEPTH_BIT);
             transitionImageLayout(device.value, transferQueue.value, transferCommandPool.value, depthImage.value, depthImage.format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
 
-            renderPass = createRenderPass(
-                device.value,
-                RenderPassCreateInfo {
-                    .attachments = {
-                        VkAttachmentDescription {
-                            .format = swapChain.format,
-                            .samples = VK_SAMPLE_COUNT_1_BIT,
-                            .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
-                            .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
-                            .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
-                            .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
-                            .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-                            .finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
-                        },
-                        VkAttachmentDescription {
-                            .format = depthImage.format,
-                            .samples = VK_SAMPLE_COUNT_1_BIT,
-                            .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
-                            .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
-                            .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
-                            .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
-                            .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
-                            .finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
-                        }
-                    },
-                    .subPasses = {
-                        SubPassDescription {
-                            .pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS,
-                            .colorAttachments = {
-                                VkAttachmentReference {
-                                    .attachment = 0,
-                                    .layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
-                                }
-                            },
-                            .depthStencilAttachment = VkAttachmentReference {
-                                .attachment = 1,
-                                .layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
-                            }
-                        }
-                    },
-                    .dependencies = {
-                        VkSubpassDependency {
-                            .srcSubpass = VK_SUBPASS_EXTERNAL,
-                            .dstSubpass = 0,
-                            .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
-                            .dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
-                            .srcAccessMask = 0,
-                            .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
-                        }
-                    }
-                }
-            );
-            graphicsPipeline = createGraphicsPipeline(
-                device.value,
-                swapChain.extent,
-                {"resources/shader/shader-4.vert.spv", "resources/shader/shader-4.frag.spv"},
-                renderPass.value,
-                VK_FRONT_FACE_COUNTER_CLOCKWISE,
-                {descriptorSetLayout.value},
-                {Vertex::getBindingDescription()},
-                Vertex::getAttributeDescriptions()
-            );
+            // viewport and scissor are dynamic, so the render pass and the pipeline
+            // only have to be rebuilt when the surface format changes
+            if (swapChain.format != swapChainFormat) {
+              destroyPipeline(graphicsPipeline);
+              destroyRenderPass(renderPass);
+
+              renderPass = createRenderPass(
+                  device.value,
+                  RenderPassCreateInfo {
+                      .attachments = {
+                          VkAttachmentDescription {
+                              .format = swapChain.format,
+                              .samples = VK_SAMPLE_COUNT_1_BIT,
+                              .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+                              .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+                              .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+                              .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                              .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                              .finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+                          },
+                          VkAttachmentDescription {
+                              .format = depthImage.format,
+                              .samples = VK_SAMPLE_COUNT_1_BIT,
+                              .loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+                              .storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+                              .stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+                              .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                              .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+                              .finalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+                          }
+                      },
+                      .subPasses = {
+                          SubPassDescription {
+                              .pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS,
+                              .colorAttachments = {
+                                  VkAttachmentReference {
+                                      .attachment = 0,
+                                      .layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+                                  }
+                              },
+                              .depthStencilAttachment = VkAttachmentReference {
+                                  .attachment = 1,
+                                  .layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+                              }
+                          }
+                      },
+                      .dependencies = {
+                          VkSubpassDependency {
+                              .srcSubpass = VK_SUBPASS_EXTERNAL,
+                              .dstSubpass = 0,
+                              .srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+                              .dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+                              .srcAccessMask = 0,
+                              .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+                          }
+                      }
+                  }
+              );
+              graphicsPipeline = createGraphicsPipeline(
+                  device.value,
+                  swapChain.extent,
+                  {"resources/shader/shader-4.vert.spv", "resources/shader/shader-4.frag.spv"},
+                  renderPass.value,
+                  VK_FRONT_FACE_COUNTER_CLOCKWISE,
+                  {descriptorSetLayout.value},
+                  {Vertex::getBindingDescription()},
+                  Vertex::getAttributeDescriptions()
+              );
+            }
 
             std::vector<FrameBufferCreateInfo> frameBufferCreateInfoVector;
             frameBufferCreateInfoVector.resize(swapChainImageViews.size());
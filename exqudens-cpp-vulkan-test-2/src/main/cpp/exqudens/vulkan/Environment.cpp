@@ -15,6 +15,7 @@
 #include "lodepng.h"
 
 #include "exqudens/vulkan/Environment.hpp"
+#include "exqudens/vulkan/Shaders.hpp"
 
 #define LOG_INFO(message) std::cout << "LOG_INFO: " << __FUNCTION__ << "(" << __FILE__ << ":" << __LINE__ << "): " << message << std::endl
 #define LOG_ERROR(message) std::cerr << "LOG_ERROR: " << __FUNCTION__ << "(" << __FILE__ << ":" << __LINE__ << "): " << message << std::endl
@@ -509,8 +510,8 @@ namespace exqudens::vulkan {
   }
 
   void Environment::setGraphicsPipeline() {
-    auto vertShaderCode = readFile("shaders/shader.vert.spv");
-    auto fragShaderCode = readFile("shaders/shader.frag.spv");
+    auto vertShaderCode = shaders::SHADERS.at("shaders/shader.vert.spv");
+    auto fragShaderCode = shaders::SHADERS.at("shaders/shader.frag.spv");
 
     VkShaderModule vertShaderModule = createShaderModule(vertShaderCode);
     VkShaderModule fragShaderModule = createShaderModule(fragShaderCode);
@@ -1354,10 +1355,14 @@ namespace exqudens::vulkan {
   }
 
   VkShaderModule Environment::createShaderModule(const std::vector<char>& code) {
+    return createShaderModule(std::span<const uint32_t>(reinterpret_cast<const uint32_t*>(code.data()), code.size() / sizeof(uint32_t)));
+  }
+
+  VkShaderModule Environment::createShaderModule(std::span<const uint32_t> code) {
     VkShaderModuleCreateInfo createInfo{};
     createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-    createInfo.codeSize = code.size();
-    createInfo.pCode = reinterpret_cast<const uint32_t*>(code.data());
+    createInfo.codeSize = code.size_bytes();
+    createInfo.pCode = code.data();
 
     VkShaderModule shaderModule;
 
@@ -5,6 +5,7 @@
 #include <optional>
 #include <vector>
 #include <map>
+#include <span>
 #include <tuple>
 #include <exqudens/vulkan/model/UniformBufferObject.hpp>
 
@@ -192,6 +193,7 @@ namespace exqudens::vulkan {
       virtual std::vector<char> readFile(const std::string& path);
       virtual VkImageView createImageView(VkImage image, VkFormat format);
       virtual VkShaderModule createShaderModule(const std::vector<char>& code);
+      virtual VkShaderModule createShaderModule(std::span<const uint32_t> code);
       virtual std::tuple<VkBuffer, VkDeviceMemory> createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags properties);
       virtual std::tuple<VkImage, VkDeviceMemory> createImage(uint32_t width, uint32_t height, VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties);
       virtual uint32_t findMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
@@ -0,0 +1,59 @@
+cmake_minimum_required(VERSION 3.21 FATAL_ERROR)
+
+# cmake -D "INPUT_DIR=<dir>" -D "KEY_PREFIX=<prefix>" -D "NAMESPACE=<namespace>" -D "OUTPUT_FILE=<file>" -P spirv-header.cmake
+
+foreach(name INPUT_DIR NAMESPACE OUTPUT_FILE)
+    if("" STREQUAL "${${name}}")
+        message(FATAL_ERROR "Empty value not supported for '${name}'.")
+    endif()
+endforeach()
+
+file(GLOB inputFiles LIST_DIRECTORIES false "${INPUT_DIR}/*.spv")
+list(SORT inputFiles)
+
+set(arrays "")
+set(entries "")
+
+foreach(inputFile IN LISTS inputFiles)
+    get_filename_component(fileName "${inputFile}" NAME)
+    string(MAKE_C_IDENTIFIER "${fileName}" arrayName)
+    string(TOUPPER "${arrayName}" arrayName)
+
+    file(READ "${inputFile}" hex HEX)
+    string(LENGTH "${hex}" hexLength)
+    math(EXPR hexRemainder "${hexLength} % 8")
+    if("0" STREQUAL "${hexLength}" OR NOT "0" STREQUAL "${hexRemainder}")
+        message(FATAL_ERROR "Not a SPIR-V binary: '${inputFile}'!")
+    endif()
+
+    # little-endian bytes to 32-bit words, eight words per line
+    string(REGEX REPLACE "(..)(..)(..)(..)" "0x\\4\\3\\2\\1, " words "${hex}")
+    set(word "0x[0-9a-f]+, ")
+    string(REGEX REPLACE "(${word}${word}${word}${word}${word}${word}${word}${word})" "\\1\n      " words "${words}")
+    string(REPLACE ", \n" ",\n" words "${words}")
+    string(REGEX REPLACE "[, \n]+$" "" words "${words}")
+
+    string(APPEND arrays "  constexpr uint32_t ${arrayName}[] = {\n      ${words}\n  };\n\n")
+    string(APPEND entries "      {\"${KEY_PREFIX}${fileName}\", ${arrayName}},\n")
+endforeach()
+
+string(REGEX REPLACE ",\n$" "\n" entries "${entries}")
+
+file(CONFIGURE
+    OUTPUT "${OUTPUT_FILE}"
+    CONTENT "#pragma once
+
+#include <cstdint>
+#include <map>
+#include <span>
+#include <string>
+
+namespace ${NAMESPACE} {
+
+${arrays}  inline const std::map<std::string, std::span<const uint32_t>> SHADERS = {
+${entries}  };
+
+}
+"
+    @ONLY
+)